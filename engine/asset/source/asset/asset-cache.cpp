@@ -0,0 +1,201 @@
+#include "asset-cache.hpp"
+
+#include <functional>
+#include <iterator>
+
+namespace april::asset
+{
+    AssetCache::AssetCache(AssetCacheSettings const& settings)
+        : m_budgetBytes{settings.budgetBytes}
+    {}
+
+    auto AssetCache::setSettings(AssetCacheSettings const& settings) -> void
+    {
+        m_budgetBytes = settings.budgetBytes;
+        trim();
+    }
+
+    auto AssetCache::getSettings() const -> AssetCacheSettings
+    {
+        return AssetCacheSettings{m_budgetBytes.load()};
+    }
+
+    auto AssetCache::find(core::UUID const& guid) -> std::shared_ptr<Asset>
+    {
+        auto& shard = getShard(guid);
+        auto lock = std::scoped_lock{shard.mutex};
+        auto it = shard.entries.find(guid);
+        if (it == shard.entries.end())
+        {
+            ++shard.misses;
+            return nullptr;
+        }
+
+        ++shard.hits;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+        return it->second.asset;
+    }
+
+    auto AssetCache::contains(core::UUID const& guid) const -> bool
+    {
+        auto const& shard = getShard(guid);
+        auto lock = std::scoped_lock{shard.mutex};
+        return shard.entries.contains(guid);
+    }
+
+    auto AssetCache::insert(std::shared_ptr<Asset> const& asset) -> void
+    {
+        if (!asset)
+        {
+            return;
+        }
+
+        auto& shard = getShard(asset->getHandle());
+        auto lock = std::scoped_lock{shard.mutex};
+        if (auto it = shard.entries.find(asset->getHandle()); it != shard.entries.end())
+        {
+            eraseLocked(shard, it);
+        }
+        insertLocked(shard, asset);
+    }
+
+    auto AssetCache::emplace(std::shared_ptr<Asset> const& asset) -> std::shared_ptr<Asset>
+    {
+        if (!asset)
+        {
+            return nullptr;
+        }
+
+        auto& shard = getShard(asset->getHandle());
+        auto lock = std::scoped_lock{shard.mutex};
+        if (auto it = shard.entries.find(asset->getHandle()); it != shard.entries.end())
+        {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+            return it->second.asset;
+        }
+
+        insertLocked(shard, asset);
+        return asset;
+    }
+
+    auto AssetCache::erase(core::UUID const& guid) -> bool
+    {
+        auto& shard = getShard(guid);
+        auto lock = std::scoped_lock{shard.mutex};
+        auto it = shard.entries.find(guid);
+        if (it == shard.entries.end())
+        {
+            return false;
+        }
+
+        eraseLocked(shard, it);
+        return true;
+    }
+
+    auto AssetCache::trim() -> size_t
+    {
+        auto evicted = size_t{0};
+        for (auto& shard : m_shards)
+        {
+            auto lock = std::scoped_lock{shard.mutex};
+            evicted += trimLocked(shard);
+        }
+        return evicted;
+    }
+
+    auto AssetCache::clear() -> void
+    {
+        for (auto& shard : m_shards)
+        {
+            auto lock = std::scoped_lock{shard.mutex};
+            shard.entries.clear();
+            shard.lru.clear();
+            shard.bytes = 0;
+        }
+    }
+
+    auto AssetCache::getStats() const -> AssetCacheStats
+    {
+        auto stats = AssetCacheStats{};
+        for (auto const& shard : m_shards)
+        {
+            auto lock = std::scoped_lock{shard.mutex};
+            stats.totalBytes += shard.bytes;
+            stats.hits += shard.hits;
+            stats.misses += shard.misses;
+            stats.evictions += shard.evictions;
+            for (auto const& [guid, entry] : shard.entries)
+            {
+                auto const type = static_cast<size_t>(entry.asset->getType());
+                if (type < AssetCacheStats::kTypeCount)
+                {
+                    stats.bytesByType[type] += entry.bytes;
+                    ++stats.countByType[type];
+                }
+            }
+        }
+        return stats;
+    }
+
+    auto AssetCache::getSize() const -> size_t
+    {
+        auto size = size_t{0};
+        for (auto const& shard : m_shards)
+        {
+            auto lock = std::scoped_lock{shard.mutex};
+            size += shard.entries.size();
+        }
+        return size;
+    }
+
+    auto AssetCache::getShard(core::UUID const& guid) -> Shard&
+    {
+        return m_shards[std::hash<core::UUID>{}(guid) % kShardCount];
+    }
+
+    auto AssetCache::getShard(core::UUID const& guid) const -> Shard const&
+    {
+        return m_shards[std::hash<core::UUID>{}(guid) % kShardCount];
+    }
+
+    auto AssetCache::insertLocked(Shard& shard, std::shared_ptr<Asset> const& asset) -> void
+    {
+        auto const guid = asset->getHandle();
+        shard.lru.push_front(guid);
+        auto const bytes = static_cast<uint64_t>(asset->getMemoryUsage());
+        shard.entries.emplace(guid, Entry{asset, bytes, shard.lru.begin()});
+        shard.bytes += bytes;
+        trimLocked(shard);
+    }
+
+    auto AssetCache::eraseLocked(Shard& shard, std::unordered_map<core::UUID, Entry>::iterator it) -> void
+    {
+        shard.bytes -= it->second.bytes;
+        shard.lru.erase(it->second.lruPosition);
+        shard.entries.erase(it);
+    }
+
+    auto AssetCache::trimLocked(Shard& shard) -> size_t
+    {
+        auto const budget = m_budgetBytes.load() / kShardCount;
+        auto evicted = size_t{0};
+        auto position = shard.lru.end();
+        while (shard.bytes > budget && position != shard.lru.begin())
+        {
+            auto const candidate = std::prev(position);
+            auto it = shard.entries.find(*candidate);
+
+            // Copies only come out of the cache under this lock, so a single owner stays single.
+            if (it->second.asset.use_count() > 1)
+            {
+                position = candidate;
+                continue;
+            }
+
+            eraseLocked(shard, it);
+            ++shard.evictions;
+            ++evicted;
+        }
+        return evicted;
+    }
+} // namespace april::asset
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "asset.hpp"
+
+#include <core/tools/uuid.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace april::asset
+{
+    struct AssetCacheSettings
+    {
+        uint64_t budgetBytes{64ull << 20};  // CPU memory of loaded assets; only unreferenced ones are evicted to meet it
+    };
+
+    struct AssetCacheStats
+    {
+        static constexpr auto kTypeCount = static_cast<size_t>(AssetType::Scene) + 1;
+
+        std::array<uint64_t, kTypeCount> bytesByType{};
+        std::array<size_t, kTypeCount> countByType{};
+        uint64_t totalBytes{0};
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t evictions{0};
+    };
+
+    /**
+     * GUID-keyed cache of loaded assets. Entries are spread over shards, each with its own lock and
+     * LRU list, so loader threads and the main thread rarely contend. An entry is referenced while anyone
+     * besides the cache holds its shared_ptr; once a shard exceeds its share of the budget, unreferenced
+     * entries are evicted least recently used first. Evicted assets reload from the registry on demand.
+     */
+    class AssetCache
+    {
+    public:
+        static constexpr size_t kShardCount = 16;
+
+        explicit AssetCache(AssetCacheSettings const& settings = {});
+
+        AssetCache(AssetCache const&) = delete;
+        auto operator=(AssetCache const&) -> AssetCache& = delete;
+
+        auto setSettings(AssetCacheSettings const& settings) -> void;
+        [[nodiscard]] auto getSettings() const -> AssetCacheSettings;
+
+        /**
+         * Returns the cached asset and marks it most recently used. Counts a hit or a miss.
+         */
+        [[nodiscard]] auto find(core::UUID const& guid) -> std::shared_ptr<Asset>;
+        [[nodiscard]] auto contains(core::UUID const& guid) const -> bool;
+
+        /**
+         * Cache asset, replacing any entry with the same GUID.
+         */
+        auto insert(std::shared_ptr<Asset> const& asset) -> void;
+
+        /**
+         * Cache asset unless its GUID is already present. Returns the cached asset either way.
+         */
+        auto emplace(std::shared_ptr<Asset> const& asset) -> std::shared_ptr<Asset>;
+
+        auto erase(core::UUID const& guid) -> bool;
+
+        /**
+         * Evict unreferenced assets from every shard that is over its budget. Returns the number evicted.
+         */
+        auto trim() -> size_t;
+        auto clear() -> void;
+
+        [[nodiscard]] auto getStats() const -> AssetCacheStats;
+        [[nodiscard]] auto getSize() const -> size_t;
+
+    private:
+        struct Entry
+        {
+            std::shared_ptr<Asset> asset{};
+            uint64_t bytes{0};
+            std::list<core::UUID>::iterator lruPosition{};
+        };
+
+        struct Shard
+        {
+            mutable std::mutex mutex{};
+            std::unordered_map<core::UUID, Entry> entries{};
+            std::list<core::UUID> lru{};  // Most recently used first
+            uint64_t bytes{0};
+            uint64_t hits{0};
+            uint64_t misses{0};
+            uint64_t evictions{0};
+        };
+
+        [[nodiscard]] auto getShard(core::UUID const& guid) -> Shard&;
+        [[nodiscard]] auto getShard(core::UUID const& guid) const -> Shard const&;
+        auto insertLocked(Shard& shard, std::shared_ptr<Asset> const& asset) -> void;
+        auto eraseLocked(Shard& shard, std::unordered_map<core::UUID, Entry>::iterator it) -> void;
+        auto trimLocked(Shard& shard) -> size_t;
+
+        std::atomic<uint64_t> m_budgetBytes{0};
+        std::array<Shard, kShardCount> m_shards{};
+    };
+} // namespace april::asset
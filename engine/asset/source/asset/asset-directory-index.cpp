@@ -0,0 +1,169 @@
+#include "asset-directory-index.hpp"
+
+#include <core/file/vfs.hpp>
+#include <core/log/logger.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace april::asset
+{
+    auto AssetDirectoryIndex::stat(std::filesystem::path const& path) -> std::optional<AssetFileStamp>
+    {
+        auto const resolved = VFS::resolvePath(path.string());
+        auto ec = std::error_code{};
+        auto const modifiedTime = std::filesystem::last_write_time(resolved, ec);
+        if (ec)
+        {
+            return std::nullopt;
+        }
+
+        auto const fileSize = std::filesystem::file_size(resolved, ec);
+        if (ec)
+        {
+            return std::nullopt;
+        }
+
+        auto stamp = AssetFileStamp{};
+        stamp.modifiedTime = static_cast<int64_t>(modifiedTime.time_since_epoch().count());
+        stamp.fileSize = static_cast<uint64_t>(fileSize);
+        return stamp;
+    }
+
+    auto AssetDirectoryIndex::find(std::string const& path) const -> AssetFileStamp const*
+    {
+        auto const it = m_entries.find(path);
+        return it != m_entries.end() ? &it->second : nullptr;
+    }
+
+    auto AssetDirectoryIndex::update(std::string const& path, AssetFileStamp const& stamp) -> void
+    {
+        auto& entry = m_entries[path];
+        if (entry.matches(stamp) && entry.guid == stamp.guid && entry.type == stamp.type)
+        {
+            return;
+        }
+
+        entry = stamp;
+        m_dirty = true;
+    }
+
+    auto AssetDirectoryIndex::retain(std::string_view directory, std::unordered_set<std::string> const& paths) -> size_t
+    {
+        auto const removed = std::erase_if(m_entries, [&](auto const& entry)
+        {
+            return entry.first.starts_with(directory) && !paths.contains(entry.first);
+        });
+        m_dirty = m_dirty || removed > 0;
+        return removed;
+    }
+
+    auto AssetDirectoryIndex::clear() -> void
+    {
+        m_dirty = m_dirty || !m_entries.empty();
+        m_entries.clear();
+    }
+
+    auto AssetDirectoryIndex::load(std::filesystem::path const& path) -> bool
+    {
+        m_entries.clear();
+        m_dirty = false;
+
+        if (!VFS::existsFile(path.string()))
+        {
+            return false;
+        }
+
+        auto const bytes = VFS::readBinaryFile(path.string());
+        auto header = DirectoryIndexHeader{};
+        if (bytes.size() < sizeof(header))
+        {
+            AP_WARN("[AssetDirectoryIndex] Ignoring truncated index: {}", path.string());
+            return false;
+        }
+
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        auto const entriesSize = uint64_t{header.entryCount} * sizeof(DirectoryIndexEntry);
+        if (!header.isValid() || sizeof(header) + entriesSize + header.stringPoolSize != bytes.size())
+        {
+            AP_WARN("[AssetDirectoryIndex] Ignoring invalid index: {}", path.string());
+            return false;
+        }
+
+        auto const* pool = reinterpret_cast<char const*>(bytes.data() + sizeof(header) + entriesSize);
+        m_entries.reserve(header.entryCount);
+        for (uint32_t i = 0; i < header.entryCount; ++i)
+        {
+            auto entry = DirectoryIndexEntry{};
+            std::memcpy(&entry, bytes.data() + sizeof(header) + i * sizeof(DirectoryIndexEntry), sizeof(entry));
+            if (uint64_t{entry.pathOffset} + entry.pathSize > header.stringPoolSize)
+            {
+                AP_WARN("[AssetDirectoryIndex] Ignoring invalid index: {}", path.string());
+                m_entries.clear();
+                return false;
+            }
+
+            auto stamp = AssetFileStamp{};
+            stamp.modifiedTime = entry.modifiedTime;
+            stamp.fileSize = entry.fileSize;
+            stamp.guid = core::UUID{std::span<uint8_t const, 16>{entry.guid}};
+            stamp.type = entry.type;
+            m_entries.emplace(std::string{pool + entry.pathOffset, entry.pathSize}, stamp);
+        }
+        return true;
+    }
+
+    auto AssetDirectoryIndex::save(std::filesystem::path const& path) -> bool
+    {
+        // Sorted so the same contents always produce the same file.
+        auto paths = std::vector<std::string const*>{};
+        paths.reserve(m_entries.size());
+        for (auto const& [entryPath, stamp] : m_entries)
+        {
+            paths.push_back(&entryPath);
+        }
+        std::ranges::sort(paths, {}, [](std::string const* entryPath) -> std::string const& { return *entryPath; });
+
+        auto header = DirectoryIndexHeader{};
+        header.entryCount = static_cast<uint32_t>(paths.size());
+
+        auto entries = std::vector<DirectoryIndexEntry>{};
+        entries.reserve(paths.size());
+        auto pool = std::string{};
+        for (auto const* entryPath : paths)
+        {
+            auto const& stamp = m_entries.at(*entryPath);
+            auto entry = DirectoryIndexEntry{};
+            entry.modifiedTime = stamp.modifiedTime;
+            entry.fileSize = stamp.fileSize;
+            std::memcpy(entry.guid.data(), stamp.guid.getBytes().data(), entry.guid.size());
+            entry.pathOffset = static_cast<uint32_t>(pool.size());
+            entry.pathSize = static_cast<uint32_t>(entryPath->size());
+            entry.type = stamp.type;
+            entries.push_back(entry);
+            pool += *entryPath;
+        }
+        header.stringPoolSize = static_cast<uint32_t>(pool.size());
+
+        auto bytes = Blob(sizeof(header) + entries.size() * sizeof(DirectoryIndexEntry) + pool.size());
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        if (!entries.empty())
+        {
+            std::memcpy(bytes.data() + sizeof(header), entries.data(), entries.size() * sizeof(DirectoryIndexEntry));
+        }
+        if (!pool.empty())
+        {
+            std::memcpy(bytes.data() + sizeof(header) + entries.size() * sizeof(DirectoryIndexEntry), pool.data(), pool.size());
+        }
+
+        if (!VFS::writeBinaryFile(path.string(), bytes))
+        {
+            AP_ERROR("[AssetDirectoryIndex] Failed to write index: {}", path.string());
+            return false;
+        }
+
+        m_dirty = false;
+        return true;
+    }
+} // namespace april::asset
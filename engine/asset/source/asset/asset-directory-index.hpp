@@ -0,0 +1,102 @@
+#pragma once
+
+#include "asset.hpp"
+
+#include <core/tools/uuid.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace april::asset
+{
+    /**
+     * Directory index layout:
+     * [DirectoryIndexHeader][DirectoryIndexEntry[]][string pool]
+     * Entry paths index into the string pool, which starts right after the entries.
+     */
+    struct DirectoryIndexHeader
+    {
+        static constexpr uint32_t kMagic = 0x41504449; // "APDI" - April Directory Index
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint32_t entryCount = 0;
+        uint32_t stringPoolSize = 0;
+
+        [[nodiscard]] auto isValid() const -> bool
+        {
+            return magic == kMagic && version == kVersion;
+        }
+    };
+
+    static_assert(sizeof(DirectoryIndexHeader) == 16, "DirectoryIndexHeader size mismatch");
+
+    struct DirectoryIndexEntry
+    {
+        int64_t modifiedTime = 0;
+        uint64_t fileSize = 0;
+        std::array<uint8_t, 16> guid{};
+        uint32_t pathOffset = 0;
+        uint32_t pathSize = 0;
+        AssetType type{AssetType::None};
+        uint8_t reserved[7]{};
+    };
+
+    static_assert(sizeof(DirectoryIndexEntry) == 48, "DirectoryIndexEntry size mismatch");
+
+    /**
+     * What the last scan saw of one .asset file. A file whose timestamp and size still match is
+     * known to hold the recorded asset and need not be reopened.
+     */
+    struct AssetFileStamp
+    {
+        int64_t modifiedTime = 0;
+        uint64_t fileSize = 0;
+        core::UUID guid{};
+        AssetType type{AssetType::None};
+
+        [[nodiscard]] auto matches(AssetFileStamp const& other) const -> bool
+        {
+            return modifiedTime == other.modifiedTime && fileSize == other.fileSize;
+        }
+    };
+
+    /**
+     * Stamps of the .asset files under the asset root, keyed by normalized path and persisted
+     * between launches so startup scans only parse files that changed.
+     */
+    class AssetDirectoryIndex
+    {
+    public:
+        /**
+         * Stat path on disk. Returns nullopt if it cannot be read; guid and type are left empty.
+         */
+        [[nodiscard]] static auto stat(std::filesystem::path const& path) -> std::optional<AssetFileStamp>;
+
+        [[nodiscard]] auto find(std::string const& path) const -> AssetFileStamp const*;
+        auto update(std::string const& path, AssetFileStamp const& stamp) -> void;
+
+        /**
+         * Drop the entries under directory whose path is not in paths. Returns the number removed.
+         */
+        auto retain(std::string_view directory, std::unordered_set<std::string> const& paths) -> size_t;
+        auto clear() -> void;
+
+        [[nodiscard]] auto getSize() const -> size_t { return m_entries.size(); }
+        [[nodiscard]] auto isDirty() const -> bool { return m_dirty; }
+
+        auto load(std::filesystem::path const& path) -> bool;
+        auto save(std::filesystem::path const& path) -> bool;
+
+    private:
+        std::unordered_map<std::string, AssetFileStamp> m_entries{};
+        bool m_dirty{false};
+    };
+} // namespace april::asset
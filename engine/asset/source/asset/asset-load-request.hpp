@@ -0,0 +1,128 @@
+#pragma once
+
+#include "asset.hpp"
+#include "blob-header.hpp"
+
+#include <core/thread/thread-pool.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace april::asset
+{
+    using LoadPriority = core::TaskPriority;
+
+    enum class LoadState : uint8_t
+    {
+        Pending,
+        Loading,
+        Ready,
+        Failed,
+        Cancelled
+    };
+
+    /**
+     * Shared state of one asynchronous asset load.
+     * Written by a worker thread, consumed on the main thread after AssetManager::processCompletedLoads.
+     * Cooked data (texture/mesh blobs) is prefetched on the worker so the main thread only creates GPU resources.
+     */
+    class AssetLoadRequest
+    {
+    public:
+        using Callback = std::function<void(AssetLoadRequest&)>;
+
+        AssetLoadRequest(std::filesystem::path assetPath, LoadPriority priority)
+            : m_assetPath{std::move(assetPath)}
+            , m_priority{priority}
+        {}
+
+        /**
+         * Request cancellation. A load that has not started is skipped; a finished one
+         * will not invoke its completion callback.
+         */
+        auto cancel() -> void { m_cancelRequested.store(true); }
+
+        [[nodiscard]] auto isCancelled() const -> bool { return m_cancelRequested.load(); }
+        [[nodiscard]] auto getState() const -> LoadState { return m_state.load(); }
+        [[nodiscard]] auto isDone() const -> bool
+        {
+            auto const state = getState();
+            return state == LoadState::Ready || state == LoadState::Failed || state == LoadState::Cancelled;
+        }
+
+        /**
+         * Block until the worker finished. Does not run the completion callback.
+         */
+        auto wait() -> void
+        {
+            auto lock = std::unique_lock{m_waitMutex};
+            m_doneCondition.wait(lock, [this]() { return isDone(); });
+        }
+
+        [[nodiscard]] auto getAssetPath() const -> std::filesystem::path const& { return m_assetPath; }
+        [[nodiscard]] auto getPriority() const -> LoadPriority { return m_priority; }
+
+        /**
+         * Valid once the state is Ready.
+         */
+        [[nodiscard]] auto getAsset() const -> std::shared_ptr<Asset> const& { return m_asset; }
+
+        template <typename T>
+        [[nodiscard]] auto getAssetAs() const -> std::shared_ptr<T>
+        {
+            return std::static_pointer_cast<T>(m_asset);
+        }
+
+        /**
+         * Prefetched cooked payloads. Views into the blob owned by this request.
+         */
+        [[nodiscard]] auto getTexturePayload() const -> TexturePayload const& { return m_texturePayload; }
+        [[nodiscard]] auto getMeshPayload() const -> MeshPayload const& { return m_meshPayload; }
+
+        /**
+         * Hash of the full cooked payload the prefetch was read from; empty in bundle mode.
+         * Requests with equal hashes carry identical data.
+         */
+        [[nodiscard]] auto getContentHash() const -> std::string const& { return m_contentHash; }
+
+    private:
+        friend class AssetManager;
+
+        auto notifyDone() -> void
+        {
+            // Taking the lock orders the state store before a waiter's predicate check.
+            {
+                auto lock = std::scoped_lock{m_waitMutex};
+            }
+            m_doneCondition.notify_all();
+        }
+
+        std::filesystem::path m_assetPath{};
+        LoadPriority m_priority{LoadPriority::Normal};
+        std::atomic<LoadState> m_state{LoadState::Pending};
+        std::atomic<bool> m_cancelRequested{false};
+
+        std::shared_ptr<Asset> m_asset{};
+        std::vector<std::byte> m_cookedBlob{};
+        uint32_t m_textureMaxDimension{std::numeric_limits<uint32_t>::max()}; // Below the maximum: read a mip range only
+        bool m_prefetchPayload{true};   // Hot reloads only recook; their consumers fetch what they need
+        TexturePayload m_texturePayload{};
+        MeshPayload m_meshPayload{};
+        std::string m_contentHash{};
+        Callback m_onComplete{};
+
+        std::mutex m_waitMutex{};
+        std::condition_variable m_doneCondition{};
+    };
+
+    using AssetLoadHandle = std::shared_ptr<AssetLoadRequest>;
+} // namespace april::asset
@@ -4,11 +4,20 @@
 #include "importer/texture-importer.hpp"
 #include "importer/gltf-importer.hpp"
 #include "importer/material-importer.hpp"
+#include "texture/texture-streaming.hpp"
 
 #include <core/file/vfs.hpp>
+#include <core/profile/profiler.hpp>
+#include <core/profile/timer.hpp>
+#include <core/thread/thread-pool.hpp>
+
+#include <meshoptimizer.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstring>
+#include <iterator>
 #include <system_error>
 #include <string_view>
 #include <utility>
@@ -39,10 +48,14 @@ namespace april::asset
 
             return chainView.substr(0, atPos);
         }
+
+        // Set on workers replaying a usage manifest; their loads are not usage of their own.
+        thread_local bool t_prefetchingUsage = false;
     }
 
     AssetManager::AssetManager(std::filesystem::path const& assetRoot,
-                               std::filesystem::path const& cacheRoot)
+                               std::filesystem::path const& cacheRoot,
+                               std::filesystem::path const& bundlePath)
         : m_assetRoot{assetRoot}
         , m_ddc{cacheRoot}
     {
@@ -52,11 +65,35 @@ namespace april::asset
         m_importers.registerImporter(std::make_unique<TextureImporter>());
         m_importers.registerImporter(std::make_unique<GltfImporter>());
         m_importers.registerImporter(std::make_unique<MaterialImporter>());
+
+        if (!bundlePath.empty())
+        {
+            if (mountBundle(bundlePath))
+            {
+                return;
+            }
+            AP_WARN("[AssetManager] Falling back to source assets; bundle unavailable: {}", bundlePath.string());
+        }
+
         initializeRegistry();
     }
 
     AssetManager::~AssetManager()
     {
+        {
+            auto lock = std::unique_lock{m_watchMutex};
+            m_sourceSweepDone.wait(lock, [this]() { return !m_sourceSweepRunning; });
+        }
+        {
+            auto lock = std::unique_lock{m_loadMutex};
+            for (auto const& request : m_inflightLoads)
+            {
+                request->cancel();
+            }
+            m_loadsDrained.wait(lock, [this]() { return m_inflightLoads.empty(); });
+            m_completedLoads.clear();
+        }
+
         saveRegistry();
         AP_INFO("[AssetManager] Shutdown.");
     }
@@ -144,8 +181,11 @@ namespace april::asset
 
         auto importerChain = appendImporterChain(parentImporterChain, importer->id(), importer->version());
 
+        // Lives for this import, so the meshes cooked below reuse the importer's parse.
+        auto sourceCache = ImportSourceCache{};
         auto context = ImportSourceContext{};
         context.sourcePath = sourcePath;
+        context.sourceCache = &sourceCache;
         context.importerChain = importerChain;
         context.importMaterials = config.importMaterials;
         context.importTextures = config.importTextures;
@@ -198,6 +238,18 @@ namespace april::asset
             assetsToSave.push_back(primaryAsset);
         }
 
+        // Multi-asset imports (one glTF -> meshes, materials, scene) share the source; hash it once.
+        auto sourceHashes = std::unordered_map<std::string, std::string>{};
+        auto hashSource = [&](std::string const& path) -> std::string const&
+        {
+            auto it = sourceHashes.find(path);
+            if (it == sourceHashes.end())
+            {
+                it = sourceHashes.emplace(path, hashFileContents(path)).first;
+            }
+            return it->second;
+        };
+
         for (auto const& asset : assetsToSave)
         {
             if (!asset)
@@ -251,13 +303,32 @@ namespace april::asset
                 record.sourcePath = asset->getSourcePath();
                 record.type = asset->getType();
 
-                record.lastSourceHash = hashFileContents(asset->getSourcePath());
+                record.lastSourceHash = hashSource(asset->getSourcePath());
 
                 m_registry.updateRecord(std::move(record));
                 m_registryDirty = true;
             }
         }
 
+        if (config.cookImportedMeshes)
+        {
+            auto meshes = std::vector<std::shared_ptr<Asset>>{};
+            std::ranges::copy_if(assetsToSave, std::back_inserter(meshes), [](auto const& asset)
+            {
+                return asset && asset->getType() == AssetType::Mesh;
+            });
+            core::ThreadPool::get().parallelFor(meshes.size(), 1, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    if (!ensureImported(*meshes[i], &sourceCache))
+                    {
+                        AP_WARN("[AssetManager] Cook after import failed: {}", meshes[i]->getAssetPath());
+                    }
+                }
+            });
+        }
+
         AP_INFO("[AssetManager] Imported asset: {} -> {} (UUID: {})",
             sourcePath.string(), primaryAsset->getAssetPath(), primaryAsset->getHandle().toString()
         );
@@ -271,68 +342,46 @@ namespace april::asset
     ) -> std::shared_ptr<Asset>
     {
         initializeRegistry();
-        auto assetPathFromIndex = std::optional<std::filesystem::path>{};
         auto handleFromIndex = std::optional<core::UUID>{};
-        auto normalizedPath = normalizePath(sourcePath);
+        auto const normalizedPath = normalizePath(sourcePath);
+        auto const typeIndex = static_cast<size_t>(type);
 
+        // Importers that emit several assets per source (materials, glTF meshes and scenes) key them by
+        // asset path, so both paths of every registered asset are indexed.
+        if (typeIndex < kAssetTypeCount && !normalizedPath.empty())
         {
-            auto const key = buildSourceKey(type, sourcePath);
             auto lock = std::scoped_lock{m_mutex};
-            if (auto it = m_sourcePathIndex.find(key); it != m_sourcePathIndex.end())
+            auto const& index = m_sourcePathIndex[typeIndex];
+            if (auto it = index.find(normalizedPath); it != index.end())
             {
                 auto const handle = it->second;
                 handleFromIndex = handle;
-                if (m_loadedAssets.contains(handle))
+                if (auto loaded = m_cache.find(handle))
                 {
-                    return m_loadedAssets.at(handle);
+                    return loaded;
                 }
             }
-
-            for (auto const& [uuid, asset] : m_loadedAssets)
-            {
-                if (asset->getType() != type)
-                {
-                    continue;
-                }
-
-                auto assetSourcePath = std::filesystem::path{asset->getSourcePath()};
-                if (!asset->getSourcePath().empty() && normalizePath(assetSourcePath) == normalizedPath)
-                {
-                    return asset;
-                }
-
-                if (type == AssetType::Material || type == AssetType::Texture)
-                {
-                    auto assetPath = std::filesystem::path{asset->getAssetPath()};
-                    if (!asset->getAssetPath().empty() && normalizePath(assetPath) == normalizedPath)
-                    {
-                        return asset;
-                    }
-                }
-            }
-        }
-
-        if (!assetPathFromIndex && handleFromIndex)
-        {
-            if (auto recordOpt = m_registry.findRecord(*handleFromIndex); recordOpt.has_value())
-            {
-                assetPathFromIndex = recordOpt->assetPath;
-            }
         }
 
-        if (assetPathFromIndex)
+        auto const recordedPath = handleFromIndex ? m_registry.findAssetPath(*handleFromIndex) : std::nullopt;
+        if (recordedPath)
         {
+            auto const assetPath = std::filesystem::path{*recordedPath};
             if (type == AssetType::Texture)
             {
-                return std::static_pointer_cast<Asset>(loadAssetFromFile<TextureAsset>(*assetPathFromIndex));
+                return std::static_pointer_cast<Asset>(loadAssetFromFile<TextureAsset>(assetPath));
             }
             if (type == AssetType::Material)
             {
-                return std::static_pointer_cast<Asset>(loadAssetFromFile<MaterialAsset>(*assetPathFromIndex));
+                return std::static_pointer_cast<Asset>(loadAssetFromFile<MaterialAsset>(assetPath));
             }
             if (type == AssetType::Mesh)
             {
-                return std::static_pointer_cast<Asset>(loadAssetFromFile<StaticMeshAsset>(*assetPathFromIndex));
+                return std::static_pointer_cast<Asset>(loadAssetFromFile<StaticMeshAsset>(assetPath));
+            }
+            if (type == AssetType::Scene)
+            {
+                return std::static_pointer_cast<Asset>(loadAssetFromFile<SceneAsset>(assetPath));
             }
         }
 
@@ -357,6 +406,10 @@ namespace april::asset
             {
                 return std::static_pointer_cast<Asset>(loadAssetFromFile<StaticMeshAsset>(assetFilePath));
             }
+            else if (type == AssetType::Scene)
+            {
+                return std::static_pointer_cast<Asset>(loadAssetFromFile<SceneAsset>(assetFilePath));
+            }
         }
 
         return nullptr;
@@ -364,12 +417,23 @@ namespace april::asset
 
     auto AssetManager::getTextureData(TextureAsset const& asset, std::vector<std::byte>& outBlob) -> TexturePayload
     {
+        if (m_bundle)
+        {
+            recordUsage(asset, AssetUsageKind::CookedData);
+            if (!readBundlePayload(asset, outBlob))
+            {
+                return {};
+            }
+            return parseTextureBlob(outBlob, asset.getAssetPath());
+        }
+
         auto key = ensureImported(asset);
         if (!key)
         {
             AP_ERROR("[AssetManager] Texture import failed: {}", asset.getSourcePath());
             return {};
         }
+        recordUsage(asset, AssetUsageKind::CookedData, *key);
 
         auto value = DdcValue{};
         if (!m_ddc.get(*key, value))
@@ -379,451 +443,1637 @@ namespace april::asset
         }
 
         outBlob = std::move(value.bytes);
+        return parseTextureBlob(outBlob, asset.getSourcePath());
+    }
+
+    auto AssetManager::getTextureMips(TextureAsset const& asset, uint32_t maxDimension, std::vector<std::byte>& outBlob) -> TexturePayload
+    {
+        auto const& name = m_bundle ? asset.getAssetPath() : asset.getSourcePath();
 
-        if (outBlob.size() < sizeof(TextureHeader))
+        auto key = std::optional<std::string>{std::string{}};
+        if (!m_bundle)
         {
-            AP_ERROR("[AssetManager] Invalid texture blob size for: {}", asset.getSourcePath());
-            return {};
+            key = resolveTextureKey(asset);
+            if (!key)
+            {
+                AP_ERROR("[AssetManager] Texture import failed: {}", asset.getSourcePath());
+                return {};
+            }
         }
+        recordUsage(asset, AssetUsageKind::CookedData, *key);
 
-        auto payload = TexturePayload{};
-
-        std::memcpy(&payload.header, outBlob.data(), sizeof(TextureHeader));
+        auto headerBytes = std::vector<std::byte>{};
+        if (!readCookedRange(asset, *key, 0, sizeof(TextureHeader), headerBytes))
+        {
+            return {};
+        }
 
-        if (!payload.header.isValid())
+        auto storedHeader = TextureHeader{};
+        std::memcpy(&storedHeader, headerBytes.data(), sizeof(TextureHeader));
+        if (!storedHeader.isValid())
         {
-            AP_ERROR("[AssetManager] Invalid texture header for: {}", asset.getSourcePath());
+            AP_ERROR("[AssetManager] Invalid texture header for: {}", name);
             return {};
         }
 
-        auto const pixelDataOffset = sizeof(TextureHeader);
-        auto const pixelDataSize = outBlob.size() - pixelDataOffset;
+        auto const firstMip = getFirstMipWithin(storedHeader, maxDimension);
+        auto const chainSize = getMipChainSize(storedHeader, firstMip);
+        if (firstMip == 0 || chainSize == 0 || chainSize > storedHeader.dataSize)
+        {
+            return getTextureData(asset, outBlob);
+        }
 
-        if (pixelDataSize != payload.header.dataSize)
+        auto header = storedHeader;
+        header.width = std::max(storedHeader.width >> firstMip, 1u);
+        header.height = std::max(storedHeader.height >> firstMip, 1u);
+        header.mipLevels = storedHeader.mipLevels - firstMip;
+        header.dataSize = chainSize;
+
+        // Mips are stored largest first, so the requested chain is the tail of the pixel data.
+        auto pixels = std::vector<std::byte>{};
+        auto const offset = sizeof(TextureHeader) + (storedHeader.dataSize - chainSize);
+        if (!readCookedRange(asset, *key, offset, chainSize, pixels))
         {
-            AP_WARN("[AssetManager] Texture data size mismatch: expected {}, got {}",
-                    payload.header.dataSize, pixelDataSize);
+            return {};
         }
 
-        payload.pixelData = std::span<std::byte const>{
-            outBlob.data() + pixelDataOffset,
-            static_cast<size_t>(payload.header.dataSize)
-        };
+        outBlob.resize(sizeof(TextureHeader) + pixels.size());
+        std::memcpy(outBlob.data(), &header, sizeof(TextureHeader));
+        std::memcpy(outBlob.data() + sizeof(TextureHeader), pixels.data(), pixels.size());
 
+        auto payload = parseTextureBlob(outBlob, name);
+        payload.firstMip = firstMip;
+        payload.storedHeader = storedHeader;
         return payload;
     }
 
-    auto AssetManager::getMeshData(StaticMeshAsset const& asset, std::vector<std::byte>& outBlob) -> MeshPayload
+    auto AssetManager::resolveTextureKey(TextureAsset const& asset) -> std::optional<std::string>
     {
-        auto key = ensureImported(asset);
-        if (!key)
+        // The key only changes with the source, the settings or a dirty dependency; a stat and a settings
+        // compare are enough to reuse it, where ensureImported would hash the whole source again.
+        auto const settings = nlohmann::json(asset.m_settings);
+        auto const sourceStamp = asset.getSourcePath().empty()
+            ? std::optional<AssetFileStamp>{}
+            : AssetDirectoryIndex::stat(asset.getSourcePath());
+        if (sourceStamp)
         {
-            AP_ERROR("[AssetManager] Mesh import failed: {}", asset.getSourcePath());
-            return {};
+            auto lock = std::scoped_lock{m_mutex};
+            auto const it = m_resolvedTextureKeys.find(asset.getHandle());
+            if (it != m_resolvedTextureKeys.end() && !m_dirtyAssets.contains(asset.getHandle()) &&
+                it->second.sourceStamp.matches(*sourceStamp) && it->second.settings == settings)
+            {
+                return it->second.ddcKey;
+            }
         }
 
-        auto value = DdcValue{};
-        if (!m_ddc.get(*key, value))
+        // Stamped before the cook, so a source saved while it runs is picked up on the next read.
+        auto key = ensureImported(asset);
+        if (key && sourceStamp)
         {
-            AP_ERROR("[AssetManager] Missing mesh DDC data for: {}", asset.getSourcePath());
-            return {};
+            auto lock = std::scoped_lock{m_mutex};
+            m_resolvedTextureKeys[asset.getHandle()] = ResolvedTextureKey{*key, settings, *sourceStamp};
         }
+        return key;
+    }
 
-        outBlob = std::move(value.bytes);
+    auto AssetManager::getCookedContentHash(core::UUID const& handle) -> std::optional<std::string>
+    {
+        if (m_bundle)
+        {
+            return std::nullopt;
+        }
 
-        if (outBlob.size() < sizeof(MeshHeader))
+        auto const record = m_registry.findRecord(handle);
+        if (!record)
         {
-            AP_ERROR("[AssetManager] Invalid mesh blob size for: {}", asset.getSourcePath());
-            return {};
+            return std::nullopt;
         }
 
-        auto payload = MeshPayload{};
+        auto const keys = record->ddcKeys.find(m_targetProfile.toId());
+        if (keys == record->ddcKeys.end() || keys->second.empty())
+        {
+            return std::nullopt;
+        }
+        return m_ddc.getContentHash(keys->second.front());
+    }
 
-        std::memcpy(&payload.header, outBlob.data(), sizeof(MeshHeader));
+    auto AssetManager::prefetchUsage(AssetUsageManifest const& manifest) -> size_t
+    {
+        if (!m_bundle)
+        {
+            initializeRegistry();
+        }
 
-        if (!payload.header.isValid())
+        auto queued = size_t{0};
+        for (auto const& entry : manifest.entries)
         {
-            AP_ERROR("[AssetManager] Invalid mesh header for: {}", asset.getSourcePath());
-            return {};
+            auto assetPath = std::filesystem::path{};
+            if (m_bundle)
+            {
+                auto const* bundled = m_bundle->find(entry.guid);
+                if (!bundled)
+                {
+                    continue;
+                }
+                assetPath = m_bundle->getPath(*bundled);
+            }
+            else
+            {
+                auto recordedPath = m_registry.findAssetPath(entry.guid);
+                if (!recordedPath)
+                {
+                    continue;
+                }
+                assetPath = std::move(*recordedPath);
+            }
+
+            // Queued in recorded order behind everything the session asks for itself.
+            auto request = std::make_shared<AssetLoadRequest>(assetPath, LoadPriority::Low);
+            request->m_prefetchPayload = false;
+            enqueueLoad(request, [this, entry]() -> std::shared_ptr<Asset>
+            {
+                t_prefetchingUsage = true;
+                auto asset = loadAssetByGuid(entry.guid);
+                if (asset && entry.kind == AssetUsageKind::CookedData)
+                {
+                    prefetchCookedData(*asset, entry.ddcKey);
+                }
+                t_prefetchingUsage = false;
+                return asset;
+            });
+            ++queued;
         }
 
-        auto offset = sizeof(MeshHeader);
+        AP_INFO("[AssetManager] Prefetching {} of {} recorded asset uses", queued, manifest.entries.size());
+        return queued;
+    }
 
-        auto const submeshDataSize = payload.header.submeshCount * sizeof(Submesh);
-        if (offset + submeshDataSize > outBlob.size())
+    auto AssetManager::recordUsage(Asset const& asset, AssetUsageKind kind, std::string const& ddcKey) -> void
+    {
+        if (!t_prefetchingUsage)
         {
-            AP_ERROR("[AssetManager] Invalid mesh submesh data for: {}", asset.getSourcePath());
-            return {};
+            m_usageRecorder.record(asset.getHandle(), asset.getType(), kind, ddcKey);
         }
+    }
 
-        payload.submeshes = std::span<Submesh const>{
-            reinterpret_cast<Submesh const*>(outBlob.data() + offset),
-            payload.header.submeshCount
-        };
-        offset += submeshDataSize;
-
-        if (offset + payload.header.vertexDataSize > outBlob.size())
+    auto AssetManager::prefetchCookedData(Asset const& asset, std::string const& ddcKey) -> void
+    {
+        if (m_bundle)
         {
-            AP_ERROR("[AssetManager] Invalid mesh vertex data for: {}", asset.getSourcePath());
-            return {};
+            if (auto const* entry = m_bundle->find(asset.getHandle()))
+            {
+                m_bundle->prefetchPayload(*entry);
+            }
+            return;
         }
 
-        payload.vertexData = std::span<std::byte const>{
-            outBlob.data() + offset,
-            static_cast<size_t>(payload.header.vertexDataSize)
-        };
-        offset += payload.header.vertexDataSize;
+        // The registry holds the key of the latest cook. A recorded key that differs predates a source or settings
+        // change, and LocalDdc keeps old keys around, so existence alone can't tell it is stale. Cooking now
+        // saves the session the wait.
+        auto currentKey = std::optional<std::string>{};
+        if (auto const record = m_registry.findRecord(asset.getHandle()))
+        {
+            if (auto const keys = record->ddcKeys.find(m_targetProfile.toId()); keys != record->ddcKeys.end() && !keys->second.empty())
+            {
+                currentKey = keys->second.front();
+            }
+        }
+        if (currentKey && (ddcKey.empty() || ddcKey == *currentKey) && m_ddc.prefetch(*currentKey))
+        {
+            return;
+        }
 
-        if (offset + payload.header.indexDataSize > outBlob.size())
+        auto const type = asset.getType();
+        if (type != AssetType::Texture && type != AssetType::Mesh && type != AssetType::Material)
         {
-            AP_ERROR("[AssetManager] Invalid mesh index data for: {}", asset.getSourcePath());
-            return {};
+            return;
         }
 
-        payload.indexData = std::span<std::byte const>{
-            outBlob.data() + offset,
-            static_cast<size_t>(payload.header.indexDataSize)
-        };
+        if (auto key = ensureImported(asset))
+        {
+            m_ddc.prefetch(*key);
+        }
+    }
 
-        return payload;
+    auto AssetManager::getMeshData(StaticMeshAsset const& asset, std::vector<std::byte>& outBlob) -> MeshPayload
+    {
+        auto const& name = m_bundle ? asset.getAssetPath() : asset.getSourcePath();
+        if (!readMeshBlob(asset, outBlob) || !decodeMeshBlob(outBlob, name))
+        {
+            return {};
+        }
+        return parseMeshBlob(outBlob, name);
     }
 
-    auto AssetManager::saveMaterialAsset(std::shared_ptr<MaterialAsset> const& material, std::filesystem::path const& outputPath) -> bool
+    auto AssetManager::readMeshBlob(StaticMeshAsset const& asset, std::vector<std::byte>& outBlob) -> bool
     {
-        if (!material)
+        if (m_bundle)
         {
-            AP_ERROR("[AssetManager] Cannot save null material asset");
+            recordUsage(asset, AssetUsageKind::CookedData);
+            return readBundlePayload(asset, outBlob);
+        }
+
+        auto key = ensureImported(asset);
+        if (!key)
+        {
+            AP_ERROR("[AssetManager] Mesh import failed: {}", asset.getSourcePath());
             return false;
         }
+        recordUsage(asset, AssetUsageKind::CookedData, *key);
 
-        return saveAssetFile(material, outputPath);
+        auto value = DdcValue{};
+        if (!m_ddc.get(*key, value))
+        {
+            AP_ERROR("[AssetManager] Missing mesh DDC data for: {}", asset.getSourcePath());
+            return false;
+        }
+
+        outBlob = std::move(value.bytes);
+        return true;
     }
 
-    auto AssetManager::saveAssetFile(
-        std::shared_ptr<Asset> const& asset,
-        std::filesystem::path const& assetPath
-    ) -> bool
+    auto AssetManager::decodeMeshBlob(std::vector<std::byte>& blob, std::string const& name) -> bool
     {
-        if (!asset)
+        auto constexpr kEncodedFlags = MeshStorageFlags::EncodedVertexData | MeshStorageFlags::EncodedIndexData;
+
+        auto header = MeshHeader{};
+        if (blob.size() < sizeof(MeshHeader))
         {
-            AP_ERROR("[AssetManager] Cannot save null asset");
+            AP_ERROR("[AssetManager] Invalid mesh blob size for: {}", name);
             return false;
         }
-
-        if (assetPath.empty())
+        std::memcpy(&header, blob.data(), sizeof(MeshHeader));
+        if ((header.flags & kEncodedFlags) == 0)
         {
-            AP_ERROR("[AssetManager] Cannot save asset with empty path");
+            return true;
+        }
+        if (!header.isValid() || header.vertexStride == 0)
+        {
+            AP_ERROR("[AssetManager] Invalid mesh header for: {}", name);
             return false;
         }
 
-        asset->setAssetPath(assetPath.string());
-
-        auto json = nlohmann::json{};
-        asset->serializeJson(json);
+        auto const alignOffset = [](size_t offset) { return (offset + 3) & ~size_t{3}; };
+        auto const lodCount = std::max(header.lodCount, 1u);
+        auto const prefixSize = sizeof(MeshHeader) + header.submeshCount * sizeof(Submesh) +
+                                static_cast<size_t>(header.submeshCount) * (lodCount - 1) * sizeof(SubmeshLod);
 
-        if (!VFS::writeTextFile(assetPath.string(), json.dump(4)))
+        auto const vertexOffset = prefixSize;
+        auto const vertexSize = static_cast<size_t>(header.vertexDataSize);
+        auto const indexOffset = (header.flags & MeshStorageFlags::EncodedVertexData)
+            ? alignOffset(vertexOffset + vertexSize) : vertexOffset + vertexSize;
+        auto const indexSize = static_cast<size_t>(header.indexDataSize);
+        auto const meshletOffset = alignOffset(indexOffset + indexSize);
+        if (meshletOffset + header.meshletSectionSize > blob.size())
         {
-            AP_ERROR("[AssetManager] Failed to write asset file: {}", assetPath.string());
+            AP_ERROR("[AssetManager] Truncated encoded mesh blob for: {}", name);
             return false;
         }
 
-        registerAssetInternal(asset, assetPath, true);
+        auto const indexElementSize = header.indexFormat == 0 ? sizeof(uint16_t) : sizeof(uint32_t);
+        auto const decodedVertexSize = static_cast<size_t>(header.vertexCount) * header.vertexStride;
+        auto const decodedIndexSize = alignOffset(static_cast<size_t>(header.indexCount) * indexElementSize);
 
-        AP_INFO("[AssetManager] Saved asset: {} (UUID: {})",
-            assetPath.string(), asset->getHandle().toString());
-        return true;
-    }
+        auto decoded = std::vector<std::byte>(prefixSize + decodedVertexSize + decodedIndexSize + header.meshletSectionSize);
+        std::memcpy(decoded.data(), blob.data(), prefixSize);
 
-    auto AssetManager::registerAssetPath(core::UUID handle, std::filesystem::path const& path) -> void
-    {
-        auto asset = loadAssetMetadata(path);
-        if (asset)
+        auto* pVertices = decoded.data() + prefixSize;
+        if (header.flags & MeshStorageFlags::EncodedVertexData)
         {
-            if (asset->getHandle() != handle)
+            auto const result = meshopt_decodeVertexBuffer(
+                pVertices,
+                header.vertexCount,
+                header.vertexStride,
+                reinterpret_cast<unsigned char const*>(blob.data() + vertexOffset),
+                vertexSize
+            );
+            if (result != 0)
             {
-                AP_WARN("[AssetManager] Asset UUID mismatch for {}: expected {}, got {}",
-                    path.string(), handle.toString(), asset->getHandle().toString());
+                AP_ERROR("[AssetManager] Failed to decode mesh vertices ({}) for: {}", result, name);
+                return false;
             }
-            registerAssetInternal(asset, path, false);
         }
-
-        AP_INFO("[AssetManager] Registered asset: {} -> {}", handle.toString(), path.string());
-    }
-
-    auto AssetManager::scanDirectory(std::filesystem::path const& directory) -> size_t
-    {
-        auto count = size_t{0};
-
-        if (!VFS::existsDirectory(directory.string()))
+        else if (vertexSize == decodedVertexSize)
         {
-            AP_WARN("[AssetManager] Directory does not exist: {}", directory.string());
-            return count;
+            std::memcpy(pVertices, blob.data() + vertexOffset, vertexSize);
+        }
+        else
+        {
+            AP_ERROR("[AssetManager] Invalid mesh vertex data for: {}", name);
+            return false;
         }
 
-        auto assetFiles = VFS::listFilesRecursive(directory.string(), ".asset");
-        for (auto const& assetPath : assetFiles)
+        auto* pIndices = decoded.data() + prefixSize + decodedVertexSize;
+        if (header.flags & MeshStorageFlags::EncodedIndexData)
         {
-            auto assetFilePath = std::filesystem::path{assetPath};
-            auto asset = loadAssetMetadata(assetFilePath);
-            if (asset)
+            auto const result = meshopt_decodeIndexBuffer(
+                pIndices,
+                header.indexCount,
+                indexElementSize,
+                reinterpret_cast<unsigned char const*>(blob.data() + indexOffset),
+                indexSize
+            );
+            if (result != 0)
             {
-                if (auto recordOpt = m_registry.findRecord(asset->getHandle()); recordOpt.has_value())
-                {
-                    auto recordedPath = normalizePath(recordOpt->assetPath);
-                    auto currentPath = normalizePath(assetFilePath);
-                    if (recordedPath == currentPath)
-                    {
-                        continue;
-                    }
-                }
-
-                registerAssetInternal(asset, assetFilePath, false);
-                ++count;
+                AP_ERROR("[AssetManager] Failed to decode mesh indices ({}) for: {}", result, name);
+                return false;
             }
         }
+        else if (indexSize == decodedIndexSize)
+        {
+            std::memcpy(pIndices, blob.data() + indexOffset, indexSize);
+        }
+        else
+        {
+            AP_ERROR("[AssetManager] Invalid mesh index data for: {}", name);
+            return false;
+        }
 
-        AP_INFO("[AssetManager] Scanned directory '{}': found {} assets", directory.string(), count);
-        return count;
-    }
+        std::memcpy(pIndices + decodedIndexSize, blob.data() + meshletOffset, header.meshletSectionSize);
 
-    auto AssetManager::getDdc() -> LocalDdc&
-    {
-        return m_ddc;
+        header.flags &= ~static_cast<uint32_t>(kEncodedFlags);
+        header.vertexDataSize = decodedVertexSize;
+        header.indexDataSize = decodedIndexSize;
+        std::memcpy(decoded.data(), &header, sizeof(MeshHeader));
+
+        blob = std::move(decoded);
+        return true;
+    }
+
+    auto AssetManager::parseTextureBlob(std::span<std::byte const> blob, std::string const& name) -> TexturePayload
+    {
+        if (blob.size() < sizeof(TextureHeader))
+        {
+            AP_ERROR("[AssetManager] Invalid texture blob size for: {}", name);
+            return {};
+        }
+
+        auto payload = TexturePayload{};
+
+        std::memcpy(&payload.header, blob.data(), sizeof(TextureHeader));
+        payload.storedHeader = payload.header;
+
+        if (!payload.header.isValid())
+        {
+            AP_ERROR("[AssetManager] Invalid texture header for: {}", name);
+            return {};
+        }
+
+        auto const pixelDataOffset = sizeof(TextureHeader);
+        auto const pixelDataSize = blob.size() - pixelDataOffset;
+
+        if (pixelDataSize != payload.header.dataSize)
+        {
+            AP_WARN("[AssetManager] Texture data size mismatch: expected {}, got {}",
+                    payload.header.dataSize, pixelDataSize);
+        }
+
+        payload.pixelData = std::span<std::byte const>{
+            blob.data() + pixelDataOffset,
+            static_cast<size_t>(payload.header.dataSize)
+        };
+
+        return payload;
+    }
+
+    auto AssetManager::parseMeshBlob(std::span<std::byte const> blob, std::string const& name) -> MeshPayload
+    {
+        if (blob.size() < sizeof(MeshHeader))
+        {
+            AP_ERROR("[AssetManager] Invalid mesh blob size for: {}", name);
+            return {};
+        }
+
+        auto payload = MeshPayload{};
+
+        std::memcpy(&payload.header, blob.data(), sizeof(MeshHeader));
+
+        if (!payload.header.isValid())
+        {
+            AP_ERROR("[AssetManager] Invalid mesh header for: {}", name);
+            return {};
+        }
+
+        if (payload.header.flags & (MeshStorageFlags::EncodedVertexData | MeshStorageFlags::EncodedIndexData))
+        {
+            AP_ERROR("[AssetManager] Mesh blob is still encoded: {}", name);
+            return {};
+        }
+
+        auto offset = sizeof(MeshHeader);
+
+        auto const submeshDataSize = payload.header.submeshCount * sizeof(Submesh);
+        if (offset + submeshDataSize > blob.size())
+        {
+            AP_ERROR("[AssetManager] Invalid mesh submesh data for: {}", name);
+            return {};
+        }
+
+        payload.submeshes = std::span<Submesh const>{
+            reinterpret_cast<Submesh const*>(blob.data() + offset),
+            payload.header.submeshCount
+        };
+        offset += submeshDataSize;
+
+        auto const lodCount = std::max(payload.header.lodCount, 1u);
+        auto const lodDataSize = static_cast<size_t>(payload.header.submeshCount) * (lodCount - 1) * sizeof(SubmeshLod);
+        if (offset + lodDataSize > blob.size())
+        {
+            AP_ERROR("[AssetManager] Invalid mesh LOD data for: {}", name);
+            return {};
+        }
+
+        payload.lods = std::span<SubmeshLod const>{
+            reinterpret_cast<SubmeshLod const*>(blob.data() + offset),
+            lodDataSize / sizeof(SubmeshLod)
+        };
+        payload.header.lodCount = lodCount;
+        offset += lodDataSize;
+
+        if (offset + payload.header.vertexDataSize > blob.size())
+        {
+            AP_ERROR("[AssetManager] Invalid mesh vertex data for: {}", name);
+            return {};
+        }
+
+        payload.vertexData = std::span<std::byte const>{
+            blob.data() + offset,
+            static_cast<size_t>(payload.header.vertexDataSize)
+        };
+        offset += payload.header.vertexDataSize;
+
+        if (offset + payload.header.indexDataSize > blob.size())
+        {
+            AP_ERROR("[AssetManager] Invalid mesh index data for: {}", name);
+            return {};
+        }
+
+        payload.indexData = std::span<std::byte const>{
+            blob.data() + offset,
+            static_cast<size_t>(payload.header.indexDataSize)
+        };
+        offset += payload.header.indexDataSize;
+
+        if (payload.header.meshletSectionSize > 0)
+        {
+            // Meshlets are optional; a bad section drops them but keeps the mesh drawable.
+            auto section = MeshletSectionHeader{};
+            auto const sectionEnd = offset + payload.header.meshletSectionSize;
+            if (sectionEnd > blob.size() || payload.header.meshletSectionSize < sizeof(MeshletSectionHeader))
+            {
+                AP_WARN("[AssetManager] Truncated meshlet section for: {}", name);
+                return payload;
+            }
+
+            std::memcpy(&section, blob.data() + offset, sizeof(MeshletSectionHeader));
+            auto const meshletsSize = static_cast<size_t>(section.meshletCount) * sizeof(Meshlet);
+            auto const verticesSize = static_cast<size_t>(section.vertexCount) * sizeof(uint32_t);
+            if (!section.isValid() ||
+                sizeof(MeshletSectionHeader) + meshletsSize + verticesSize + section.triangleByteCount > payload.header.meshletSectionSize)
+            {
+                AP_WARN("[AssetManager] Unsupported meshlet section (version {}) for: {}", section.version, name);
+                return payload;
+            }
+
+            offset += sizeof(MeshletSectionHeader);
+            payload.meshlets = std::span<Meshlet const>{
+                reinterpret_cast<Meshlet const*>(blob.data() + offset),
+                section.meshletCount
+            };
+            offset += meshletsSize;
+            payload.meshletVertices = std::span<uint32_t const>{
+                reinterpret_cast<uint32_t const*>(blob.data() + offset),
+                section.vertexCount
+            };
+            offset += verticesSize;
+            payload.meshletTriangles = std::span<uint8_t const>{
+                reinterpret_cast<uint8_t const*>(blob.data() + offset),
+                section.triangleByteCount
+            };
+        }
+
+        return payload;
+    }
+
+    auto AssetManager::enqueueLoad(AssetLoadHandle const& request, std::function<std::shared_ptr<Asset>()> loader) -> void
+    {
+        {
+            auto lock = std::scoped_lock{m_loadMutex};
+            m_inflightLoads.push_back(request);
+        }
+
+        core::ThreadPool::get().submit([this, request, loader = std::move(loader)]()
+        {
+            runLoad(request, loader);
+        }, request->getPriority());
+    }
+
+    auto AssetManager::runLoad(AssetLoadHandle const& request, std::function<std::shared_ptr<Asset>()> const& loader) -> void
+    {
+        APRIL_PROFILE_ZONE("AssetManager::runLoad");
+
+        auto state = LoadState::Cancelled;
+        if (!request->isCancelled())
+        {
+            request->m_state.store(LoadState::Loading);
+            state = LoadState::Failed;
+
+            if (auto asset = loader(); asset)
+            {
+                request->m_asset = asset;
+                state = LoadState::Ready;
+
+                auto const prefetch = request->m_prefetchPayload && !request->isCancelled();
+                if (asset->getType() == AssetType::Texture && prefetch)
+                {
+                    auto const& texture = static_cast<TextureAsset const&>(*asset);
+                    request->m_texturePayload = request->m_textureMaxDimension == std::numeric_limits<uint32_t>::max()
+                        ? getTextureData(texture, request->m_cookedBlob)
+                        : getTextureMips(texture, request->m_textureMaxDimension, request->m_cookedBlob);
+                    if (request->m_texturePayload.pixelData.empty())
+                    {
+                        state = LoadState::Failed;
+                    }
+                }
+                else if (asset->getType() == AssetType::Mesh && prefetch)
+                {
+                    auto const& mesh = static_cast<StaticMeshAsset const&>(*asset);
+                    request->m_meshPayload = getMeshData(mesh, request->m_cookedBlob);
+                    if (request->m_meshPayload.vertexData.empty())
+                    {
+                        state = LoadState::Failed;
+                    }
+                }
+
+                if (prefetch && state == LoadState::Ready && !m_bundle &&
+                    (asset->getType() == AssetType::Texture || asset->getType() == AssetType::Mesh))
+                {
+                    request->m_contentHash = getCookedContentHash(asset->getHandle()).value_or(std::string{});
+                }
+            }
+
+            if (request->isCancelled())
+            {
+                state = LoadState::Cancelled;
+            }
+        }
+
+        if (state == LoadState::Failed)
+        {
+            AP_ERROR("[AssetManager] Async load failed: {}", request->getAssetPath().string());
+        }
+
+        // Publish the final state together with the queue entry so a waiter that observes
+        // completion always finds the request in processCompletedLoads.
+        // The manager may be destroyed as soon as the lock is released, so notify while holding it.
+        {
+            auto lock = std::scoped_lock{m_loadMutex};
+            request->m_state.store(state);
+            std::erase(m_inflightLoads, request);
+            m_completedLoads.push_back(request);
+            m_loadsDrained.notify_all();
+        }
+        request->notifyDone();
+    }
+
+    auto AssetManager::getTextureMipsAsync(
+        core::UUID handle,
+        uint32_t maxDimension,
+        LoadPriority priority,
+        AssetLoadRequest::Callback onComplete
+    ) -> AssetLoadHandle
+    {
+        auto assetPath = std::filesystem::path{};
+        if (!m_bundle)
+        {
+            auto recordedPath = m_registry.findAssetPath(handle);
+            if (!recordedPath.has_value())
+            {
+                AP_ERROR("[AssetManager] Asset UUID not found in registry: {}", handle.toString());
+                return nullptr;
+            }
+            assetPath = std::move(*recordedPath);
+        }
+
+        auto request = std::make_shared<AssetLoadRequest>(assetPath, priority);
+        request->m_onComplete = std::move(onComplete);
+        request->m_textureMaxDimension = maxDimension;
+        enqueueLoad(request, [this, handle]() -> std::shared_ptr<Asset>
+        {
+            return std::static_pointer_cast<Asset>(getAsset<TextureAsset>(handle));
+        });
+        return request;
+    }
+
+    auto AssetManager::processCompletedLoads(size_t maxCount) -> size_t
+    {
+        auto completed = std::vector<AssetLoadHandle>{};
+        {
+            auto lock = std::scoped_lock{m_loadMutex};
+            auto const count = std::min(maxCount, m_completedLoads.size());
+            completed.assign(m_completedLoads.begin(), m_completedLoads.begin() + static_cast<std::ptrdiff_t>(count));
+            m_completedLoads.erase(m_completedLoads.begin(), m_completedLoads.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+
+        for (auto const& request : completed)
+        {
+            if (request->isCancelled() || !request->m_onComplete)
+            {
+                continue;
+            }
+
+            request->m_onComplete(*request);
+        }
+
+        // Called once per frame; assets released since the last call become evictable here.
+        m_cache.trim();
+        return completed.size();
+    }
+
+    auto AssetManager::getPendingLoadCount() const -> size_t
+    {
+        auto lock = std::scoped_lock{m_loadMutex};
+        return m_inflightLoads.size();
+    }
+
+    auto AssetManager::saveMaterialAsset(std::shared_ptr<MaterialAsset> const& material, std::filesystem::path const& outputPath) -> bool
+    {
+        if (!material)
+        {
+            AP_ERROR("[AssetManager] Cannot save null material asset");
+            return false;
+        }
+
+        return saveAssetFile(material, outputPath);
+    }
+
+    auto AssetManager::saveAssetFile(
+        std::shared_ptr<Asset> const& asset,
+        std::filesystem::path const& assetPath
+    ) -> bool
+    {
+        if (!asset)
+        {
+            AP_ERROR("[AssetManager] Cannot save null asset");
+            return false;
+        }
+
+        if (assetPath.empty())
+        {
+            AP_ERROR("[AssetManager] Cannot save asset with empty path");
+            return false;
+        }
+
+        asset->setAssetPath(assetPath.string());
+
+        auto json = nlohmann::json{};
+        asset->serializeJson(json);
+
+        if (!VFS::writeTextFile(assetPath.string(), json.dump(4)))
+        {
+            AP_ERROR("[AssetManager] Failed to write asset file: {}", assetPath.string());
+            return false;
+        }
+
+        registerAssetInternal(asset, assetPath, true);
+
+        AP_INFO("[AssetManager] Saved asset: {} (UUID: {})",
+            assetPath.string(), asset->getHandle().toString());
+        return true;
+    }
+
+    auto AssetManager::registerAssetPath(core::UUID handle, std::filesystem::path const& path) -> void
+    {
+        auto asset = loadAssetMetadata(path);
+        if (asset)
+        {
+            if (asset->getHandle() != handle)
+            {
+                AP_WARN("[AssetManager] Asset UUID mismatch for {}: expected {}, got {}",
+                    path.string(), handle.toString(), asset->getHandle().toString());
+            }
+            registerAssetInternal(asset, path, false);
+        }
+
+        AP_INFO("[AssetManager] Registered asset: {} -> {}", handle.toString(), path.string());
+    }
+
+    auto AssetManager::scanDirectory(std::filesystem::path const& directory) -> size_t
+    {
+        APRIL_PROFILE_ZONE("AssetManager::scanDirectory");
+        auto const start = core::Timer::now();
+        auto count = size_t{0};
+
+        if (!VFS::existsDirectory(directory.string()))
+        {
+            AP_WARN("[AssetManager] Directory does not exist: {}", directory.string());
+            return count;
+        }
+
+        // Guards the directory index.
+        auto lock = std::scoped_lock{m_registryStateMutex};
+
+        struct ScannedFile
+        {
+            std::string normalizedPath{};
+            std::optional<AssetFileStamp> stamp{};
+            std::shared_ptr<Asset> asset{};
+            bool unchanged{false};
+        };
+
+        // Files whose stamp matches the index and whose GUID the registry still maps here are not reopened;
+        // the rest are parsed in parallel.
+        auto const assetFiles = VFS::listFilesRecursive(directory.string(), ".asset");
+        auto files = std::vector<ScannedFile>(assetFiles.size());
+        core::ThreadPool::get().parallelFor(assetFiles.size(), 16, [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                auto const assetFilePath = std::filesystem::path{assetFiles[i]};
+                auto& file = files[i];
+                file.normalizedPath = normalizePath(assetFilePath);
+                file.stamp = AssetDirectoryIndex::stat(assetFilePath);
+
+                auto const* indexed = m_directoryIndex.find(file.normalizedPath);
+                if (file.stamp && indexed && indexed->matches(*file.stamp))
+                {
+                    auto const recordedPath = m_registry.findAssetPath(indexed->guid);
+                    if (recordedPath && normalizePath(*recordedPath) == file.normalizedPath)
+                    {
+                        file.unchanged = true;
+                        continue;
+                    }
+                }
+
+                file.asset = loadAssetMetadata(assetFilePath);
+            }
+        });
+
+        auto seenPaths = std::unordered_set<std::string>{};
+        seenPaths.reserve(files.size());
+        auto parsed = size_t{0};
+        for (size_t i = 0; i < files.size(); ++i)
+        {
+            auto& file = files[i];
+            seenPaths.insert(file.normalizedPath);
+            if (file.unchanged || !file.asset)
+            {
+                continue;
+            }
+
+            ++parsed;
+            auto const& asset = file.asset;
+            if (file.stamp)
+            {
+                file.stamp->guid = asset->getHandle();
+                file.stamp->type = asset->getType();
+                m_directoryIndex.update(file.normalizedPath, *file.stamp);
+            }
+
+            if (auto recordedAssetPath = m_registry.findAssetPath(asset->getHandle()); recordedAssetPath.has_value())
+            {
+                if (normalizePath(*recordedAssetPath) == file.normalizedPath)
+                {
+                    continue;
+                }
+            }
+
+            registerAssetInternal(asset, std::filesystem::path{assetFiles[i]}, false);
+            ++count;
+        }
+
+        auto directoryPrefix = normalizePath(directory);
+        if (!directoryPrefix.empty() && directoryPrefix.back() != std::filesystem::path::preferred_separator)
+        {
+            directoryPrefix += std::filesystem::path::preferred_separator;
+        }
+        m_directoryIndex.retain(directoryPrefix, seenPaths);
+        if (m_directoryIndex.isDirty() && !m_directoryIndexPath.empty())
+        {
+            m_directoryIndex.save(m_directoryIndexPath);
+        }
+
+        AP_INFO("[AssetManager] Scanned directory '{}': found {} assets ({} files, {} parsed) in {:.2f} ms",
+            directory.string(), count, files.size(), parsed, core::Timer::calcDuration(start, core::Timer::now()));
+        return count;
+    }
+
+    auto AssetManager::getDdc() -> LocalDdc&
+    {
+        return m_ddc;
     }
 
     auto AssetManager::registerAssetInternal(
         std::shared_ptr<Asset> const& asset,
         std::filesystem::path const& assetPath,
-        bool cacheAsset
-    ) -> void
+        bool cacheAsset
+    ) -> void
+    {
+        if (!asset)
+        {
+            return;
+        }
+
+        auto const handle = asset->getHandle();
+        auto const sourcePath = normalizePath(asset->getSourcePath());
+        auto const indexedAssetPath = normalizePath(asset->getAssetPath());
+        {
+            auto lock = std::scoped_lock{m_mutex};
+            if (cacheAsset)
+            {
+                m_cache.insert(asset);
+            }
+            indexPathsLocked(*asset, sourcePath, indexedAssetPath);
+        }
+        m_registry.registerAsset(*asset, assetPath.string());
+        m_registryDirty = true;
+
+        if (cacheAsset)
+        {
+            recordUsage(*asset, AssetUsageKind::Metadata);
+        }
+        if (cacheAsset && !m_bundle)
+        {
+            watchAsset(*asset, assetPath);
+        }
+    }
+
+    auto AssetManager::loadAssetByGuid(core::UUID const& guid) -> std::shared_ptr<Asset>
+    {
+        if (guid.getNative().is_nil())
+        {
+            return nullptr;
+        }
+
+        if (m_bundle)
+        {
+            return loadAssetFromBundle(guid);
+        }
+
+        initializeRegistry();
+        if (auto cached = m_cache.find(guid))
+        {
+            recordUsage(*cached, AssetUsageKind::Metadata);
+            return cached;
+        }
+
+        auto recordOpt = m_registry.findRecord(guid);
+        if (!recordOpt.has_value())
+        {
+            AP_WARN("[AssetManager] Asset UUID not found in registry: {}", guid.toString());
+            return nullptr;
+        }
+
+        auto const& record = *recordOpt;
+        if (record.assetPath.empty())
+        {
+            AP_WARN("[AssetManager] Asset record missing path for UUID: {}", guid.toString());
+            return nullptr;
+        }
+
+        if (record.type == AssetType::Texture)
+        {
+            return std::static_pointer_cast<Asset>(loadAssetFromFile<TextureAsset>(record.assetPath));
+        }
+        if (record.type == AssetType::Material)
+        {
+            return std::static_pointer_cast<Asset>(loadAssetFromFile<MaterialAsset>(record.assetPath));
+        }
+        if (record.type == AssetType::Mesh)
+        {
+            return std::static_pointer_cast<Asset>(loadAssetFromFile<StaticMeshAsset>(record.assetPath));
+        }
+        if (record.type == AssetType::Scene)
+        {
+            return std::static_pointer_cast<Asset>(loadAssetFromFile<SceneAsset>(record.assetPath));
+        }
+
+        AP_WARN("[AssetManager] Unsupported asset type for UUID {}: {}", guid.toString(), static_cast<int>(record.type));
+        return nullptr;
+    }
+
+    auto AssetManager::initializeRegistry() -> void
+    {
+        auto lock = std::scoped_lock{m_registryStateMutex};
+        auto resolvedRoot = VFS::resolvePath(m_assetRoot.string());
+        if (m_registryInitialized && resolvedRoot == m_assetRootResolved)
+        {
+            return;
+        }
+
+        if (m_registryInitialized)
+        {
+            m_registry.clear();
+            for (auto& index : m_sourcePathIndex)
+            {
+                index.clear();
+            }
+            m_indexedPaths.clear();
+            m_internedPaths.clear();
+            m_dirtyAssets.clear();
+            m_resolvedTextureKeys.clear();
+        }
+
+        m_assetRootResolved = resolvedRoot;
+        m_registryPath = m_assetRootResolved / "library/asset-db/registry.bin";
+        m_directoryIndexPath = m_assetRootResolved / "library/asset-db/directory-index.bin";
+        m_registryInitialized = true;
+
+        auto registryDir = m_registryPath.parent_path();
+        if (!registryDir.empty())
+        {
+            VFS::createDirectories(registryDir.string());
+        }
+
+        auto loaded = m_registry.load(m_registryPath);
+        m_directoryIndex.load(m_directoryIndexPath);
+        auto const legacyPath = m_assetRootResolved / "library/asset-db/registry.json";
+        if (!loaded && m_registry.importJson(legacyPath))
+        {
+            AP_INFO("[AssetManager] Migrating JSON asset registry: {}", legacyPath.string());
+            m_registryDirty = true;
+            // importJson does not journal, so until the binary image is written registry.json is the only copy.
+            if (saveRegistry())
+            {
+                VFS::removeFile(legacyPath.string());
+            }
+            else
+            {
+                AP_WARN("[AssetManager] Keeping {} until the binary registry can be written", legacyPath.string());
+            }
+            loaded = true;
+        }
+
+        if (loaded)
+        {
+            AP_INFO("[AssetManager] Loaded asset registry: {} ({} records)", m_registryPath.string(), m_registry.getRecordCount());
+
+            auto count = scanDirectory(m_assetRootResolved);
+            if (count > 0)
+            {
+                AP_INFO("[AssetManager] Scanned assets: {} entries", count);
+                saveRegistry();
+            }
+            return;
+        }
+
+        auto count = scanDirectory(m_assetRootResolved);
+        if (count > 0)
+        {
+            AP_INFO("[AssetManager] Scanned assets: {} entries", count);
+            saveRegistry();
+        }
+    }
+
+    auto AssetManager::saveRegistry() -> bool
+    {
+        auto lock = std::scoped_lock{m_registryStateMutex};
+        if (!m_registryDirty || m_registryPath.empty())
+        {
+            return true;
+        }
+
+        auto registryDir = m_registryPath.parent_path();
+        if (!registryDir.empty())
+        {
+            VFS::createDirectories(registryDir.string());
+        }
+
+        if (!m_registry.save(m_registryPath))
+        {
+            return false;
+        }
+
+        m_registryDirty = false;
+        AP_INFO("[AssetManager] Saved asset registry: {}", m_registryPath.string());
+        return true;
+    }
+
+    auto AssetManager::markDependentsDirty(core::UUID const& guid) -> void
+    {
+        auto dependents = m_registry.getDependents(guid);
+        {
+            auto lock = std::scoped_lock{m_mutex};
+            for (auto const& dependent : dependents)
+            {
+                m_dirtyAssets.insert(dependent);
+            }
+        }
+    }
+
+    auto AssetManager::watchAsset(Asset const& asset, std::filesystem::path const& assetPath) -> void
+    {
+        auto const sourcePath = std::filesystem::path{asset.getSourcePath()};
+        auto lock = std::scoped_lock{m_watchMutex};
+        auto& watched = m_watchedAssets[asset.getHandle()];
+        if (watched.assetPath != assetPath || !watched.assetStamp)
+        {
+            watched.assetPath = assetPath;
+            watched.assetStamp = AssetDirectoryIndex::stat(assetPath);
+        }
+        if (watched.sourcePath != sourcePath || !watched.sourceStamp)
+        {
+            watched.sourcePath = sourcePath;
+            watched.sourceStamp = sourcePath.empty() ? std::nullopt : AssetDirectoryIndex::stat(sourcePath);
+        }
+    }
+
+    auto AssetManager::pollSourceChanges() -> size_t
+    {
+        if (!m_hotReloadSettings.enabled || m_bundle)
+        {
+            return 0;
+        }
+
+        auto changes = std::vector<SourceChange>{};
+        {
+            auto lock = std::scoped_lock{m_watchMutex};
+            changes = std::exchange(m_sourceChanges, {});
+
+            // The stat calls run on a worker; a large project would otherwise spend the frame in syscalls.
+            auto const now = core::Timer::now();
+            if (!m_sourceSweepRunning && core::Timer::calcDuration(m_lastSourcePoll, now) >= m_hotReloadSettings.pollIntervalMs)
+            {
+                m_lastSourcePoll = now;
+                m_sourceSweepRunning = true;
+                core::ThreadPool::get().submit([this]() { sweepSourceChanges(); }, core::TaskPriority::Low);
+            }
+        }
+
+        for (auto const& change : changes)
+        {
+            AP_INFO("[AssetManager] Source changed, reloading: {}", change.assetPath.string());
+            auto request = std::make_shared<AssetLoadRequest>(change.assetPath, LoadPriority::Low);
+            request->m_prefetchPayload = false;
+            request->m_onComplete = [this, guid = change.guid](AssetLoadRequest& completed)
+            {
+                onAssetReloaded(guid, completed);
+            };
+            enqueueLoad(request, [this, change]() -> std::shared_ptr<Asset>
+            {
+                return reloadAsset(change.guid, change.assetPath, change.assetFileChanged);
+            });
+        }
+
+        return changes.size();
+    }
+
+    auto AssetManager::sweepSourceChanges() -> void
+    {
+        APRIL_PROFILE_ZONE("AssetManager::sweepSourceChanges");
+
+        struct Probe
+        {
+            core::UUID guid{};
+            std::filesystem::path assetPath{};
+            std::filesystem::path sourcePath{};
+            std::optional<AssetFileStamp> assetStamp{};
+            std::optional<AssetFileStamp> sourceStamp{};
+        };
+
+        // Assets evicted from the cache stop being watched; loading one again watches it anew.
+        auto probes = std::vector<Probe>{};
+        {
+            auto lock = std::scoped_lock{m_watchMutex};
+            std::erase_if(m_watchedAssets, [this](auto const& watched) { return !m_cache.contains(watched.first); });
+            probes.reserve(m_watchedAssets.size());
+            for (auto const& [guid, watched] : m_watchedAssets)
+            {
+                if (!watched.reloading)
+                {
+                    probes.push_back({guid, watched.assetPath, watched.sourcePath});
+                }
+            }
+        }
+
+        // A file that cannot be stat'ed is mid-save or gone; it is looked at again on the next sweep.
+        for (auto& probe : probes)
+        {
+            probe.assetStamp = probe.assetPath.empty() ? std::nullopt : AssetDirectoryIndex::stat(probe.assetPath);
+            probe.sourceStamp = probe.sourcePath.empty() ? std::nullopt : AssetDirectoryIndex::stat(probe.sourcePath);
+        }
+
+        auto const refresh = [](std::optional<AssetFileStamp>& stamp, std::optional<AssetFileStamp> const& current) -> bool
+        {
+            if (!current)
+            {
+                return false;
+            }
+
+            auto const changed = !stamp || !stamp->matches(*current);
+            stamp = current;
+            return changed;
+        };
+
+        auto lock = std::scoped_lock{m_watchMutex};
+        for (auto const& probe : probes)
+        {
+            // Skip watches that were dropped, re-pointed or started reloading while the files were stat'ed.
+            auto const it = m_watchedAssets.find(probe.guid);
+            if (it == m_watchedAssets.end() || it->second.reloading ||
+                it->second.assetPath != probe.assetPath || it->second.sourcePath != probe.sourcePath)
+            {
+                continue;
+            }
+
+            auto& watched = it->second;
+            auto const assetFileChanged = refresh(watched.assetStamp, probe.assetStamp);
+            auto const sourceChanged = refresh(watched.sourceStamp, probe.sourceStamp);
+            if (assetFileChanged || sourceChanged)
+            {
+                watched.reloading = true;
+                m_sourceChanges.push_back({probe.guid, watched.assetPath, assetFileChanged});
+            }
+        }
+
+        m_sourceSweepRunning = false;
+        m_sourceSweepDone.notify_all();
+    }
+
+    auto AssetManager::reloadAsset(
+        core::UUID const& guid,
+        std::filesystem::path const& assetPath,
+        bool assetFileChanged
+    ) -> std::shared_ptr<Asset>
     {
+        auto asset = std::shared_ptr<Asset>{};
+        if (assetFileChanged)
+        {
+            // Edited settings replace the cached asset; holders of the old one keep it until they refresh.
+            asset = loadAssetMetadata(assetPath);
+            if (asset && asset->getHandle() != guid)
+            {
+                AP_WARN("[AssetManager] Asset UUID changed on reload for {}: expected {}, got {}",
+                    assetPath.string(), guid.toString(), asset->getHandle().toString());
+                return nullptr;
+            }
+            if (asset)
+            {
+                registerAssetInternal(asset, assetPath, true);
+            }
+        }
+        else
+        {
+            asset = loadAssetByGuid(guid);
+        }
+
         if (!asset)
         {
-            return;
+            return nullptr;
+        }
+
+        // The DDC key covers the source hash and settings, so a changed input cooks to a new key.
+        auto const type = asset->getType();
+        if ((type == AssetType::Texture || type == AssetType::Mesh || type == AssetType::Material) && !ensureImported(*asset))
+        {
+            return nullptr;
+        }
+        return asset;
+    }
+
+    auto AssetManager::onAssetReloaded(core::UUID const& guid, AssetLoadRequest const& request) -> void
+    {
+        auto lock = std::scoped_lock{m_watchMutex};
+        if (auto it = m_watchedAssets.find(guid); it != m_watchedAssets.end())
+        {
+            it->second.reloading = false;
+        }
+
+        if (request.getState() != LoadState::Ready)
+        {
+            AP_WARN("[AssetManager] Hot reload failed: {}", request.getAssetPath().string());
+            return;
+        }
+
+        // Dependents were marked dirty by the recook, so their own data recooks when next requested.
+        auto const first = m_reloadedAssets.size();
+        auto visited = std::unordered_set<core::UUID>{guid};
+        m_reloadedAssets.push_back(guid);
+        for (auto i = first; i < m_reloadedAssets.size(); ++i)
+        {
+            for (auto const& dependent : m_registry.getDependents(m_reloadedAssets[i]))
+            {
+                if (visited.insert(dependent).second)
+                {
+                    m_reloadedAssets.push_back(dependent);
+                }
+            }
+        }
+
+        AP_INFO("[AssetManager] Reloaded asset: {} ({} dependents)",
+            request.getAssetPath().string(), m_reloadedAssets.size() - first - 1);
+    }
+
+    auto AssetManager::takeReloadedAssets() -> std::vector<core::UUID>
+    {
+        auto lock = std::scoped_lock{m_watchMutex};
+        return std::exchange(m_reloadedAssets, {});
+    }
+
+    auto AssetManager::loadAssetMetadata(std::filesystem::path const& assetPath) -> std::shared_ptr<Asset>
+    {
+        auto payload = VFS::readTextFile(assetPath.string());
+        if (payload.empty())
+        {
+            AP_ERROR("[AssetManager] Failed to open asset file: {}", assetPath.string());
+            return nullptr;
+        }
+
+        auto json = nlohmann::json{};
+        try
+        {
+            json = nlohmann::json::parse(payload);
+        }
+        catch (nlohmann::json::parse_error const& e)
+        {
+            AP_ERROR("[AssetManager] Failed to parse asset file: {} - {}", assetPath.string(), e.what());
+            return nullptr;
+        }
+
+        if (!json.contains("type"))
+        {
+            AP_ERROR("[AssetManager] Asset file missing 'type' field: {}", assetPath.string());
+            return nullptr;
+        }
+
+        auto typeStr = json["type"].get<std::string>();
+        auto type = AssetType::None;
+
+        if (typeStr == "Texture")
+        {
+            type = AssetType::Texture;
+        }
+        else if (typeStr == "Mesh")
+        {
+            type = AssetType::Mesh;
+        }
+        else if (typeStr == "Material")
+        {
+            type = AssetType::Material;
         }
-
-        auto const handle = asset->getHandle();
+        else if (typeStr == "Scene")
         {
-            auto lock = std::scoped_lock{m_mutex};
-            if (cacheAsset)
-            {
-                m_loadedAssets[handle] = asset;
-            }
-            if (!asset->getSourcePath().empty())
-            {
-                m_sourcePathIndex[buildSourceKey(asset->getType(), asset->getSourcePath())] = handle;
-            }
-            if (!asset->getAssetPath().empty() &&
-                (asset->getType() == AssetType::Material || asset->getType() == AssetType::Texture))
-            {
-                m_sourcePathIndex[buildSourceKey(asset->getType(), asset->getAssetPath())] = handle;
-            }
+            type = AssetType::Scene;
         }
-        m_registry.registerAsset(*asset, assetPath.string());
-        m_registryDirty = true;
-    }
 
-    auto AssetManager::loadAssetByGuid(core::UUID const& guid) -> std::shared_ptr<Asset>
-    {
-        if (guid.getNative().is_nil())
+        if (type == AssetType::None)
         {
+            AP_ERROR("[AssetManager] Unknown asset type: {}", typeStr);
             return nullptr;
         }
 
-        initializeRegistry();
+        auto asset = createAsset(type);
+        if (!asset)
         {
-            auto lock = std::scoped_lock{m_mutex};
-            if (auto it = m_loadedAssets.find(guid); it != m_loadedAssets.end())
-            {
-                return it->second;
-            }
+            AP_ERROR("[AssetManager] Failed to construct asset type: {}", typeStr);
+            return nullptr;
         }
 
-        auto recordOpt = m_registry.findRecord(guid);
-        if (!recordOpt.has_value())
+        if (!asset->deserializeJson(json))
         {
-            AP_WARN("[AssetManager] Asset UUID not found in registry: {}", guid.toString());
+            AP_ERROR("[AssetManager] Failed to deserialize asset: {}", assetPath.string());
             return nullptr;
         }
 
-        auto const& record = *recordOpt;
-        if (record.assetPath.empty())
-        {
-            AP_WARN("[AssetManager] Asset record missing path for UUID: {}", guid.toString());
+        asset->setAssetPath(assetPath.string());
+        return asset;
+    }
+
+    auto AssetManager::createAsset(AssetType type) -> std::shared_ptr<Asset>
+    {
+        switch (type)
+        {
+        case AssetType::Texture:
+            return std::make_shared<TextureAsset>();
+        case AssetType::Mesh:
+            return std::make_shared<StaticMeshAsset>();
+        case AssetType::Material:
+            return std::make_shared<MaterialAsset>();
+        case AssetType::Scene:
+            return std::make_shared<SceneAsset>();
+        default:
             return nullptr;
         }
+    }
 
-        if (record.type == AssetType::Texture)
+    auto AssetManager::mountBundle(std::filesystem::path const& bundlePath) -> bool
+    {
+        auto bundle = std::make_unique<AssetBundle>();
+        if (!bundle->open(bundlePath))
         {
-            return std::static_pointer_cast<Asset>(loadAssetFromFile<TextureAsset>(record.assetPath));
+            return false;
         }
-        if (record.type == AssetType::Material)
+
+        if (bundle->getTargetId() != m_targetProfile.toId())
         {
-            return std::static_pointer_cast<Asset>(loadAssetFromFile<MaterialAsset>(record.assetPath));
+            AP_WARN("[AssetManager] Bundle target '{}' differs from current target '{}'",
+                    bundle->getTargetId(), m_targetProfile.toId());
         }
-        if (record.type == AssetType::Mesh)
+
+        // Bundle mode never scans or imports sources; mark the registry as initialized for this root.
         {
-            return std::static_pointer_cast<Asset>(loadAssetFromFile<StaticMeshAsset>(record.assetPath));
+            auto lock = std::scoped_lock{m_registryStateMutex};
+            m_assetRootResolved = VFS::resolvePath(m_assetRoot.string());
+            m_registryInitialized = true;
         }
 
-        AP_WARN("[AssetManager] Unsupported asset type for UUID {}: {}", guid.toString(), static_cast<int>(record.type));
-        return nullptr;
+        m_bundle = std::move(bundle);
+        return true;
     }
 
-    auto AssetManager::initializeRegistry() -> void
+    auto AssetManager::cookAssets(std::span<std::shared_ptr<Asset> const> assets) -> size_t
     {
-        auto resolvedRoot = VFS::resolvePath(m_assetRoot.string());
-        if (m_registryInitialized && resolvedRoot == m_assetRootResolved)
-        {
-            return;
-        }
+        APRIL_PROFILE_ZONE("AssetManager::cookAssets");
 
-        if (m_registryInitialized)
+        if (m_bundle)
         {
-            m_registry.clear();
-            m_sourcePathIndex.clear();
-            m_dirtyAssets.clear();
+            return 0;
         }
 
-        m_assetRootResolved = resolvedRoot;
-        m_registryPath = m_assetRootResolved / "library/asset-db/registry.json";
-        m_registryInitialized = true;
-
-        auto registryDir = m_registryPath.parent_path();
-        if (!registryDir.empty())
+        // Assets cut from one source share its parse; it is dropped once the last of them has cooked.
+        auto sourceCache = ImportSourceCache{};
+        auto remaining = std::unordered_map<std::string, std::atomic<size_t>>{};
+        for (auto const& asset : assets)
         {
-            VFS::createDirectories(registryDir.string());
+            if (asset && !asset->getSourcePath().empty())
+            {
+                remaining[asset->getSourcePath()].fetch_add(1, std::memory_order_relaxed);
+            }
         }
 
-        if (m_registry.load(m_registryPath))
+        auto failures = std::atomic<size_t>{0};
+        core::ThreadPool::get().parallelFor(assets.size(), 1, [&](size_t begin, size_t end)
         {
-            AP_INFO("[AssetManager] Loaded asset registry: {}", m_registryPath.string());
-
-            auto count = scanDirectory(m_assetRootResolved);
-            if (count > 0)
+            for (auto i = begin; i < end; ++i)
             {
-                AP_INFO("[AssetManager] Scanned assets: {} entries", count);
-                saveRegistry();
+                if (!assets[i] || !ensureImported(*assets[i], &sourceCache))
+                {
+                    failures.fetch_add(1);
+                }
+
+                if (assets[i] && !assets[i]->getSourcePath().empty()
+                    && remaining.at(assets[i]->getSourcePath()).fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    sourceCache.release(assets[i]->getSourcePath());
+                }
             }
-            return;
-        }
+        });
 
-        auto count = scanDirectory(m_assetRootResolved);
-        if (count > 0)
-        {
-            AP_INFO("[AssetManager] Scanned assets: {} entries", count);
-            saveRegistry();
-        }
+        return failures.load();
     }
 
-    auto AssetManager::saveRegistry() -> void
+    auto AssetManager::cookBundle(std::filesystem::path const& outputPath) -> bool
     {
-        if (!m_registryDirty || m_registryPath.empty())
+        APRIL_PROFILE_ZONE("AssetManager::cookBundle");
+
+        if (m_bundle)
         {
-            return;
+            AP_ERROR("[AssetManager] Cannot cook a bundle while running in bundle mode");
+            return false;
         }
 
-        auto registryDir = m_registryPath.parent_path();
-        if (!registryDir.empty())
+        initializeRegistry();
+
+        auto records = m_registry.getRecords();
+        std::sort(records.begin(), records.end(), [](AssetRecord const& a, AssetRecord const& b)
         {
-            VFS::createDirectories(registryDir.string());
-        }
+            return a.assetPath < b.assetPath;
+        });
+
+        auto writer = AssetBundleWriter{m_targetProfile};
+        auto failures = size_t{0};
 
-        if (m_registry.save(m_registryPath))
+        auto assets = std::vector<std::shared_ptr<Asset>>{};
+        auto cooked = std::vector<std::shared_ptr<Asset>>{};
+        assets.reserve(records.size());
+        for (auto const& record : records)
         {
-            m_registryDirty = false;
-            AP_INFO("[AssetManager] Saved asset registry: {}", m_registryPath.string());
+            auto asset = loadAssetByGuid(record.guid);
+            if (!asset)
+            {
+                AP_ERROR("[AssetManager] Cook: failed to load asset {} ({})", record.assetPath, record.guid.toString());
+                ++failures;
+                continue;
+            }
+
+            if (asset->getType() == AssetType::Texture || asset->getType() == AssetType::Mesh)
+            {
+                cooked.push_back(asset);
+            }
+            assets.push_back(std::move(asset));
         }
-    }
 
-    auto AssetManager::markDependentsDirty(core::UUID const& guid) -> void
-    {
-        auto dependents = m_registry.getDependents(guid);
+        // One parallel batch, so meshes cut from one glTF share its parse. Failures surface again, per asset,
+        // when the payloads are read below.
+        cookAssets(cooked);
+
+        for (auto const& asset : assets)
         {
-            auto lock = std::scoped_lock{m_mutex};
-            for (auto const& dependent : dependents)
+            auto entry = AssetBundleWriter::Entry{};
+            entry.guid = asset->getHandle();
+            entry.type = asset->getType();
+            auto bundlePath = toBundlePath(asset->getAssetPath());
+            if (!bundlePath)
             {
-                m_dirtyAssets.insert(dependent);
+                // An absolute path would tie the bundle to this machine's layout.
+                AP_ERROR("[AssetManager] Cook: {} is outside the asset root {}", asset->getAssetPath(), m_assetRoot.string());
+                ++failures;
+                continue;
+            }
+            entry.bundlePath = std::move(*bundlePath);
+
+            if (asset->getType() == AssetType::Texture)
+            {
+                if (!getTextureData(static_cast<TextureAsset const&>(*asset), entry.payload).isValid())
+                {
+                    AP_ERROR("[AssetManager] Cook: texture cook failed for {}", asset->getAssetPath());
+                    ++failures;
+                    continue;
+                }
+            }
+            else if (asset->getType() == AssetType::Mesh)
+            {
+                // Bundles keep the encoded blob; a decoded copy is only used for validation.
+                auto const& meshAsset = static_cast<StaticMeshAsset const&>(*asset);
+                auto const stored = readMeshBlob(meshAsset, entry.payload);
+                auto decoded = entry.payload;
+                if (!stored || !decodeMeshBlob(decoded, asset->getAssetPath()) ||
+                    !parseMeshBlob(decoded, asset->getAssetPath()).isValid())
+                {
+                    AP_ERROR("[AssetManager] Cook: mesh cook failed for {}", asset->getAssetPath());
+                    ++failures;
+                    continue;
+                }
+            }
+
+            auto json = nlohmann::json{};
+            asset->serializeJson(json);
+            auto const cbor = nlohmann::json::to_cbor(json);
+            entry.metadata.resize(cbor.size());
+            std::memcpy(entry.metadata.data(), cbor.data(), cbor.size());
+
+            for (auto const& ref : asset->getReferences())
+            {
+                if (!ref.guid.getNative().is_nil())
+                {
+                    entry.references.push_back(ref.guid);
+                }
             }
+
+            writer.addEntry(std::move(entry));
+        }
+
+        saveRegistry();
+
+        if (failures > 0)
+        {
+            AP_ERROR("[AssetManager] Cook finished with {} failed assets; bundle not written", failures);
+            return false;
         }
+
+        return writer.write(outputPath);
     }
 
-    auto AssetManager::loadAssetMetadata(std::filesystem::path const& assetPath) -> std::shared_ptr<Asset>
+    auto AssetManager::loadAssetFromBundle(core::UUID const& guid) -> std::shared_ptr<Asset>
     {
-        auto payload = VFS::readTextFile(assetPath.string());
-        if (payload.empty())
+        if (auto cached = m_cache.find(guid))
         {
-            AP_ERROR("[AssetManager] Failed to open asset file: {}", assetPath.string());
-            return nullptr;
+            recordUsage(*cached, AssetUsageKind::Metadata);
+            return cached;
         }
 
-        auto json = nlohmann::json{};
-        try
+        auto const* entry = m_bundle->find(guid);
+        if (!entry)
         {
-            json = nlohmann::json::parse(payload);
+            AP_ERROR("[AssetManager] Asset UUID not found in bundle: {}", guid.toString());
+            return nullptr;
         }
-        catch (nlohmann::json::parse_error const& e)
+
+        auto const metadata = m_bundle->getMetadata(*entry);
+        auto json = nlohmann::json::from_cbor(
+            reinterpret_cast<uint8_t const*>(metadata.data()),
+            reinterpret_cast<uint8_t const*>(metadata.data()) + metadata.size(),
+            true,
+            false
+        );
+        if (json.is_discarded())
         {
-            AP_ERROR("[AssetManager] Failed to parse asset file: {} - {}", assetPath.string(), e.what());
+            AP_ERROR("[AssetManager] Corrupt bundle metadata for: {}", guid.toString());
             return nullptr;
         }
 
-        if (!json.contains("type"))
+        auto asset = createAsset(entry->type);
+        if (!asset || !asset->deserializeJson(json))
         {
-            AP_ERROR("[AssetManager] Asset file missing 'type' field: {}", assetPath.string());
+            AP_ERROR("[AssetManager] Failed to deserialize bundled asset: {}", guid.toString());
             return nullptr;
         }
 
-        auto typeStr = json["type"].get<std::string>();
-        auto type = AssetType::None;
+        asset->setAssetPath(m_bundle->getPath(*entry));
+        auto const sourcePath = normalizePath(asset->getSourcePath());
+        auto const indexedAssetPath = normalizePath(asset->getAssetPath());
 
-        if (typeStr == "Texture")
+        if (auto resident = m_cache.emplace(asset); resident != asset)
         {
-            type = AssetType::Texture;
+            return resident;
         }
-        else if (typeStr == "Mesh")
+        recordUsage(*asset, AssetUsageKind::Metadata);
+
         {
-            type = AssetType::Mesh;
+            auto lock = std::scoped_lock{m_mutex};
+            indexPathsLocked(*asset, sourcePath, indexedAssetPath);
         }
-        else if (typeStr == "Material")
+
+        for (auto const& ref : asset->getReferences())
         {
-            type = AssetType::Material;
+            if (!ref.guid.getNative().is_nil() && !loadAssetFromBundle(ref.guid))
+            {
+                AP_WARN("[AssetManager] Failed to load referenced asset: {}", ref.guid.toString());
+            }
         }
 
-        if (type == AssetType::None)
+        return asset;
+    }
+
+    auto AssetManager::loadAssetFromBundlePath(std::filesystem::path const& assetPath) -> std::shared_ptr<Asset>
+    {
+        auto const bundlePath = toBundlePath(assetPath);
+        auto const* entry = bundlePath ? m_bundle->findByPath(*bundlePath) : nullptr;
+        if (!entry)
         {
-            AP_ERROR("[AssetManager] Unknown asset type: {}", typeStr);
+            AP_ERROR("[AssetManager] Asset not found in bundle: {}", assetPath.string());
             return nullptr;
         }
 
-        std::shared_ptr<Asset> asset = nullptr;
-        if (type == AssetType::Texture)
+        auto bytes = std::array<uint8_t, 16>{entry->guid};
+        return loadAssetFromBundle(core::UUID{std::span<uint8_t const, 16>{bytes}});
+    }
+
+    auto AssetManager::readBundlePayload(Asset const& asset, std::vector<std::byte>& outBlob) const -> bool
+    {
+        auto const* entry = m_bundle->find(asset.getHandle());
+        if (!entry)
         {
-            asset = std::make_shared<TextureAsset>();
+            AP_ERROR("[AssetManager] Asset UUID not found in bundle: {}", asset.getHandle().toString());
+            return false;
         }
-        else if (type == AssetType::Mesh)
+
+        auto const payload = m_bundle->getPayload(*entry);
+        if (payload.empty())
         {
-            asset = std::make_shared<StaticMeshAsset>();
+            AP_ERROR("[AssetManager] Missing bundled payload for: {}", asset.getAssetPath());
+            return false;
         }
-        else if (type == AssetType::Material)
+
+        outBlob.assign(payload.begin(), payload.end());
+        return true;
+    }
+
+    auto AssetManager::readCookedRange(
+        Asset const& asset,
+        std::string const& ddcKey,
+        uint64_t offset,
+        uint64_t size,
+        std::vector<std::byte>& outBytes
+    ) -> bool
+    {
+        if (m_bundle)
         {
-            asset = std::make_shared<MaterialAsset>();
+            auto const* entry = m_bundle->find(asset.getHandle());
+            auto const payload = entry ? m_bundle->getPayload(*entry) : std::span<std::byte const>{};
+            if (offset > payload.size() || size > payload.size() - offset)
+            {
+                AP_ERROR("[AssetManager] Missing bundled payload range for: {}", asset.getAssetPath());
+                return false;
+            }
+
+            auto const range = payload.subspan(static_cast<size_t>(offset), static_cast<size_t>(size));
+            outBytes.assign(range.begin(), range.end());
+            return true;
         }
 
-        if (!asset)
+        auto value = DdcValue{};
+        if (!m_ddc.getRange(ddcKey, offset, size, value))
         {
-            AP_ERROR("[AssetManager] Failed to construct asset type: {}", typeStr);
-            return nullptr;
+            AP_ERROR("[AssetManager] Missing DDC data range {}+{} for: {}", offset, size, asset.getSourcePath());
+            return false;
         }
 
-        if (!asset->deserializeJson(json))
+        outBytes = std::move(value.bytes);
+        return true;
+    }
+
+    auto AssetManager::toBundlePath(std::filesystem::path const& assetPath) const -> std::optional<std::string>
+    {
+        auto const resolved = std::filesystem::absolute(VFS::resolvePath(assetPath.string())).lexically_normal();
+        auto const root = std::filesystem::absolute(VFS::resolvePath(m_assetRoot.string())).lexically_normal();
+        auto relative = resolved.lexically_relative(root);
+        if (relative.empty() || relative.begin()->string() == "..")
         {
-            AP_ERROR("[AssetManager] Failed to deserialize asset: {}", assetPath.string());
-            return nullptr;
+            return std::nullopt;
         }
 
-        asset->setAssetPath(assetPath.string());
-        return asset;
+        return relative.generic_string();
     }
 
     auto AssetManager::sanitizeAssetName(std::string name) const -> std::string
@@ -856,12 +2106,79 @@ namespace april::asset
         return resolved.lexically_normal().string();
     }
 
-    auto AssetManager::buildSourceKey(AssetType type, std::filesystem::path const& path) const -> std::string
+    auto AssetManager::indexPathsLocked(Asset const& asset, std::string const& sourcePath, std::string const& assetPath) -> void
     {
-        return std::format("{}|{}", static_cast<int>(type), normalizePath(path));
+        auto const handle = asset.getHandle();
+        auto const type = static_cast<size_t>(asset.getType());
+        auto const unindex = [&](IndexedPaths const& paths)
+        {
+            auto& index = m_sourcePathIndex[static_cast<size_t>(paths.type)];
+            for (auto const path : {paths.sourcePath, paths.assetPath})
+            {
+                if (auto it = index.find(path); !path.empty() && it != index.end() && it->second == handle)
+                {
+                    index.erase(it);
+                }
+            }
+        };
+        auto const intern = [&](std::string const& path) -> std::string_view
+        {
+            if (path.empty())
+            {
+                return {};
+            }
+            auto& [interned, references] = *m_internedPaths.try_emplace(path, 0).first;
+            ++references;
+            return interned;
+        };
+        // Strings no index entry points at any more are dropped, so renamed assets do not pin their old paths.
+        auto const release = [&](IndexedPaths const& paths)
+        {
+            for (auto const path : {paths.sourcePath, paths.assetPath})
+            {
+                if (auto it = path.empty() ? m_internedPaths.end() : m_internedPaths.find(std::string{path});
+                    it != m_internedPaths.end() && --it->second == 0)
+                {
+                    m_internedPaths.erase(it);
+                }
+            }
+        };
+
+        auto previous = std::optional<IndexedPaths>{};
+        if (auto indexed = m_indexedPaths.find(handle); indexed != m_indexedPaths.end())
+        {
+            unindex(indexed->second);
+            previous = indexed->second;
+            m_indexedPaths.erase(indexed);
+        }
+
+        if (type >= kAssetTypeCount)
+        {
+            if (previous)
+            {
+                release(*previous);
+            }
+            return;
+        }
+
+        // Intern before releasing, so a path the asset keeps is never freed in between.
+        auto paths = IndexedPaths{asset.getType(), intern(sourcePath), intern(assetPath)};
+        if (previous)
+        {
+            release(*previous);
+        }
+        auto& index = m_sourcePathIndex[type];
+        for (auto const path : {paths.sourcePath, paths.assetPath})
+        {
+            if (!path.empty())
+            {
+                index[path] = handle;
+            }
+        }
+        m_indexedPaths[handle] = paths;
     }
 
-    auto AssetManager::ensureImported(Asset const& asset) -> std::optional<std::string>
+    auto AssetManager::ensureImported(Asset const& asset, ImportSourceCache* sourceCache) -> std::optional<std::string>
     {
         auto importer = (IImporter*) nullptr;
         if (!asset.getImporterChain().empty())
@@ -895,7 +2212,8 @@ namespace april::asset
             m_targetProfile,
             m_ddc,
             deps,
-            forceReimport
+            forceReimport,
+            sourceCache
         };
 
         auto recordOpt = m_registry.findRecord(asset.getHandle());
@@ -916,15 +2234,17 @@ namespace april::asset
             AP_ERROR("[AssetManager] Import failed for asset: {}", asset.getAssetPath());
             record.lastImportFailed = true;
             record.lastErrorSummary = result.errors.front();
-            m_registry.updateRecord(std::move(record));
-            m_registryDirty = true;
 
-            auto existing = record.ddcKeys.find(targetId);
-            if (existing != record.ddcKeys.end() && !existing->second.empty())
+            // Keep serving the last good cook.
+            auto fallbackKey = std::optional<std::string>{};
+            if (auto existing = record.ddcKeys.find(targetId); existing != record.ddcKeys.end() && !existing->second.empty())
             {
-                return existing->second.front();
+                fallbackKey = existing->second.front();
             }
-            return std::nullopt;
+
+            m_registry.updateRecord(std::move(record));
+            m_registryDirty = true;
+            return fallbackKey;
         }
 
         record.deps = deps.deps;
@@ -936,15 +2256,22 @@ namespace april::asset
             record.lastFingerprint[targetId] = result.producedKeys.front();
         }
 
-        if (!asset.getSourcePath().empty())
+        // The keys fingerprint the source contents, so a record that already matches them needs neither
+        // a rehash nor a rewrite; DDC hits would otherwise journal an identical record on every load.
+        auto const unchanged = recordOpt && record == *recordOpt &&
+            (asset.getSourcePath().empty() || !record.lastSourceHash.empty());
+        auto const fingerprintChanged = !result.producedKeys.empty() && result.producedKeys.front() != previousFingerprint;
+        if (!unchanged)
         {
-            record.lastSourceHash = hashFileContents(asset.getSourcePath());
+            if (!asset.getSourcePath().empty())
+            {
+                record.lastSourceHash = hashFileContents(asset.getSourcePath());
+            }
+            m_registry.updateRecord(std::move(record));
+            m_registryDirty = true;
         }
 
-        m_registry.updateRecord(std::move(record));
-        m_registryDirty = true;
-
-        if (!result.producedKeys.empty() && record.lastFingerprint[targetId] != previousFingerprint)
+        if (fingerprintChanged)
         {
             markDependentsDirty(asset.getHandle());
         }
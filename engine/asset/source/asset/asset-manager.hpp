@@ -4,20 +4,36 @@
 #include "texture-asset.hpp"
 #include "static-mesh-asset.hpp"
 #include "material-asset.hpp"
+#include "scene-asset.hpp"
 #include "blob-header.hpp"
 #include "ddc/local-ddc.hpp"
+#include "asset-cache.hpp"
+#include "asset-directory-index.hpp"
 #include "asset-registry.hpp"
+#include "asset-load-request.hpp"
+#include "asset-usage.hpp"
+#include "bundle/asset-bundle.hpp"
 #include "importer/importer-registry.hpp"
 
 #include <core/file/vfs.hpp>
 #include <core/log/logger.hpp>
+#include <core/profile/timer.hpp>
 #include <core/tools/uuid.hpp>
 
 #include <unordered_map>
 #include <unordered_set>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <format>
 #include <mutex>
 #include <cstdint>
@@ -50,11 +66,23 @@ namespace april::asset
             TextureImportSettings textureSettings{};
             bool overrideMeshSettings{false};
             MeshImportSettings meshSettings{};
+            bool cookImportedMeshes{false};     // Cook the produced meshes while the parsed source is still shared
         };
 
+        struct HotReloadSettings
+        {
+            bool enabled{false};
+            double pollIntervalMs{250.0};
+        };
+
+        /**
+         * @param bundlePath Optional cooked bundle. When set, the manager runs in bundle mode:
+         *        assets and cooked data resolve from the mapped bundle and the source registry is not scanned.
+         */
         explicit AssetManager(
             std::filesystem::path const& assetRoot = "content",
-            std::filesystem::path const& cacheRoot = "build/cache/DDC"
+            std::filesystem::path const& cacheRoot = "build/cache/DDC",
+            std::filesystem::path const& bundlePath = {}
         );
 
         ~AssetManager();
@@ -89,18 +117,20 @@ namespace april::asset
         template <typename T>
         [[nodiscard]] auto getAsset(core::UUID handle) -> std::shared_ptr<T>
         {
-            auto assetPath = std::optional<std::filesystem::path>{};
+            if (auto cached = m_cache.find(handle))
             {
-                auto lock = std::scoped_lock{m_mutex};
-                if (m_loadedAssets.contains(handle))
-                {
-                    return std::static_pointer_cast<T>(m_loadedAssets.at(handle));
-                }
+                recordUsage(*cached, AssetUsageKind::Metadata);
+                return std::static_pointer_cast<T>(cached);
+            }
+
+            if (m_bundle)
+            {
+                return std::static_pointer_cast<T>(loadAssetFromBundle(handle));
             }
 
-            if (auto recordOpt = m_registry.findRecord(handle); recordOpt.has_value())
+            if (auto recordedPath = m_registry.findAssetPath(handle); recordedPath.has_value())
             {
-                return loadAssetFromFile<T>(recordOpt->assetPath);
+                return loadAssetFromFile<T>(*recordedPath);
             }
 
             AP_ERROR("[AssetManager] Asset UUID not found in registry: {}", handle.toString());
@@ -113,9 +143,134 @@ namespace april::asset
         template <typename T>
         [[nodiscard]] auto loadAsset(std::filesystem::path const& assetPath) -> std::shared_ptr<T>
         {
+            if (m_bundle)
+            {
+                return std::static_pointer_cast<T>(loadAssetFromBundlePath(assetPath));
+            }
+
             return loadAssetFromFile<T>(assetPath);
         }
 
+        /**
+         * Load an asset on a worker thread. Texture and mesh cooked data is prefetched as well.
+         * The callback runs on the thread that calls processCompletedLoads (normally the main thread),
+         * and is skipped if the handle was cancelled.
+         */
+        template <typename T>
+        auto loadAssetAsync(
+            std::filesystem::path const& assetPath,
+            LoadPriority priority = LoadPriority::Normal,
+            AssetLoadRequest::Callback onComplete = {}
+        ) -> AssetLoadHandle
+        {
+            auto request = std::make_shared<AssetLoadRequest>(assetPath, priority);
+            request->m_onComplete = std::move(onComplete);
+            enqueueLoad(request, [this, assetPath]() -> std::shared_ptr<Asset>
+            {
+                return std::static_pointer_cast<Asset>(loadAsset<T>(assetPath));
+            });
+            return request;
+        }
+
+        /**
+         * Asynchronous counterpart of getAsset. Returns nullptr if the UUID is not registered.
+         */
+        template <typename T>
+        auto getAssetAsync(
+            core::UUID handle,
+            LoadPriority priority = LoadPriority::Normal,
+            AssetLoadRequest::Callback onComplete = {}
+        ) -> AssetLoadHandle
+        {
+            auto assetPath = std::filesystem::path{};
+            if (!m_bundle)
+            {
+                auto recordedPath = m_registry.findAssetPath(handle);
+                if (!recordedPath.has_value())
+                {
+                    AP_ERROR("[AssetManager] Asset UUID not found in registry: {}", handle.toString());
+                    return nullptr;
+                }
+                assetPath = std::move(*recordedPath);
+            }
+
+            auto request = std::make_shared<AssetLoadRequest>(assetPath, priority);
+            request->m_onComplete = std::move(onComplete);
+            enqueueLoad(request, [this, handle]() -> std::shared_ptr<Asset>
+            {
+                return std::static_pointer_cast<Asset>(getAsset<T>(handle));
+            });
+            return request;
+        }
+
+        /**
+         * Asynchronous getTextureMips for a texture registered under handle. Used by texture streaming,
+         * which loads the mip tail first and re-requests larger ranges as the texture gets closer.
+         */
+        auto getTextureMipsAsync(
+            core::UUID handle,
+            uint32_t maxDimension,
+            LoadPriority priority = LoadPriority::Normal,
+            AssetLoadRequest::Callback onComplete = {}
+        ) -> AssetLoadHandle;
+
+        /**
+         * Drain finished async loads and invoke their callbacks on the calling thread.
+         * Returns the number of requests dequeued.
+         */
+        auto processCompletedLoads(size_t maxCount = std::numeric_limits<size_t>::max()) -> size_t;
+
+        /**
+         * Number of async loads queued or running on workers.
+         */
+        [[nodiscard]] auto getPendingLoadCount() const -> size_t;
+
+        /**
+         * Loaded assets are kept for reuse up to the cache budget; assets still referenced elsewhere are never evicted.
+         */
+        auto setCacheSettings(AssetCacheSettings const& settings) -> void { m_cache.setSettings(settings); }
+        [[nodiscard]] auto getCacheSettings() const -> AssetCacheSettings { return m_cache.getSettings(); }
+        [[nodiscard]] auto getCacheStats() const -> AssetCacheStats { return m_cache.getStats(); }
+        [[nodiscard]] auto isAssetLoaded(core::UUID const& handle) const -> bool { return m_cache.contains(handle); }
+
+        /**
+         * Hash of the asset's cooked payload for the current target. Assets whose cooks are byte-identical
+         * share a hash, so consumers can upload the data once. Returns nullopt if the asset has not been
+         * cooked yet, or in bundle mode.
+         */
+        [[nodiscard]] auto getCookedContentHash(core::UUID const& handle) -> std::optional<std::string>;
+
+        /**
+         * Usage recording: log the first metadata load and cooked-data read of every asset from now on, with
+         * its time since the start. Save the manifest next to the scene and pass it to prefetchUsage on later runs.
+         */
+        auto startUsageRecording() -> void { m_usageRecorder.start(); }
+        auto stopUsageRecording() -> AssetUsageManifest { return m_usageRecorder.stop(); }
+        [[nodiscard]] auto isRecordingUsage() const -> bool { return m_usageRecorder.isRecording(); }
+
+        /**
+         * Replay manifest on low-priority workers in recorded order: metadata is loaded into the cache and cooked
+         * payloads are faulted into the OS file cache (recooked first if their recorded key is stale), so the
+         * session's own loads find them in memory. Unknown assets are skipped. Returns the number queued.
+         */
+        auto prefetchUsage(AssetUsageManifest const& manifest) -> size_t;
+
+        /**
+         * Hot reload: a low-priority worker stats the source and .asset files of every asset still loaded
+         * from disk, at most once per interval; the changes it found are recooked on workers, through the
+         * async load queue, when this is next called. Does nothing while disabled or in bundle mode.
+         * Returns the number of reloads started.
+         */
+        auto pollSourceChanges() -> size_t;
+        auto setHotReloadSettings(HotReloadSettings const& settings) -> void { m_hotReloadSettings = settings; }
+        [[nodiscard]] auto getHotReloadSettings() const -> HotReloadSettings const& { return m_hotReloadSettings; }
+
+        /**
+         * Assets recooked since the last call, each followed by its transitive dependents. Filled by
+         * processCompletedLoads; consumers refresh their runtime resources from it at a frame boundary.
+         */
+        [[nodiscard]] auto takeReloadedAssets() -> std::vector<core::UUID>;
+
         /**
          * Get compiled texture data for a TextureAsset.
          * Returns a TexturePayload with header and pixel data span.
@@ -123,9 +278,17 @@ namespace april::asset
          */
         [[nodiscard]] auto getTextureData(TextureAsset const& asset, std::vector<std::byte>& outBlob) -> TexturePayload;
 
+        /**
+         * Get the mip chain of a texture starting at the first mip whose larger side fits maxDimension.
+         * Only the header and that byte range are read from the DDC or bundle. The payload header describes
+         * the returned mips, so it uploads like a full texture; firstMip and storedHeader describe the rest.
+         */
+        [[nodiscard]] auto getTextureMips(TextureAsset const& asset, uint32_t maxDimension, std::vector<std::byte>& outBlob) -> TexturePayload;
+
         /**
          * Get compiled mesh data for a StaticMeshAsset.
          * Returns a MeshPayload with header, submeshes, vertex data, and index data spans.
+         * Encoded vertex/index sections are decoded first, so the payload is always directly uploadable.
          * The blob is stored in the provided output vector for lifetime management.
          */
         [[nodiscard]] auto getMeshData(StaticMeshAsset const& asset, std::vector<std::byte>& outBlob) -> MeshPayload;
@@ -147,6 +310,28 @@ namespace april::asset
 
         [[nodiscard]] auto getDdc() -> LocalDdc&;
 
+        auto setTargetProfile(TargetProfile const& target) -> void { m_targetProfile = target; }
+        [[nodiscard]] auto getTargetProfile() const -> TargetProfile const& { return m_targetProfile; }
+
+        /**
+         * Cook a batch of assets concurrently on the shared core::ThreadPool, so image decode, mip generation
+         * and block compression of independent textures overlap. Assets already in the DDC only cost a lookup.
+         * @return Number of assets whose cook failed.
+         */
+        auto cookAssets(std::span<std::shared_ptr<Asset> const> assets) -> size_t;
+
+        /**
+         * Cook every registered asset for the current target profile and write a bundle.
+         * Textures are cooked as one concurrent batch first.
+         */
+        auto cookBundle(std::filesystem::path const& outputPath) -> bool;
+
+        /**
+         * Switch to bundle mode. getAsset/loadAsset/getTextureData/getMeshData resolve from the bundle.
+         */
+        auto mountBundle(std::filesystem::path const& bundlePath) -> bool;
+        [[nodiscard]] auto isBundleMode() const -> bool { return m_bundle != nullptr; }
+
         /**
          * Find an asset by its source path and type (for deduplication).
          */
@@ -162,18 +347,82 @@ namespace april::asset
         ImporterRegistry m_importers{};
         TargetProfile m_targetProfile{};
         std::filesystem::path m_registryPath{};
-        bool m_registryDirty{false};
+        std::atomic<bool> m_registryDirty{false};
+        AssetDirectoryIndex m_directoryIndex{};
+        std::filesystem::path m_directoryIndexPath{};
         std::filesystem::path m_assetRootResolved{};
         bool m_registryInitialized{false};
+        std::recursive_mutex m_registryStateMutex{};
+
+        // Async loading: requests in flight and finished requests awaiting the main thread
+        std::vector<AssetLoadHandle> m_inflightLoads{};
+        std::deque<AssetLoadHandle> m_completedLoads{};
+        mutable std::mutex m_loadMutex{};
+        std::condition_variable m_loadsDrained{};
+
+        // Cache: Assets currently in memory, evicted under a budget once nothing else references them
+        AssetCache m_cache{};
+
+        // Source path index: normalized source and asset paths of every registered asset, per AssetType.
+        // Paths are interned and counted per referencing entry; m_indexedPaths remembers each asset's keys so
+        // re-registering replaces them and releases strings nothing points at any more.
+        struct IndexedPaths
+        {
+            AssetType type{AssetType::None};
+            std::string_view sourcePath{};
+            std::string_view assetPath{};
+        };
 
-        // Cache: Assets currently in memory
-        std::unordered_map<core::UUID, std::shared_ptr<Asset>> m_loadedAssets{};
+        static constexpr auto kAssetTypeCount = static_cast<size_t>(AssetType::Scene) + 1;
+        std::unordered_map<std::string, uint32_t> m_internedPaths{};
+        std::array<std::unordered_map<std::string_view, core::UUID>, kAssetTypeCount> m_sourcePathIndex{};
+        std::unordered_map<core::UUID, IndexedPaths> m_indexedPaths{};
 
         // Registry: Persistent metadata in AssetRegistry
-        std::unordered_map<std::string, core::UUID> m_sourcePathIndex{};
         std::unordered_set<core::UUID> m_dirtyAssets{};
         mutable std::mutex m_mutex{};
 
+        // Key of each texture's last cook, so ranged mip reads skip re-fingerprinting an unchanged source
+        struct ResolvedTextureKey
+        {
+            std::string ddcKey{};
+            nlohmann::json settings{};
+            AssetFileStamp sourceStamp{};
+        };
+
+        std::unordered_map<core::UUID, ResolvedTextureKey> m_resolvedTextureKeys{};
+
+        // Bundle mode: cooked assets resolved from a mapped bundle instead of the DDC
+        std::unique_ptr<AssetBundle> m_bundle{};
+
+        // Hot reload: file stamps of loaded assets, and what finished reloading since the last take
+        struct WatchedAsset
+        {
+            std::filesystem::path assetPath{};
+            std::filesystem::path sourcePath{};
+            std::optional<AssetFileStamp> assetStamp{};
+            std::optional<AssetFileStamp> sourceStamp{};
+            bool reloading{false};
+        };
+
+        struct SourceChange
+        {
+            core::UUID guid{};
+            std::filesystem::path assetPath{};
+            bool assetFileChanged{false};
+        };
+
+        HotReloadSettings m_hotReloadSettings{};
+        core::Timer::TimePoint m_lastSourcePoll{};
+        std::unordered_map<core::UUID, WatchedAsset> m_watchedAssets{};
+        std::vector<SourceChange> m_sourceChanges{};    // Found by the last sweep, started by the next poll
+        bool m_sourceSweepRunning{false};
+        std::condition_variable m_sourceSweepDone{};
+        std::vector<core::UUID> m_reloadedAssets{};
+        mutable std::mutex m_watchMutex{};
+
+        AssetUsageRecorder m_usageRecorder{};
+
         /**
          * Load a typed asset from file.
          */
@@ -228,6 +477,9 @@ namespace april::asset
             return asset;
         }
 
+        auto enqueueLoad(AssetLoadHandle const& request, std::function<std::shared_ptr<Asset>()> loader) -> void;
+        auto runLoad(AssetLoadHandle const& request, std::function<std::shared_ptr<Asset>()> const& loader) -> void;
+
         auto registerAssetInternal(
             std::shared_ptr<Asset> const& asset,
             std::filesystem::path const& assetPath,
@@ -235,8 +487,17 @@ namespace april::asset
         ) -> void;
 
         auto loadAssetByGuid(core::UUID const& guid) -> std::shared_ptr<Asset>;
+        auto loadAssetFromBundle(core::UUID const& guid) -> std::shared_ptr<Asset>;
+        auto loadAssetFromBundlePath(std::filesystem::path const& assetPath) -> std::shared_ptr<Asset>;
+        auto readBundlePayload(Asset const& asset, std::vector<std::byte>& outBlob) const -> bool;
+        // Read part of a cooked blob; ddcKey is ignored in bundle mode.
+        auto readCookedRange(Asset const& asset, std::string const& ddcKey, uint64_t offset, uint64_t size, std::vector<std::byte>& outBytes) -> bool;
+        // Root-relative path of an asset in the bundle TOC; nullopt for assets outside the asset root.
+        auto toBundlePath(std::filesystem::path const& assetPath) const -> std::optional<std::string>;
+        static auto createAsset(AssetType type) -> std::shared_ptr<Asset>;
         auto initializeRegistry() -> void;
-        auto saveRegistry() -> void;
+        // Returns false only if the registry had unsaved changes and writing them failed.
+        auto saveRegistry() -> bool;
 
         auto importAssetInternal(
             std::filesystem::path const& sourcePath,
@@ -250,13 +511,29 @@ namespace april::asset
         ) -> bool;
 
         auto markDependentsDirty(core::UUID const& guid) -> void;
+        auto watchAsset(Asset const& asset, std::filesystem::path const& assetPath) -> void;
+        auto sweepSourceChanges() -> void;
+        auto reloadAsset(core::UUID const& guid, std::filesystem::path const& assetPath, bool assetFileChanged) -> std::shared_ptr<Asset>;
+        auto onAssetReloaded(core::UUID const& guid, AssetLoadRequest const& request) -> void;
 
         auto sanitizeAssetName(std::string name) const -> std::string;
 
         auto normalizePath(std::filesystem::path const& path) const -> std::string;
-        auto buildSourceKey(AssetType type, std::filesystem::path const& path) const -> std::string;
+        // Caller holds m_mutex; paths are already normalized.
+        auto indexPathsLocked(Asset const& asset, std::string const& sourcePath, std::string const& assetPath) -> void;
+
+        auto ensureImported(Asset const& asset, ImportSourceCache* sourceCache = nullptr) -> std::optional<std::string>;
+        auto resolveTextureKey(TextureAsset const& asset) -> std::optional<std::string>;
+        auto recordUsage(Asset const& asset, AssetUsageKind kind, std::string const& ddcKey = {}) -> void;
+        auto prefetchCookedData(Asset const& asset, std::string const& ddcKey) -> void;
+
+        static auto parseTextureBlob(std::span<std::byte const> blob, std::string const& name) -> TexturePayload;
+        static auto parseMeshBlob(std::span<std::byte const> blob, std::string const& name) -> MeshPayload;
 
-        auto ensureImported(Asset const& asset) -> std::optional<std::string>;
+        // Fetch the stored mesh blob (bundle or DDC) without decoding it.
+        auto readMeshBlob(StaticMeshAsset const& asset, std::vector<std::byte>& outBlob) -> bool;
+        // Rewrite a blob with MeshStorageFlags into the plain layout parseMeshBlob expects.
+        static auto decodeMeshBlob(std::vector<std::byte>& blob, std::string const& name) -> bool;
     };
 
 } // namespace april::asset
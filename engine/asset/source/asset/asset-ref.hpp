@@ -12,6 +12,8 @@ namespace april::asset
     {
         core::UUID guid{};
         uint32_t subId = 0;
+
+        auto operator == (AssetRef const& other) const -> bool = default;
     };
 
     auto to_json(nlohmann::json& j, AssetRef const& ref) -> void;
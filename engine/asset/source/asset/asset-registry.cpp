@@ -3,48 +3,321 @@
 #include <core/file/vfs.hpp>
 #include <core/log/logger.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 namespace april::asset
 {
-    auto AssetRegistry::registerAsset(Asset const& asset, std::string assetPath) -> void
+    namespace
+    {
+        using GuidBytes = std::array<uint8_t, 16>;
+
+        auto toGuidBytes(core::UUID const& guid) -> GuidBytes
+        {
+            auto bytes = GuidBytes{};
+            std::memcpy(bytes.data(), guid.getBytes().data(), bytes.size());
+            return bytes;
+        }
+
+        auto fromGuidBytes(GuidBytes const& bytes) -> core::UUID
+        {
+            return core::UUID{std::span<uint8_t const, 16>{bytes}};
+        }
+
+        template <typename T>
+        auto getSection(std::span<std::byte const> bytes, uint64_t offset, uint64_t count) -> std::optional<std::span<T const>>
+        {
+            if (offset > bytes.size() || count > (bytes.size() - offset) / sizeof(T))
+            {
+                return std::nullopt;
+            }
+
+            auto const* data = bytes.data() + offset;
+            if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0)
+            {
+                return std::nullopt;
+            }
+
+            return std::span<T const>{reinterpret_cast<T const*>(data), static_cast<size_t>(count)};
+        }
+
+        template <typename Map>
+        auto getSortedKeys(Map const& map) -> std::vector<typename Map::const_iterator>
+        {
+            auto keys = std::vector<typename Map::const_iterator>{};
+            keys.reserve(map.size());
+            for (auto it = map.begin(); it != map.end(); ++it)
+            {
+                keys.push_back(it);
+            }
+            std::ranges::sort(keys, {}, [](auto const& it) -> auto const& { return it->first; });
+            return keys;
+        }
+
+        class StringPoolBuilder
+        {
+        public:
+            auto add(std::string const& value) -> RegistryString
+            {
+                if (auto it = m_index.find(value); it != m_index.end())
+                {
+                    return it->second;
+                }
+
+                auto const reference = RegistryString{static_cast<uint32_t>(m_pool.size()), static_cast<uint32_t>(value.size())};
+                m_pool += value;
+                m_index.emplace(value, reference);
+                return reference;
+            }
+
+            [[nodiscard]] auto getPool() const -> std::string const& { return m_pool; }
+
+        private:
+            std::string m_pool{};
+            std::unordered_map<std::string, RegistryString> m_index{};
+        };
+    }
+
+    auto encodeRegistryImage(std::span<AssetRecord const* const> records) -> std::vector<std::byte>
+    {
+        auto sorted = std::vector<AssetRecord const*>{records.begin(), records.end()};
+        std::ranges::sort(sorted, {}, [](AssetRecord const* record) { return toGuidBytes(record->guid); });
+
+        auto entries = std::vector<RegistryRecordEntry>{};
+        auto dependencies = std::vector<RegistryDependency>{};
+        auto properties = std::vector<RegistryProperty>{};
+        auto strings = StringPoolBuilder{};
+        entries.reserve(sorted.size());
+
+        for (auto const* record : sorted)
+        {
+            auto& entry = entries.emplace_back();
+            entry.guid = toGuidBytes(record->guid);
+            entry.type = record->type;
+            entry.flags = record->lastImportFailed ? RegistryImportFailed : 0;
+            entry.assetPath = strings.add(record->assetPath);
+            entry.sourcePath = strings.add(record->sourcePath);
+            entry.sourceHash = strings.add(record->lastSourceHash);
+            entry.errorSummary = strings.add(record->lastErrorSummary);
+
+            entry.firstDependency = static_cast<uint32_t>(dependencies.size());
+            entry.dependencyCount = static_cast<uint32_t>(record->deps.size());
+            for (auto const& dep : record->deps)
+            {
+                dependencies.push_back(RegistryDependency{toGuidBytes(dep.asset.guid), dep.asset.subId, dep.kind});
+            }
+
+            // Hash map order is unspecified; sorting keeps identical registries byte-identical.
+            entry.firstProperty = static_cast<uint32_t>(properties.size());
+            for (auto const& it : getSortedKeys(record->lastFingerprint))
+            {
+                properties.push_back(RegistryProperty{RegistryPropertyKind::Fingerprint, strings.add(it->first), strings.add(it->second)});
+            }
+            for (auto const& it : getSortedKeys(record->ddcKeys))
+            {
+                auto const platform = strings.add(it->first);
+                for (auto const& key : it->second)
+                {
+                    properties.push_back(RegistryProperty{RegistryPropertyKind::DdcKey, platform, strings.add(key)});
+                }
+            }
+            entry.propertyCount = static_cast<uint32_t>(properties.size()) - entry.firstProperty;
+        }
+
+        auto const& pool = strings.getPool();
+        auto header = RegistryHeader{};
+        header.recordCount = static_cast<uint32_t>(entries.size());
+        header.dependencyCount = static_cast<uint32_t>(dependencies.size());
+        header.propertyCount = static_cast<uint32_t>(properties.size());
+        header.recordOffset = sizeof(RegistryHeader);
+        header.dependencyOffset = header.recordOffset + entries.size() * sizeof(RegistryRecordEntry);
+        header.propertyOffset = header.dependencyOffset + dependencies.size() * sizeof(RegistryDependency);
+        header.stringPoolOffset = header.propertyOffset + properties.size() * sizeof(RegistryProperty);
+        header.stringPoolSize = pool.size();
+
+        // Padded to 4 bytes so journal entries that follow each other stay aligned for in-place reads.
+        auto image = std::vector<std::byte>((header.stringPoolOffset + header.stringPoolSize + 3) & ~uint64_t{3});
+        std::memcpy(image.data(), &header, sizeof(RegistryHeader));
+        std::memcpy(image.data() + header.recordOffset, entries.data(), entries.size() * sizeof(RegistryRecordEntry));
+        std::memcpy(image.data() + header.dependencyOffset, dependencies.data(), dependencies.size() * sizeof(RegistryDependency));
+        std::memcpy(image.data() + header.propertyOffset, properties.data(), properties.size() * sizeof(RegistryProperty));
+        std::memcpy(image.data() + header.stringPoolOffset, pool.data(), pool.size());
+        return image;
+    }
+
+    auto RegistryImage::parse(std::span<std::byte const> bytes) -> std::optional<RegistryImage>
+    {
+        if (bytes.size() < sizeof(RegistryHeader))
+        {
+            return std::nullopt;
+        }
+
+        auto image = RegistryImage{};
+        std::memcpy(&image.header, bytes.data(), sizeof(RegistryHeader));
+        auto const& header = image.header;
+        if (!header.isValid() || header.stringPoolOffset > bytes.size() || header.stringPoolSize > bytes.size() - header.stringPoolOffset)
+        {
+            return std::nullopt;
+        }
+
+        auto const entries = getSection<RegistryRecordEntry>(bytes, header.recordOffset, header.recordCount);
+        auto const dependencies = getSection<RegistryDependency>(bytes, header.dependencyOffset, header.dependencyCount);
+        auto const properties = getSection<RegistryProperty>(bytes, header.propertyOffset, header.propertyCount);
+        if (!entries || !dependencies || !properties)
+        {
+            return std::nullopt;
+        }
+
+        image.entries = *entries;
+        image.dependencies = *dependencies;
+        image.properties = *properties;
+        image.stringPool = std::string_view{reinterpret_cast<char const*>(bytes.data() + header.stringPoolOffset), header.stringPoolSize};
+
+        // Everything is checked once here so lookups can index without bounds checks.
+        auto const isValidString = [&](RegistryString const& value)
+        {
+            return uint64_t{value.offset} + value.size <= header.stringPoolSize;
+        };
+
+        for (size_t i = 0; i < image.entries.size(); ++i)
+        {
+            auto const& entry = image.entries[i];
+            if ((i > 0 && !(image.entries[i - 1].guid < entry.guid)) ||
+                uint64_t{entry.firstDependency} + entry.dependencyCount > header.dependencyCount ||
+                uint64_t{entry.firstProperty} + entry.propertyCount > header.propertyCount ||
+                !isValidString(entry.assetPath) || !isValidString(entry.sourcePath) ||
+                !isValidString(entry.sourceHash) || !isValidString(entry.errorSummary))
+            {
+                return std::nullopt;
+            }
+        }
+
+        for (auto const& property : image.properties)
+        {
+            if (!isValidString(property.name) || !isValidString(property.value))
+            {
+                return std::nullopt;
+            }
+        }
+
+        return image;
+    }
+
+    auto RegistryImage::find(core::UUID const& guid) const -> RegistryRecordEntry const*
+    {
+        auto const key = toGuidBytes(guid);
+        auto it = std::lower_bound(entries.begin(), entries.end(), key,
+            [](RegistryRecordEntry const& entry, GuidBytes const& value)
+            {
+                return entry.guid < value;
+            });
+
+        if (it == entries.end() || it->guid != key)
+        {
+            return nullptr;
+        }
+
+        return &*it;
+    }
+
+    auto RegistryImage::decode(RegistryRecordEntry const& entry) const -> AssetRecord
     {
-        auto resolvedPath = std::move(assetPath);
         auto record = AssetRecord{};
-        record.guid = asset.getHandle();
-        record.assetPath = resolvedPath;
-        record.sourcePath = asset.getSourcePath();
-        record.type = asset.getType();
+        record.guid = fromGuidBytes(entry.guid);
+        record.assetPath = getString(entry.assetPath);
+        record.sourcePath = getString(entry.sourcePath);
+        record.type = entry.type;
+        record.lastSourceHash = getString(entry.sourceHash);
+        record.lastImportFailed = (entry.flags & RegistryImportFailed) != 0;
+        record.lastErrorSummary = getString(entry.errorSummary);
 
+        record.deps.reserve(entry.dependencyCount);
+        for (auto const& dep : dependencies.subspan(entry.firstDependency, entry.dependencyCount))
+        {
+            record.deps.push_back(Dependency{dep.kind, AssetRef{fromGuidBytes(dep.guid), dep.subId}});
+        }
+
+        for (auto const& property : properties.subspan(entry.firstProperty, entry.propertyCount))
+        {
+            auto name = std::string{getString(property.name)};
+            if (property.kind == RegistryPropertyKind::Fingerprint)
+            {
+                record.lastFingerprint[std::move(name)] = getString(property.value);
+            }
+            else if (property.kind == RegistryPropertyKind::DdcKey)
+            {
+                record.ddcKeys[std::move(name)].emplace_back(getString(property.value));
+            }
+        }
+
+        return record;
+    }
+
+    auto RegistryImage::getString(RegistryString const& value) const -> std::string_view
+    {
+        return stringPool.substr(value.offset, value.size);
+    }
+
+    auto AssetRegistry::registerAsset(Asset const& asset, std::string assetPath) -> void
+    {
         auto lock = std::scoped_lock{m_mutex};
-        if (auto it = m_records.find(record.guid); it != m_records.end())
+        auto existing = findRecordLocked(asset.getHandle());
+        if (existing && existing->assetPath == assetPath && existing->sourcePath == asset.getSourcePath() &&
+            existing->type == asset.getType())
         {
-            record = it->second;
-            record.guid = asset.getHandle();
-            record.assetPath = std::move(resolvedPath);
-            record.sourcePath = asset.getSourcePath();
-            record.type = asset.getType();
+            // Every scan registers every asset; unchanged ones must not grow the journal.
+            return;
         }
 
+        auto record = existing.value_or(AssetRecord{});
+        record.guid = asset.getHandle();
+        record.assetPath = std::move(assetPath);
+        record.sourcePath = asset.getSourcePath();
+        record.type = asset.getType();
+
+        appendJournalLocked(record);
         updateRecordLocked(std::move(record));
     }
 
     auto AssetRegistry::updateRecord(AssetRecord record) -> void
     {
         auto lock = std::scoped_lock{m_mutex};
+        if (auto existing = findRecordLocked(record.guid); existing && *existing == record)
+        {
+            return;
+        }
+
+        appendJournalLocked(record);
         updateRecordLocked(std::move(record));
     }
 
     auto AssetRegistry::findRecord(core::UUID const& guid) const -> std::optional<AssetRecord>
     {
         auto lock = std::scoped_lock{m_mutex};
-        auto it = m_records.find(guid);
-        if (it == m_records.end())
+        return findRecordLocked(guid);
+    }
+
+    auto AssetRegistry::findAssetPath(core::UUID const& guid) const -> std::optional<std::string>
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        if (auto it = m_records.find(guid); it != m_records.end())
         {
-            return std::nullopt;
+            return it->second.assetPath;
+        }
+
+        if (auto const* entry = m_image.find(guid))
+        {
+            return std::string{m_image.getString(entry->assetPath)};
         }
 
-        return it->second;
+        return std::nullopt;
+    }
+
+    auto AssetRegistry::contains(core::UUID const& guid) const -> bool
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        return m_records.contains(guid) || m_image.find(guid) != nullptr;
     }
 
     auto AssetRegistry::getDependents(core::UUID const& guid) const -> std::vector<core::UUID>
@@ -66,14 +339,182 @@ namespace april::asset
         return dependents;
     }
 
+    auto AssetRegistry::getRecords() const -> std::vector<AssetRecord>
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        return getRecordsLocked();
+    }
+
+    auto AssetRegistry::getRecordCount() const -> size_t
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        auto count = m_records.size();
+        for (auto const& entry : m_image.entries)
+        {
+            if (!m_records.contains(fromGuidBytes(entry.guid)))
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
     auto AssetRegistry::clear() -> void
     {
         auto lock = std::scoped_lock{m_mutex};
-        m_records.clear();
-        m_dependents.clear();
+        resetLocked();
     }
 
     auto AssetRegistry::load(std::filesystem::path const& path) -> bool
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        resetLocked();
+        m_path = path;
+
+        auto loaded = false;
+        if (VFS::existsFile(path.string()))
+        {
+            auto file = VFS::mapFile(path.string());
+            auto image = file ? RegistryImage::parse(file->getData()) : std::nullopt;
+            if (!image)
+            {
+                // The journal only holds changes on top of this image; without it they are meaningless.
+                AP_ERROR("[AssetRegistry] Invalid registry, discarding it: {}", path.string());
+                if (auto const journalPath = getJournalPath(path); VFS::existsFile(journalPath.string()))
+                {
+                    VFS::removeFile(journalPath.string());
+                }
+                return false;
+            }
+
+            m_file = std::move(file);
+            m_image = *image;
+            loaded = true;
+
+            for (auto const& entry : m_image.entries)
+            {
+                auto const guid = fromGuidBytes(entry.guid);
+                for (auto const& dep : m_image.dependencies.subspan(entry.firstDependency, entry.dependencyCount))
+                {
+                    if (dep.kind == DepKind::Strong)
+                    {
+                        m_dependents[fromGuidBytes(dep.guid)].insert(guid);
+                    }
+                }
+            }
+        }
+
+        if (auto const replayed = replayJournalLocked(); replayed > 0)
+        {
+            AP_INFO("[AssetRegistry] Replayed {} journaled records: {}", replayed, getJournalPath(path).string());
+            loaded = true;
+        }
+
+        return loaded;
+    }
+
+    auto AssetRegistry::save(std::filesystem::path const& path) -> bool
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        auto records = getRecordsLocked();
+        auto pointers = std::vector<AssetRecord const*>{};
+        pointers.reserve(records.size());
+        for (auto const& record : records)
+        {
+            pointers.push_back(&record);
+        }
+
+        auto const image = encodeRegistryImage(pointers);
+        auto tempPath = path;
+        tempPath += ".tmp";
+        if (!VFS::writeBinaryFile(tempPath.string(), image))
+        {
+            AP_ERROR("[AssetRegistry] Failed to write registry: {}", tempPath.string());
+            return false;
+        }
+
+        // Compacting replaces the mapped image, which has to be released first. Until the new one is
+        // mapped, records holds the only copy of everything.
+        auto const compact = !m_path.empty() && path == m_path;
+        auto const restore = [&]
+        {
+            for (auto& record : records)
+            {
+                auto const guid = record.guid;
+                m_records[guid] = std::move(record);
+            }
+        };
+
+        if (compact)
+        {
+            m_image = {};
+            m_file.reset();
+        }
+
+        if (VFS::existsFile(path.string()))
+        {
+            VFS::removeFile(path.string());
+        }
+
+        if (!VFS::rename(tempPath.string(), path.string()))
+        {
+            AP_ERROR("[AssetRegistry] Failed to finalize registry: {} -> {}", tempPath.string(), path.string());
+            VFS::removeFile(tempPath.string());
+            if (compact)
+            {
+                restore();
+            }
+            return false;
+        }
+
+        if (!compact)
+        {
+            return true;
+        }
+
+        m_journal.close();
+        if (auto const journalPath = getJournalPath(path); VFS::existsFile(journalPath.string()))
+        {
+            VFS::removeFile(journalPath.string());
+        }
+
+        auto file = VFS::mapFile(path.string());
+        auto parsed = file ? RegistryImage::parse(file->getData()) : std::nullopt;
+        if (!parsed)
+        {
+            AP_ERROR("[AssetRegistry] Failed to map saved registry: {}", path.string());
+            restore();
+            return false;
+        }
+
+        m_file = std::move(file);
+        m_image = *parsed;
+        m_records.clear();
+        return true;
+    }
+
+    auto AssetRegistry::exportJson(std::filesystem::path const& path) const -> bool
+    {
+        auto records = getRecords();
+        std::ranges::sort(records, {}, &AssetRecord::assetPath);
+
+        auto json = nlohmann::json::array();
+        for (auto const& record : records)
+        {
+            json.push_back(record);
+        }
+
+        if (!VFS::writeTextFile(path.string(), json.dump(4)))
+        {
+            AP_ERROR("[AssetRegistry] Failed to write registry: {}", path.string());
+            return false;
+        }
+
+        return true;
+    }
+
+    auto AssetRegistry::importJson(std::filesystem::path const& path) -> bool
     {
         if (!VFS::existsFile(path.string()))
         {
@@ -99,34 +540,135 @@ namespace april::asset
         }
 
         auto lock = std::scoped_lock{m_mutex};
-        m_records.clear();
-        m_dependents.clear();
         for (auto const& entry : json)
         {
-            auto record = entry.get<AssetRecord>();
-            m_records[record.guid] = std::move(record);
-            addDependentsLocked(m_records.at(record.guid));
+            updateRecordLocked(entry.get<AssetRecord>());
         }
 
         return true;
     }
 
-    auto AssetRegistry::save(std::filesystem::path const& path) const -> bool
+    auto AssetRegistry::getJournalPath(std::filesystem::path const& path) -> std::filesystem::path
     {
-        auto lock = std::scoped_lock{m_mutex};
-        auto json = nlohmann::json::array();
+        auto journalPath = path;
+        journalPath.replace_extension(".journal");
+        return journalPath;
+    }
+
+    auto AssetRegistry::findRecordLocked(core::UUID const& guid) const -> std::optional<AssetRecord>
+    {
+        if (auto it = m_records.find(guid); it != m_records.end())
+        {
+            return it->second;
+        }
+
+        if (auto const* entry = m_image.find(guid))
+        {
+            return m_image.decode(*entry);
+        }
+
+        return std::nullopt;
+    }
+
+    auto AssetRegistry::getRecordsLocked() const -> std::vector<AssetRecord>
+    {
+        auto records = std::vector<AssetRecord>{};
+        records.reserve(m_records.size() + m_image.entries.size());
         for (auto const& [guid, record] : m_records)
         {
-            json.push_back(record);
+            records.push_back(record);
         }
 
-        if (!VFS::writeTextFile(path.string(), json.dump(4)))
+        for (auto const& entry : m_image.entries)
         {
-            AP_ERROR("[AssetRegistry] Failed to write registry: {}", path.string());
-            return false;
+            if (!m_records.contains(fromGuidBytes(entry.guid)))
+            {
+                records.push_back(m_image.decode(entry));
+            }
         }
 
-        return true;
+        return records;
+    }
+
+    auto AssetRegistry::replayJournalLocked() -> size_t
+    {
+        auto const journalPath = getJournalPath(m_path);
+        if (!VFS::existsFile(journalPath.string()))
+        {
+            return 0;
+        }
+
+        auto const bytes = VFS::readBinaryFile(journalPath.string());
+        auto offset = size_t{0};
+        auto count = size_t{0};
+        while (offset + sizeof(uint32_t) <= bytes.size())
+        {
+            auto size = uint32_t{0};
+            std::memcpy(&size, bytes.data() + offset, sizeof(uint32_t));
+            auto const begin = offset + sizeof(uint32_t);
+            auto const image = size <= bytes.size() - begin
+                ? RegistryImage::parse(std::span<std::byte const>{bytes}.subspan(begin, size))
+                : std::nullopt;
+            if (!image)
+            {
+                break;
+            }
+
+            for (auto const& entry : image->entries)
+            {
+                updateRecordLocked(image->decode(entry));
+                ++count;
+            }
+            offset = begin + size;
+        }
+
+        if (offset != bytes.size())
+        {
+            // A write cut short by a crash; drop it so later appends stay readable.
+            AP_WARN("[AssetRegistry] Dropping {} bytes of damaged journal: {}", bytes.size() - offset, journalPath.string());
+            if (!VFS::writeBinaryFile(journalPath.string(), std::span<std::byte const>{bytes}.first(offset)))
+            {
+                VFS::removeFile(journalPath.string());
+            }
+        }
+
+        return count;
+    }
+
+    auto AssetRegistry::appendJournalLocked(AssetRecord const& record) -> void
+    {
+        if (m_path.empty())
+        {
+            return;
+        }
+
+        if (!m_journal.is_open())
+        {
+            auto const journalPath = VFS::resolvePath(getJournalPath(m_path).string());
+            m_journal.open(journalPath, std::ios::binary | std::ios::app);
+            if (!m_journal.is_open())
+            {
+                AP_WARN("[AssetRegistry] Failed to open journal: {}", journalPath.string());
+                return;
+            }
+        }
+
+        auto const* pointer = &record;
+        auto const image = encodeRegistryImage(std::span<AssetRecord const* const>{&pointer, 1});
+        auto const size = static_cast<uint32_t>(image.size());
+        m_journal.write(reinterpret_cast<char const*>(&size), sizeof(uint32_t));
+        m_journal.write(reinterpret_cast<char const*>(image.data()), static_cast<std::streamsize>(image.size()));
+        m_journal.flush();
+    }
+
+    auto AssetRegistry::resetLocked() -> void
+    {
+        m_journal.close();
+        m_image = {};
+        m_file.reset();
+        m_records.clear();
+        m_dependents.clear();
+        m_path.clear();
     }
 
     auto to_json(nlohmann::json& j, AssetRecord const& record) -> void
@@ -203,17 +745,15 @@ namespace april::asset
 
     auto AssetRegistry::updateRecordLocked(AssetRecord record) -> void
     {
-        auto const guid = record.guid;
-        if (auto it = m_records.find(guid); it != m_records.end())
+        if (auto previous = findRecordLocked(record.guid); previous.has_value())
         {
-            removeDependentsLocked(it->second);
-            it->second = std::move(record);
-            addDependentsLocked(it->second);
-            return;
+            removeDependentsLocked(*previous);
         }
 
-        m_records.emplace(guid, std::move(record));
-        addDependentsLocked(m_records.at(guid));
+        auto const guid = record.guid;
+        auto& stored = m_records[guid];
+        stored = std::move(record);
+        addDependentsLocked(stored);
     }
 
     auto AssetRegistry::addDependentsLocked(AssetRecord const& record) -> void
@@ -3,12 +3,19 @@
 #include "dependency.hpp"
 #include "asset.hpp"
 
+#include <core/file/mapped-file.hpp>
 #include <nlohmann/json.hpp>
 
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <optional>
 #include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -30,28 +37,183 @@ namespace april::asset
 
         bool lastImportFailed = false;
         std::string lastErrorSummary{};
+
+        auto operator == (AssetRecord const& other) const -> bool = default;
+    };
+
+    /**
+     * Binary registry layout:
+     * [RegistryHeader][RegistryRecordEntry[] sorted by GUID][RegistryDependency[]][RegistryProperty[]][string pool]
+     * Offsets in the header are absolute; string references and the dependency/property ranges of a
+     * record index into their section. The journal next to it is a sequence of [uint32 size][registry image]
+     * entries, each holding the updated records of one change.
+     */
+    struct RegistryHeader
+    {
+        static constexpr uint32_t kMagic = 0x41505247; // "APRG" - April Registry
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint32_t recordCount = 0;
+        uint32_t dependencyCount = 0;
+        uint32_t propertyCount = 0;
+        uint32_t reserved = 0;
+        uint64_t recordOffset = 0;
+        uint64_t dependencyOffset = 0;
+        uint64_t propertyOffset = 0;
+        uint64_t stringPoolOffset = 0;
+        uint64_t stringPoolSize = 0;
+
+        [[nodiscard]] auto isValid() const -> bool
+        {
+            return magic == kMagic && version == kVersion;
+        }
+    };
+
+    static_assert(sizeof(RegistryHeader) == 64, "RegistryHeader size mismatch");
+
+    struct RegistryString
+    {
+        uint32_t offset = 0;    // Into the string pool
+        uint32_t size = 0;
+    };
+
+    enum RegistryRecordFlags : uint8_t
+    {
+        RegistryImportFailed = 1
+    };
+
+    struct RegistryRecordEntry
+    {
+        std::array<uint8_t, 16> guid{};
+        AssetType type{AssetType::None};
+        uint8_t flags = 0;
+        uint8_t reserved[2]{};
+        uint32_t firstDependency = 0;
+        uint32_t dependencyCount = 0;
+        uint32_t firstProperty = 0;
+        uint32_t propertyCount = 0;
+        RegistryString assetPath{};
+        RegistryString sourcePath{};
+        RegistryString sourceHash{};
+        RegistryString errorSummary{};
+        uint32_t reserved2 = 0;
+    };
+
+    static_assert(sizeof(RegistryRecordEntry) == 72, "RegistryRecordEntry size mismatch");
+
+    struct RegistryDependency
+    {
+        std::array<uint8_t, 16> guid{};
+        uint32_t subId = 0;
+        DepKind kind{DepKind::Strong};
+        uint8_t reserved[3]{};
     };
 
+    static_assert(sizeof(RegistryDependency) == 24, "RegistryDependency size mismatch");
+
+    enum struct RegistryPropertyKind : uint32_t
+    {
+        Fingerprint,    // name = platform, value = fingerprint
+        DdcKey          // name = platform, value = one key; a platform's keys are stored in order
+    };
+
+    struct RegistryProperty
+    {
+        RegistryPropertyKind kind{RegistryPropertyKind::Fingerprint};
+        RegistryString name{};
+        RegistryString value{};
+    };
+
+    static_assert(sizeof(RegistryProperty) == 20, "RegistryProperty size mismatch");
+
+    /**
+     * Read-only view of a registry image, either the mapped registry file or one journal entry.
+     */
+    struct RegistryImage
+    {
+        RegistryHeader header{};
+        std::span<RegistryRecordEntry const> entries{};
+        std::span<RegistryDependency const> dependencies{};
+        std::span<RegistryProperty const> properties{};
+        std::string_view stringPool{};
+
+        /**
+         * Validate bytes as a registry image. The view borrows bytes, which must stay alive.
+         */
+        [[nodiscard]] static auto parse(std::span<std::byte const> bytes) -> std::optional<RegistryImage>;
+
+        [[nodiscard]] auto find(core::UUID const& guid) const -> RegistryRecordEntry const*;
+        [[nodiscard]] auto decode(RegistryRecordEntry const& entry) const -> AssetRecord;
+        [[nodiscard]] auto getString(RegistryString const& value) const -> std::string_view;
+    };
+
+    /**
+     * Serialize records as a registry image, sorted by GUID with a deduplicated string pool.
+     */
+    [[nodiscard]] auto encodeRegistryImage(std::span<AssetRecord const* const> records) -> std::vector<std::byte>;
+
+    /**
+     * GUID-keyed asset metadata. The persistent registry is memory mapped and searched in place;
+     * records changed since the last save live in memory and are appended to a journal, which save()
+     * folds back into a fresh image.
+     */
     class AssetRegistry
     {
     public:
         auto registerAsset(Asset const& asset, std::string assetPath) -> void;
         auto updateRecord(AssetRecord record) -> void;
         [[nodiscard]] auto findRecord(core::UUID const& guid) const -> std::optional<AssetRecord>;
+        [[nodiscard]] auto findAssetPath(core::UUID const& guid) const -> std::optional<std::string>;
+        [[nodiscard]] auto contains(core::UUID const& guid) const -> bool;
         [[nodiscard]] auto getDependents(core::UUID const& guid) const -> std::vector<core::UUID>;
+        [[nodiscard]] auto getRecords() const -> std::vector<AssetRecord>;
+        [[nodiscard]] auto getRecordCount() const -> size_t;
         auto clear() -> void;
 
+        /**
+         * Map the registry at path and replay its journal. Later updates are journaled next to it.
+         * Returns false if neither exists or the registry is unreadable.
+         */
         auto load(std::filesystem::path const& path) -> bool;
-        auto save(std::filesystem::path const& path) const -> bool;
+
+        /**
+         * Write every record as a new image. Saving to the loaded path also empties the journal.
+         */
+        auto save(std::filesystem::path const& path) -> bool;
+
+        /**
+         * Readable dump for debugging, and the format used before the binary registry.
+         */
+        auto exportJson(std::filesystem::path const& path) const -> bool;
+        auto importJson(std::filesystem::path const& path) -> bool;
+
+        [[nodiscard]] static auto getJournalPath(std::filesystem::path const& path) -> std::filesystem::path;
 
     private:
+        [[nodiscard]] auto findRecordLocked(core::UUID const& guid) const -> std::optional<AssetRecord>;
+        [[nodiscard]] auto getRecordsLocked() const -> std::vector<AssetRecord>;
+        auto replayJournalLocked() -> size_t;
+        auto appendJournalLocked(AssetRecord const& record) -> void;
+        auto resetLocked() -> void;
+
         auto updateRecordLocked(AssetRecord record) -> void;
         auto addDependentsLocked(AssetRecord const& record) -> void;
         auto removeDependentsLocked(AssetRecord const& record) -> void;
 
         mutable std::mutex m_mutex{};
+
+        // Saved image, searched in place.
+        std::shared_ptr<MappedFile> m_file{};
+        RegistryImage m_image{};
+
+        // Records changed since the image was written; these shadow the image.
         std::unordered_map<core::UUID, AssetRecord> m_records{};
         std::unordered_map<core::UUID, std::unordered_set<core::UUID>> m_dependents{};
+
+        std::filesystem::path m_path{};
+        std::ofstream m_journal{};
     };
 
     auto to_json(nlohmann::json& j, AssetRecord const& record) -> void;
@@ -0,0 +1,107 @@
+#include "asset-usage.hpp"
+
+#include <core/file/vfs.hpp>
+#include <core/log/logger.hpp>
+
+#include <utility>
+
+namespace april::asset
+{
+    auto AssetUsageManifest::load(std::filesystem::path const& path) -> bool
+    {
+        entries.clear();
+        if (!VFS::existsFile(path.string()))
+        {
+            return false;
+        }
+
+        auto const json = nlohmann::json::parse(VFS::readTextFile(path.string()), nullptr, false);
+        if (json.is_discarded() || json.value("version", 0) != kVersion || !json.contains("entries") || !json["entries"].is_array())
+        {
+            AP_WARN("[AssetUsage] Ignoring invalid usage manifest: {}", path.string());
+            return false;
+        }
+
+        entries.reserve(json["entries"].size());
+        for (auto const& item : json["entries"])
+        {
+            if (!item.is_object() || !item.contains("guid"))
+            {
+                continue;
+            }
+
+            auto entry = AssetUsageEntry{};
+            entry.guid = core::UUID{item["guid"].get<std::string>()};
+            entry.type = item.value("type", AssetType::None);
+            entry.kind = item.value("kind", AssetUsageKind::Metadata);
+            entry.ddcKey = item.value("ddcKey", std::string{});
+            entry.timeMs = item.value("timeMs", 0.0);
+            entries.push_back(std::move(entry));
+        }
+        return true;
+    }
+
+    auto AssetUsageManifest::save(std::filesystem::path const& path) const -> bool
+    {
+        auto items = nlohmann::json::array();
+        for (auto const& entry : entries)
+        {
+            auto item = nlohmann::json{
+                {"guid", entry.guid.toString()},
+                {"type", entry.type},
+                {"kind", entry.kind},
+                {"timeMs", entry.timeMs}
+            };
+            if (!entry.ddcKey.empty())
+            {
+                item["ddcKey"] = entry.ddcKey;
+            }
+            items.push_back(std::move(item));
+        }
+
+        auto json = nlohmann::json{{"version", kVersion}, {"entries", std::move(items)}};
+        if (!VFS::writeTextFile(path.string(), json.dump(2)))
+        {
+            AP_ERROR("[AssetUsage] Failed to write usage manifest: {}", path.string());
+            return false;
+        }
+        return true;
+    }
+
+    auto AssetUsageRecorder::start() -> void
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        m_start = core::Timer::now();
+        m_seenKinds.clear();
+        m_entries.clear();
+        m_recording.store(true, std::memory_order_relaxed);
+    }
+
+    auto AssetUsageRecorder::stop() -> AssetUsageManifest
+    {
+        auto lock = std::scoped_lock{m_mutex};
+        m_recording.store(false, std::memory_order_relaxed);
+        m_seenKinds.clear();
+        return AssetUsageManifest{std::exchange(m_entries, {})};
+    }
+
+    auto AssetUsageRecorder::record(core::UUID const& guid, AssetType type, AssetUsageKind kind, std::string const& ddcKey) -> void
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        auto const now = core::Timer::now();
+        auto const bit = static_cast<uint8_t>(1u << static_cast<uint8_t>(kind));
+        auto lock = std::scoped_lock{m_mutex};
+        auto& seen = m_seenKinds[guid];
+        if (!isRecording() || (seen & bit) != 0)
+        {
+            return;
+        }
+
+        seen |= bit;
+        m_entries.push_back({guid, type, kind, ddcKey, core::Timer::calcDuration(m_start, now)});
+    }
+} // namespace april::asset
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "asset.hpp"
+
+#include <core/profile/timer.hpp>
+#include <core/tools/uuid.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace april::asset
+{
+    enum struct AssetUsageKind : uint8_t
+    {
+        Metadata,   // The .asset file (or bundle metadata) was loaded
+        CookedData  // The cooked payload was read
+    };
+
+    NLOHMANN_JSON_SERIALIZE_ENUM( AssetUsageKind, {
+        {AssetUsageKind::Metadata, "Metadata"},
+        {AssetUsageKind::CookedData, "CookedData"},
+    })
+
+    struct AssetUsageEntry
+    {
+        core::UUID guid{};
+        AssetType type{AssetType::None};
+        AssetUsageKind kind{AssetUsageKind::Metadata};
+        std::string ddcKey{};   // Key the cooked data was read from; empty for metadata and in bundle mode
+        double timeMs{0.0};     // Since recording started
+    };
+
+    /**
+     * Assets a session touched, in the order it first touched them. Saved next to the scene it was
+     * recorded for, so later runs can prefetch the same data before it is asked for.
+     */
+    struct AssetUsageManifest
+    {
+        static constexpr int kVersion = 1;
+
+        std::vector<AssetUsageEntry> entries{};
+
+        auto load(std::filesystem::path const& path) -> bool;
+        auto save(std::filesystem::path const& path) const -> bool;
+    };
+
+    /**
+     * Thread-safe recorder of first touches. Each asset is logged at most once per kind.
+     */
+    class AssetUsageRecorder
+    {
+    public:
+        auto start() -> void;
+        auto stop() -> AssetUsageManifest;
+        [[nodiscard]] auto isRecording() const -> bool { return m_recording.load(std::memory_order_relaxed); }
+
+        auto record(core::UUID const& guid, AssetType type, AssetUsageKind kind, std::string const& ddcKey = {}) -> void;
+
+    private:
+        std::atomic<bool> m_recording{false};
+        std::mutex m_mutex{};
+        core::Timer::TimePoint m_start{};
+        std::unordered_map<core::UUID, uint8_t> m_seenKinds{};  // Bit per AssetUsageKind
+        std::vector<AssetUsageEntry> m_entries{};
+    };
+} // namespace april::asset
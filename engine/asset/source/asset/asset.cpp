@@ -31,6 +31,12 @@ namespace april::asset
     auto Asset::getReferences() const -> std::vector<AssetRef> const& { return m_references; }
     auto Asset::setReferences(std::vector<AssetRef> references) -> void { m_references = std::move(references); }
 
+    auto Asset::getMemoryUsage() const -> size_t
+    {
+        return sizeof(Asset) + m_sourcePath.capacity() + m_assetPath.capacity() + m_importerChain.capacity() +
+            m_references.capacity() * sizeof(AssetRef);
+    }
+
     auto Asset::serializeJson(nlohmann::json& outJson) -> void
     {
         outJson["guid"] = m_handle.toString();
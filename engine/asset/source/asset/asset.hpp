@@ -16,7 +16,8 @@ namespace april::asset
         Texture,
         Mesh,
         Shader,
-        Material
+        Material,
+        Scene
     };
 
     NLOHMANN_JSON_SERIALIZE_ENUM( AssetType, {
@@ -25,6 +26,7 @@ namespace april::asset
         {AssetType::Mesh, "Mesh"},
         {AssetType::Shader, "Shader"},
         {AssetType::Material, "Material"},
+        {AssetType::Scene, "Scene"},
     })
 
     class Asset
@@ -52,6 +54,12 @@ namespace april::asset
         virtual auto serializeJson(nlohmann::json& outJson) -> void;
         virtual auto deserializeJson(nlohmann::json const& inJson) -> bool;
 
+        /**
+         * Approximate CPU bytes held by this asset, charged against the asset cache budget.
+         * Types with their own heap data add it to the base estimate.
+         */
+        [[nodiscard]] virtual auto getMemoryUsage() const -> size_t;
+
     protected:
         Asset(AssetType type);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <cstddef>
 #include <span>
@@ -17,6 +18,27 @@ namespace april::asset
         RG8Unorm = 5,
         RGBA8Unorm = 8,
         RGBA8UnormSrgb = 13,
+        BC1Unorm = 55,
+        BC1UnormSrgb = 56,
+        BC3Unorm = 59,
+        BC3UnormSrgb = 60,
+        BC4Unorm = 61,
+        BC5Unorm = 63,
+        BC7Unorm = 67,
+        BC7UnormSrgb = 68,
+    };
+
+    /**
+     * Bits in TextureHeader::flags. Everything except TextureSrgb describes the cook-time content analysis;
+     * the value ranges are only meaningful when TextureAnalyzed is set.
+     */
+    enum TextureFlags : uint32_t
+    {
+        TextureSrgb        = 1u << 0,  // Format stores sRGB-encoded color
+        TextureAnalyzed    = 1u << 1,  // minValue/maxValue hold the source range
+        TextureConstant    = 1u << 2,  // Every source texel equals minValue; the blob holds a single 1x1 texel
+        TextureOpaqueAlpha = 1u << 3,  // Source alpha is 255 everywhere
+        TextureGrayscale   = 1u << 4,  // Source R == G == B everywhere
     };
 
     /**
@@ -26,24 +48,32 @@ namespace april::asset
     struct TextureHeader
     {
         static constexpr uint32_t kMagic = 0x41505458; // "APTX" - April Texture
+        static constexpr uint32_t kVersion = 2;
 
         uint32_t magic = kMagic;
-        uint32_t version = 1;
+        uint32_t version = kVersion;
         uint32_t width = 0;
         uint32_t height = 0;
         uint32_t channels = 0;
         PixelFormat format = PixelFormat::Unknown;
         uint32_t mipLevels = 1;
-        uint32_t flags = 0;         // Reserved for future use (e.g., sRGB flag)
+        uint32_t flags = 0;         // TextureFlags
         uint64_t dataSize = 0;      // Size of pixel data in bytes
+        std::array<uint8_t, 4> minValue{};  // Per-channel source range (RGBA8, as stored), see TextureAnalyzed
+        std::array<uint8_t, 4> maxValue{};
 
         [[nodiscard]] auto isValid() const -> bool
         {
-            return magic == kMagic && version == 1 && width > 0 && height > 0;
+            return magic == kMagic && version == kVersion && width > 0 && height > 0;
+        }
+
+        [[nodiscard]] auto isChannelConstant(size_t channel) const -> bool
+        {
+            return (flags & TextureAnalyzed) != 0 && minValue[channel] == maxValue[channel];
         }
     };
 
-    static_assert(sizeof(TextureHeader) == 40, "TextureHeader must be 40 bytes for binary compatibility");
+    static_assert(sizeof(TextureHeader) == 48, "TextureHeader must be 48 bytes for binary compatibility");
 
     /**
      * Texture data payload returned from AssetManager.
@@ -54,6 +84,11 @@ namespace april::asset
         TextureHeader header{};
         std::span<std::byte const> pixelData{};
 
+        // Set when only part of the chain was read: header then describes mips [firstMip, storedHeader.mipLevels)
+        // of the cooked texture, and storedHeader is its full header.
+        uint32_t firstMip{0};
+        TextureHeader storedHeader{};
+
         [[nodiscard]] auto isValid() const -> bool
         {
             return header.isValid() && !pixelData.empty();
@@ -68,8 +103,75 @@ namespace april::asset
     {
         HasTexCoord1 = 1 << 0,  // Secondary UV channel (lightmap, etc.)
         HasColor     = 1 << 1,  // Vertex color (RGBA float)
+        Compact      = 1 << 2,  // kCompactVertexAttributes layout instead of kStandardVertexAttributes
     };
 
+    /**
+     * Storage flags in MeshHeader::flags, above the VertexFlags byte. They only describe the bytes on disk:
+     * AssetManager decodes both sections before handing out a MeshPayload, so payloads never carry them.
+     */
+    enum MeshStorageFlags : uint32_t
+    {
+        EncodedVertexData = 1u << 8,  // meshopt vertex codec; vertexDataSize is the encoded size
+        EncodedIndexData  = 1u << 9,  // meshopt index codec; indexDataSize is the encoded size
+    };
+
+    enum class VertexAttributeFormat : uint8_t
+    {
+        Float2,
+        Float3,
+        Float4,
+        Half2,      // 2 x float16
+        Unorm16x4,  // 4 x uint16, normalized to [0, 1]
+        Snorm16x2,  // 2 x int16, normalized to [-1, 1]
+    };
+
+    struct VertexAttribute
+    {
+        char const* semantic{nullptr};
+        uint32_t offset{0};
+        VertexAttributeFormat format{VertexAttributeFormat::Float4};
+    };
+
+    inline constexpr uint32_t kStandardVertexStride = 48;
+    inline constexpr uint32_t kCompactVertexStride = 20;
+
+    inline constexpr auto kStandardVertexAttributes = std::array{
+        VertexAttribute{"POSITION", 0, VertexAttributeFormat::Float3},
+        VertexAttribute{"NORMAL", 12, VertexAttributeFormat::Float3},
+        VertexAttribute{"TANGENT", 24, VertexAttributeFormat::Float4},  // w = bitangent sign
+        VertexAttribute{"TEXCOORD", 40, VertexAttributeFormat::Float2},
+    };
+
+    /**
+     * Compact layout. Positions are quantized inside the header bounds: p = boundsMin + xyz * (boundsMax - boundsMin).
+     * POSITION.w holds the bitangent sign (0 = -1, 1 = +1). Normal and tangent are octahedral encoded.
+     */
+    inline constexpr auto kCompactVertexAttributes = std::array{
+        VertexAttribute{"POSITION", 0, VertexAttributeFormat::Unorm16x4},
+        VertexAttribute{"NORMAL", 8, VertexAttributeFormat::Snorm16x2},
+        VertexAttribute{"TANGENT", 12, VertexAttributeFormat::Snorm16x2},
+        VertexAttribute{"TEXCOORD", 16, VertexAttributeFormat::Half2},
+    };
+
+    struct CompactVertex
+    {
+        uint16_t position[4];  // Unorm16 xyz in bounds, w = bitangent sign
+        int16_t normal[2];     // Snorm16 octahedral
+        int16_t tangent[2];    // Snorm16 octahedral
+        uint16_t texCoord[2];  // float16
+    };
+    static_assert(sizeof(CompactVertex) == kCompactVertexStride);
+
+    [[nodiscard]] inline auto getVertexAttributes(uint32_t flags) -> std::span<VertexAttribute const>
+    {
+        if (flags & VertexFlags::Compact)
+        {
+            return kCompactVertexAttributes;
+        }
+        return kStandardVertexAttributes;
+    }
+
     /**
      * Submesh definition within a mesh asset.
      * Represents a contiguous range of indices with an associated material.
@@ -81,9 +183,70 @@ namespace april::asset
         uint32_t materialIndex = 0;   // Material slot
     };
 
+    /**
+     * Simplified index range of one submesh at one level of detail (LOD 1 and up; LOD 0 is the Submesh itself).
+     * Ranges index the same vertex buffer and live in the shared index buffer after the full-detail indices.
+     */
+    struct SubmeshLod
+    {
+        uint32_t indexOffset = 0;     // Offset in index buffer
+        uint32_t indexCount = 0;      // Number of indices
+        float error = 0.0f;           // Object-space geometric deviation from LOD 0
+    };
+
+    /**
+     * Cluster of up to a few hundred triangles with culling bounds, built from the full-detail submesh ranges.
+     * Vertices index the mesh vertex buffer through the meshlet vertex list; triangles are 3 bytes of local
+     * vertex indices each, and every meshlet's triangle bytes start on a 4-byte boundary.
+     */
+    struct Meshlet
+    {
+        uint32_t vertexOffset = 0;          // First entry in the meshlet vertex list
+        uint32_t triangleOffset = 0;        // First byte in the meshlet triangle list
+        uint32_t vertexCount = 0;
+        uint32_t triangleCount = 0;
+        float center[3] = {0, 0, 0};        // Bounding sphere
+        float radius = 0.0f;
+        float coneApex[3] = {0, 0, 0};      // Normal cone; backfacing when dot(normalize(apex - eye), axis) >= cutoff
+        float coneAxis[3] = {0, 0, 0};
+        float coneCutoff = 1.0f;            // cos(half angle); 1 means the cone is too wide to cull
+        uint32_t submeshIndex = 0;          // Submesh (and therefore material) the triangles come from
+    };
+
+    static_assert(sizeof(Meshlet) == 64, "Meshlet must be 64 bytes for binary compatibility");
+
+    /**
+     * Header of the optional meshlet section at the end of a mesh blob.
+     * Binary format: [MeshletSectionHeader][Meshlet[]...][uint32 vertex list...][uint8 triangle list...]
+     */
+    struct MeshletSectionHeader
+    {
+        static constexpr uint32_t kMagic = 0x41504D4C; // "APML" - April Meshlets
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint32_t meshletCount = 0;
+        uint32_t vertexCount = 0;           // Entries in the meshlet vertex list
+        uint32_t triangleByteCount = 0;     // Bytes in the meshlet triangle list (multiple of 4)
+        uint32_t maxVertices = 0;           // Build limits, for consumers sizing mesh shader groups
+        uint32_t maxTriangles = 0;
+        uint32_t reserved = 0;
+
+        [[nodiscard]] auto isValid() const -> bool
+        {
+            return magic == kMagic && version == kVersion;
+        }
+    };
+
+    static_assert(sizeof(MeshletSectionHeader) == 32, "MeshletSectionHeader must be 32 bytes for binary compatibility");
+
     /**
      * Standard layout header for compiled mesh blobs.
-     * Binary format: [MeshHeader][Submesh[]...][vertex data...][index data...]
+     * Binary format: [MeshHeader][Submesh[]...][SubmeshLod[]...][vertex data...][index data...][meshlet section]
+     * The LOD table holds (lodCount - 1) entries per submesh, submesh-major. The meshlet section is present when
+     * meshletSectionSize is non-zero. The index and meshlet sections start on 4-byte boundaries; 16-bit index
+     * data is padded to a multiple of 4 and indexDataSize includes the padding.
      */
     struct MeshHeader
     {
@@ -93,15 +256,16 @@ namespace april::asset
         uint32_t version = 1;
         uint32_t vertexCount = 0;
         uint32_t indexCount = 0;
-        uint32_t vertexStride = 0;      // 48+ bytes based on flags
+        uint32_t vertexStride = 0;      // kStandardVertexStride or kCompactVertexStride, see flags
         uint32_t indexFormat = 0;       // 0=uint16, 1=uint32
         uint32_t submeshCount = 0;
-        uint32_t flags = 0;             // VertexFlags
+        uint32_t flags = 0;             // VertexFlags | MeshStorageFlags
         float boundsMin[3] = {0, 0, 0}; // AABB min
         float boundsMax[3] = {0, 0, 0}; // AABB max
         uint64_t vertexDataSize = 0;
         uint64_t indexDataSize = 0;
-        uint64_t reserved = 0;          // Reserved for future use (padding to 80 bytes)
+        uint32_t lodCount = 1;          // Levels of detail including LOD 0 (0 in older blobs means 1)
+        uint32_t meshletSectionSize = 0; // Bytes of the trailing meshlet section (0 = none)
 
         [[nodiscard]] auto isValid() const -> bool
         {
@@ -119,8 +283,12 @@ namespace april::asset
     {
         MeshHeader header{};
         std::span<Submesh const> submeshes{};
+        std::span<SubmeshLod const> lods{};
         std::span<std::byte const> vertexData{};
         std::span<std::byte const> indexData{};
+        std::span<Meshlet const> meshlets{};
+        std::span<uint32_t const> meshletVertices{};
+        std::span<uint8_t const> meshletTriangles{};
 
         [[nodiscard]] auto isValid() const -> bool
         {
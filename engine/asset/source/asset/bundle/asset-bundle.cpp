@@ -0,0 +1,326 @@
+#include "asset-bundle.hpp"
+
+#include <core/file/vfs.hpp>
+#include <core/log/logger.hpp>
+#include <core/tools/alignment.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace april::asset
+{
+    namespace
+    {
+        auto toGuidBytes(core::UUID const& guid) -> std::array<uint8_t, 16>
+        {
+            auto bytes = std::array<uint8_t, 16>{};
+            std::memcpy(bytes.data(), guid.getBytes().data(), bytes.size());
+            return bytes;
+        }
+
+        auto writePadding(std::ofstream& stream, uint64_t from, uint64_t to) -> void
+        {
+            static constexpr auto kZeros = std::array<char, 4096>{};
+            while (from < to)
+            {
+                auto const chunk = std::min<uint64_t>(to - from, kZeros.size());
+                stream.write(kZeros.data(), static_cast<std::streamsize>(chunk));
+                from += chunk;
+            }
+        }
+    }
+
+    auto AssetBundle::open(std::filesystem::path const& path) -> bool
+    {
+        auto file = VFS::mapFile(path.string());
+        if (!file)
+        {
+            AP_ERROR("[AssetBundle] Failed to map bundle: {}", path.string());
+            return false;
+        }
+
+        auto const bytes = file->getData();
+        if (bytes.size() < sizeof(BundleHeader))
+        {
+            AP_ERROR("[AssetBundle] Bundle too small: {}", path.string());
+            return false;
+        }
+
+        std::memcpy(&m_header, bytes.data(), sizeof(BundleHeader));
+        if (!m_header.isValid())
+        {
+            AP_ERROR("[AssetBundle] Invalid bundle header: {}", path.string());
+            return false;
+        }
+
+        auto const tocSize = static_cast<uint64_t>(m_header.entryCount) * sizeof(BundleTocEntry);
+        if (m_header.tocOffset + tocSize > bytes.size() ||
+            m_header.metadataOffset + m_header.metadataSize > bytes.size() ||
+            m_header.stringPoolOffset + m_header.stringPoolSize > bytes.size())
+        {
+            AP_ERROR("[AssetBundle] Truncated bundle: {}", path.string());
+            return false;
+        }
+
+        m_file = std::move(file);
+        m_entries = std::span<BundleTocEntry const>{
+            reinterpret_cast<BundleTocEntry const*>(bytes.data() + m_header.tocOffset),
+            m_header.entryCount
+        };
+
+        m_pathIndex.clear();
+        m_pathIndex.reserve(m_entries.size());
+        for (uint32_t i = 0; i < m_entries.size(); ++i)
+        {
+            m_pathIndex.emplace(getPath(m_entries[i]), i);
+        }
+
+        AP_INFO("[AssetBundle] Mounted bundle: {} ({} assets, target {})",
+                path.string(), m_entries.size(), getTargetId());
+        return true;
+    }
+
+    auto AssetBundle::getTargetId() const -> std::string_view
+    {
+        if (!m_file || m_header.targetIdOffset + m_header.targetIdSize > m_header.stringPoolSize)
+        {
+            return {};
+        }
+
+        auto const* pool = reinterpret_cast<char const*>(m_file->getData().data() + m_header.stringPoolOffset);
+        return std::string_view{pool + m_header.targetIdOffset, m_header.targetIdSize};
+    }
+
+    auto AssetBundle::find(core::UUID const& guid) const -> BundleTocEntry const*
+    {
+        auto const key = toGuidBytes(guid);
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key,
+            [](BundleTocEntry const& entry, std::array<uint8_t, 16> const& value)
+            {
+                return entry.guid < value;
+            });
+
+        if (it == m_entries.end() || it->guid != key)
+        {
+            return nullptr;
+        }
+
+        return &*it;
+    }
+
+    auto AssetBundle::findByPath(std::string const& bundlePath) const -> BundleTocEntry const*
+    {
+        auto it = m_pathIndex.find(bundlePath);
+        if (it == m_pathIndex.end())
+        {
+            return nullptr;
+        }
+
+        return &m_entries[it->second];
+    }
+
+    auto AssetBundle::getMetadata(BundleTocEntry const& entry) const -> std::span<std::byte const>
+    {
+        auto const bytes = m_file->getData();
+        if (entry.metadataOffset + entry.metadataSize > bytes.size())
+        {
+            return {};
+        }
+
+        return bytes.subspan(entry.metadataOffset, entry.metadataSize);
+    }
+
+    auto AssetBundle::getPayload(BundleTocEntry const& entry) const -> std::span<std::byte const>
+    {
+        auto const bytes = m_file->getData();
+        if (entry.payloadSize == 0 || entry.payloadOffset + entry.payloadSize > bytes.size())
+        {
+            return {};
+        }
+
+        return bytes.subspan(entry.payloadOffset, entry.payloadSize);
+    }
+
+    auto AssetBundle::prefetchPayload(BundleTocEntry const& entry) const -> void
+    {
+        m_file->prefetch(entry.payloadOffset, entry.payloadSize);
+    }
+
+    auto AssetBundle::getPath(BundleTocEntry const& entry) const -> std::string_view
+    {
+        if (entry.pathOffset + entry.pathSize > m_header.stringPoolSize)
+        {
+            return {};
+        }
+
+        auto const* pool = reinterpret_cast<char const*>(m_file->getData().data() + m_header.stringPoolOffset);
+        return std::string_view{pool + entry.pathOffset, entry.pathSize};
+    }
+
+    auto AssetBundleWriter::addEntry(Entry entry) -> void
+    {
+        m_entries.push_back(std::move(entry));
+    }
+
+    auto AssetBundleWriter::computeLoadOrder() const -> std::vector<size_t>
+    {
+        auto indexByGuid = std::unordered_map<core::UUID, size_t>{};
+        auto referenced = std::unordered_set<core::UUID>{};
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            indexByGuid.emplace(m_entries[i].guid, i);
+            for (auto const& ref : m_entries[i].references)
+            {
+                referenced.insert(ref);
+            }
+        }
+
+        auto order = std::vector<size_t>{};
+        order.reserve(m_entries.size());
+        auto visited = std::vector<bool>(m_entries.size(), false);
+
+        auto visit = [&](size_t root) -> void
+        {
+            auto stack = std::vector<size_t>{root};
+            while (!stack.empty())
+            {
+                auto const index = stack.back();
+                stack.pop_back();
+                if (visited[index])
+                {
+                    continue;
+                }
+
+                visited[index] = true;
+                order.push_back(index);
+
+                auto const& references = m_entries[index].references;
+                for (auto it = references.rbegin(); it != references.rend(); ++it)
+                {
+                    if (auto found = indexByGuid.find(*it); found != indexByGuid.end() && !visited[found->second])
+                    {
+                        stack.push_back(found->second);
+                    }
+                }
+            }
+        };
+
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            if (!referenced.contains(m_entries[i].guid))
+            {
+                visit(i);
+            }
+        }
+
+        // Anything left is part of a reference cycle.
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            visit(i);
+        }
+
+        return order;
+    }
+
+    auto AssetBundleWriter::write(std::filesystem::path const& path) const -> bool
+    {
+        auto header = BundleHeader{};
+        header.entryCount = static_cast<uint32_t>(m_entries.size());
+
+        auto toc = std::vector<BundleTocEntry>(m_entries.size());
+        auto metadata = std::vector<std::byte>{};
+        auto stringPool = std::string{};
+
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            auto const& entry = m_entries[i];
+            auto& tocEntry = toc[i];
+            tocEntry.guid = toGuidBytes(entry.guid);
+            tocEntry.type = entry.type;
+            tocEntry.pathOffset = static_cast<uint32_t>(stringPool.size());
+            tocEntry.pathSize = static_cast<uint32_t>(entry.bundlePath.size());
+            stringPool += entry.bundlePath;
+            tocEntry.metadataOffset = metadata.size();
+            tocEntry.metadataSize = static_cast<uint32_t>(entry.metadata.size());
+            metadata.insert(metadata.end(), entry.metadata.begin(), entry.metadata.end());
+            tocEntry.payloadSize = entry.payload.size();
+        }
+
+        auto const targetId = m_target.toId();
+        header.targetIdOffset = static_cast<uint32_t>(stringPool.size());
+        header.targetIdSize = static_cast<uint32_t>(targetId.size());
+        stringPool += targetId;
+
+        header.tocOffset = sizeof(BundleHeader);
+        header.metadataOffset = header.tocOffset + toc.size() * sizeof(BundleTocEntry);
+        header.metadataSize = metadata.size();
+        header.stringPoolOffset = header.metadataOffset + header.metadataSize;
+        header.stringPoolSize = stringPool.size();
+        header.payloadOffset = align_up(header.stringPoolOffset + header.stringPoolSize, header.payloadAlignment);
+
+        auto const loadOrder = computeLoadOrder();
+        auto cursor = header.payloadOffset;
+        for (uint32_t order = 0; order < loadOrder.size(); ++order)
+        {
+            auto& tocEntry = toc[loadOrder[order]];
+            tocEntry.loadOrder = order;
+            tocEntry.metadataOffset += header.metadataOffset;
+            if (tocEntry.payloadSize > 0)
+            {
+                tocEntry.payloadOffset = cursor;
+                cursor = align_up(cursor + tocEntry.payloadSize, header.payloadAlignment);
+            }
+        }
+
+        // The TOC is binary searched by GUID at runtime; payload offsets were assigned above.
+        auto sortedToc = toc;
+        std::sort(sortedToc.begin(), sortedToc.end(),
+            [](BundleTocEntry const& a, BundleTocEntry const& b) { return a.guid < b.guid; });
+
+        auto parentDir = path.parent_path();
+        if (!parentDir.empty())
+        {
+            VFS::createDirectories(parentDir.string());
+        }
+
+        auto resolvedPath = VFS::resolvePath(path.string());
+        auto stream = std::ofstream{resolvedPath, std::ios::binary | std::ios::trunc};
+        if (!stream.is_open())
+        {
+            AP_ERROR("[AssetBundle] Failed to open bundle for writing: {}", resolvedPath.string());
+            return false;
+        }
+
+        stream.write(reinterpret_cast<char const*>(&header), sizeof(BundleHeader));
+        stream.write(reinterpret_cast<char const*>(sortedToc.data()), static_cast<std::streamsize>(sortedToc.size() * sizeof(BundleTocEntry)));
+        stream.write(reinterpret_cast<char const*>(metadata.data()), static_cast<std::streamsize>(metadata.size()));
+        stream.write(stringPool.data(), static_cast<std::streamsize>(stringPool.size()));
+
+        auto written = header.stringPoolOffset + header.stringPoolSize;
+        for (auto const index : loadOrder)
+        {
+            auto const& tocEntry = toc[index];
+            if (tocEntry.payloadSize == 0)
+            {
+                continue;
+            }
+
+            writePadding(stream, written, tocEntry.payloadOffset);
+            auto const& payload = m_entries[index].payload;
+            stream.write(reinterpret_cast<char const*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            written = tocEntry.payloadOffset + tocEntry.payloadSize;
+        }
+
+        if (!stream.good())
+        {
+            AP_ERROR("[AssetBundle] Failed while writing bundle: {}", resolvedPath.string());
+            return false;
+        }
+
+        AP_INFO("[AssetBundle] Wrote bundle: {} ({} assets, {} bytes)", resolvedPath.string(), m_entries.size(), written);
+        return true;
+    }
+} // namespace april::asset
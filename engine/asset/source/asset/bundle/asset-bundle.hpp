@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../asset.hpp"
+#include "../target-profile.hpp"
+
+#include <core/file/mapped-file.hpp>
+#include <core/tools/uuid.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace april::asset
+{
+    /**
+     * Cooked asset bundle layout:
+     * [BundleHeader][BundleTocEntry[] sorted by GUID][metadata (CBOR)][string pool][payloads, 64K aligned, in load order]
+     * All offsets are absolute from the start of the file.
+     */
+    struct BundleHeader
+    {
+        static constexpr uint32_t kMagic = 0x41504244; // "APBD" - April Bundle
+        static constexpr uint32_t kVersion = 1;
+        static constexpr uint32_t kPayloadAlignment = 64 * 1024;
+
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint32_t entryCount = 0;
+        uint32_t payloadAlignment = kPayloadAlignment;
+        uint64_t tocOffset = 0;
+        uint64_t metadataOffset = 0;
+        uint64_t metadataSize = 0;
+        uint64_t stringPoolOffset = 0;
+        uint64_t stringPoolSize = 0;
+        uint64_t payloadOffset = 0;
+        uint32_t targetIdOffset = 0;    // Into the string pool
+        uint32_t targetIdSize = 0;
+
+        [[nodiscard]] auto isValid() const -> bool
+        {
+            return magic == kMagic && version == kVersion;
+        }
+    };
+
+    static_assert(sizeof(BundleHeader) == 72, "BundleHeader size mismatch");
+
+    struct BundleTocEntry
+    {
+        std::array<uint8_t, 16> guid{};
+        AssetType type{AssetType::None};
+        uint8_t reserved[3]{};
+        uint32_t loadOrder = 0;
+        uint32_t pathOffset = 0;        // Into the string pool
+        uint32_t pathSize = 0;
+        uint32_t metadataSize = 0;
+        uint32_t flags = 0;             // Reserved
+        uint64_t metadataOffset = 0;
+        uint64_t payloadOffset = 0;
+        uint64_t payloadSize = 0;
+    };
+
+    static_assert(sizeof(BundleTocEntry) == 64, "BundleTocEntry size mismatch");
+
+    /**
+     * Read-only view of a cooked bundle backed by a memory mapping.
+     */
+    class AssetBundle
+    {
+    public:
+        auto open(std::filesystem::path const& path) -> bool;
+
+        [[nodiscard]] auto isOpen() const -> bool { return m_file != nullptr; }
+        [[nodiscard]] auto getEntries() const -> std::span<BundleTocEntry const> { return m_entries; }
+        [[nodiscard]] auto getTargetId() const -> std::string_view;
+
+        [[nodiscard]] auto find(core::UUID const& guid) const -> BundleTocEntry const*;
+        [[nodiscard]] auto findByPath(std::string const& bundlePath) const -> BundleTocEntry const*;
+
+        [[nodiscard]] auto getMetadata(BundleTocEntry const& entry) const -> std::span<std::byte const>;
+        [[nodiscard]] auto getPayload(BundleTocEntry const& entry) const -> std::span<std::byte const>;
+        [[nodiscard]] auto getPath(BundleTocEntry const& entry) const -> std::string_view;
+
+        /**
+         * Fault the pages of entry's payload into memory ahead of a read.
+         */
+        auto prefetchPayload(BundleTocEntry const& entry) const -> void;
+
+    private:
+        std::shared_ptr<MappedFile> m_file{};
+        BundleHeader m_header{};
+        std::span<BundleTocEntry const> m_entries{};
+        std::unordered_map<std::string_view, uint32_t> m_pathIndex{};
+    };
+
+    /**
+     * Collects cooked assets and writes them as a single bundle file.
+     */
+    class AssetBundleWriter
+    {
+    public:
+        struct Entry
+        {
+            core::UUID guid{};
+            AssetType type{AssetType::None};
+            std::string bundlePath{};
+            std::vector<std::byte> metadata{};
+            std::vector<std::byte> payload{};
+            std::vector<core::UUID> references{};
+        };
+
+        explicit AssetBundleWriter(TargetProfile target) : m_target{std::move(target)} {}
+
+        auto addEntry(Entry entry) -> void;
+
+        /**
+         * Payloads are laid out in load order: every root asset (not referenced by another entry)
+         * is followed depth-first by the assets it references.
+         */
+        auto write(std::filesystem::path const& path) const -> bool;
+
+        [[nodiscard]] auto getEntryCount() const -> size_t { return m_entries.size(); }
+
+    private:
+        auto computeLoadOrder() const -> std::vector<size_t>;
+
+        TargetProfile m_target{};
+        std::vector<Entry> m_entries{};
+    };
+} // namespace april::asset
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 
 namespace april::asset
 {
@@ -20,5 +22,46 @@ namespace april::asset
         virtual auto get(std::string const& key, DdcValue& outValue) -> bool = 0;
         virtual auto put(std::string const& key, DdcValue const& value) -> void = 0;
         virtual auto exists(std::string const& key) -> bool = 0;
+
+        /**
+         * Read size bytes of a stored payload starting at offset. contentHash is left empty.
+         * The default fetches the whole payload; backends with random access only touch the range.
+         */
+        virtual auto getRange(std::string const& key, uint64_t offset, uint64_t size, DdcValue& outValue) -> bool
+        {
+            auto full = DdcValue{};
+            if (!get(key, full) || offset > full.bytes.size() || size > full.bytes.size() - offset)
+            {
+                return false;
+            }
+
+            auto const begin = full.bytes.begin() + static_cast<std::ptrdiff_t>(offset);
+            outValue.bytes.assign(begin, begin + static_cast<std::ptrdiff_t>(size));
+            outValue.contentHash.clear();
+            return true;
+        }
+
+        /**
+         * Warm the storage behind key ahead of a read, e.g. from a usage manifest. Returns false on a miss.
+         * The default only checks that key exists.
+         */
+        virtual auto prefetch(std::string const& key) -> bool
+        {
+            return exists(key);
+        }
+
+        /**
+         * Hash of the stored payload's bytes; equal hashes mean identical payloads. The default hashes
+         * the whole payload; content-addressed backends answer from their reference.
+         */
+        virtual auto getContentHash(std::string const& key) -> std::optional<std::string>
+        {
+            auto value = DdcValue{};
+            if (!get(key, value))
+            {
+                return std::nullopt;
+            }
+            return value.contentHash;
+        }
     };
 } // namespace april::asset
@@ -4,6 +4,7 @@
 #include <core/log/logger.hpp>
 #include <core/tools/hash.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
@@ -33,69 +34,246 @@ namespace april::asset
         }
 
         auto fileBytes = readFile(path);
-        if (fileBytes.size() < sizeof(LocalDdc::DdcFileHeader))
+        auto isReference = false;
+        auto payload = parseFile(fileBytes, path, isReference);
+        if (!payload)
         {
-            AP_WARN("[DDC] Invalid DDC file size: {}", path.string());
             return false;
         }
 
-        auto header = LocalDdc::DdcFileHeader{};
-        std::memcpy(&header, fileBytes.data(), sizeof(LocalDdc::DdcFileHeader));
-
-        if (header.magic != LocalDdc::DdcFileHeader{}.magic || header.version != LocalDdc::DdcFileHeader{}.version)
+        if (!isReference)
         {
-            AP_WARN("[DDC] Invalid DDC header: {}", path.string());
-            return false;
+            outValue.bytes.assign(payload->begin(), payload->end());
+            outValue.contentHash = core::Sha1{}.update(*payload).getHexDigest();
+            return !outValue.bytes.empty();
         }
 
-        auto payloadOffset = sizeof(LocalDdc::DdcFileHeader);
-        auto payloadSize = static_cast<size_t>(header.payloadSize);
-        if (fileBytes.size() < payloadOffset + payloadSize)
+        auto contentHash = std::string{reinterpret_cast<char const*>(payload->data()), payload->size()};
+        auto const contentPath = makePathForContent(contentHash);
+        auto contentBytes = readFile(contentPath);
+        auto contentIsReference = false;
+        auto content = parseFile(contentBytes, contentPath, contentIsReference);
+        if (!content || contentIsReference)
         {
-            AP_WARN("[DDC] Truncated DDC payload: {}", path.string());
+            AP_WARN("[DDC] Missing content {} for key file: {}", contentHash, path.string());
             return false;
         }
 
-        outValue.bytes.assign(fileBytes.begin() + static_cast<std::ptrdiff_t>(payloadOffset),
-                               fileBytes.begin() + static_cast<std::ptrdiff_t>(payloadOffset + payloadSize));
-        outValue.contentHash = core::computeStringHash(std::string{
-            reinterpret_cast<char const*>(outValue.bytes.data()),
-            outValue.bytes.size()
-        });
-
+        outValue.bytes.assign(content->begin(), content->end());
+        outValue.contentHash = std::move(contentHash);
         return !outValue.bytes.empty();
     }
 
     auto LocalDdc::put(std::string const& key, DdcValue const& value) -> void
     {
+        auto const makeFile = [](std::span<std::byte const> payload, std::string const& hash, uint16_t flags)
+        {
+            auto header = LocalDdc::DdcFileHeader{};
+            header.flags = flags;
+            header.payloadSize = payload.size();
+            std::memcpy(header.keyHash.data(), hash.data(), std::min(hash.size(), header.keyHash.size()));
+
+            auto fileBytes = std::vector<std::byte>(sizeof(LocalDdc::DdcFileHeader) + payload.size());
+            std::memcpy(fileBytes.data(), &header, sizeof(LocalDdc::DdcFileHeader));
+            if (!payload.empty())
+            {
+                std::memcpy(fileBytes.data() + sizeof(LocalDdc::DdcFileHeader), payload.data(), payload.size());
+            }
+            return fileBytes;
+        };
+
+        auto const contentHash = core::Sha1{}.update(std::span<std::byte const>{value.bytes}).getHexDigest();
+        auto const contentPath = makePathForContent(contentHash);
+        auto const path = makePathForKey(key);
+
         auto lock = std::scoped_lock{m_writeMutex};
+        for (auto const& directory : {contentPath.parent_path(), path.parent_path()})
+        {
+            if (!VFS::existsDirectory(directory.string()))
+            {
+                VFS::createDirectories(directory.string());
+            }
+        }
+
+        // Identical payloads from other keys are already stored; only the reference is new. A damaged blob
+        // would otherwise stay broken for every key that shares it, so one that no longer parses is replaced.
+        auto storedIsValid = false;
+        if (VFS::existsFile(contentPath.string()))
+        {
+            auto const stored = readFile(contentPath);
+            auto storedIsReference = false;
+            storedIsValid = parseFile(stored, contentPath, storedIsReference).has_value() && !storedIsReference;
+        }
+        if (!storedIsValid)
+        {
+            writeFile(contentPath, makeFile(value.bytes, contentHash, 0));
+        }
+
+        auto const reference = std::as_bytes(std::span{contentHash.data(), contentHash.size()});
+        writeFile(path, makeFile(reference, core::computeStringHash(key), kReference));
+    }
+
+    auto LocalDdc::exists(std::string const& key) -> bool
+    {
+        auto const path = makePathForKey(key);
+        if (!VFS::existsFile(path.string()))
+        {
+            return false;
+        }
+
+        auto const file = VFS::mapFile(path.string());
+        if (!file)
+        {
+            return false;
+        }
+
+        // A reference whose content was removed from under it is as good as missing.
+        auto isReference = false;
+        auto const payload = parseFile(file->getData(), path, isReference);
+        if (!payload || !isReference)
+        {
+            return payload.has_value();
+        }
+
+        auto const contentHash = std::string{reinterpret_cast<char const*>(payload->data()), payload->size()};
+        return VFS::existsFile(makePathForContent(contentHash).string());
+    }
+
+    auto LocalDdc::getRange(std::string const& key, uint64_t offset, uint64_t size, DdcValue& outValue) -> bool
+    {
+        // Map instead of reading so only the pages of the requested range are touched.
         auto path = makePathForKey(key);
-        auto directory = path.parent_path();
-        if (!VFS::existsDirectory(directory.string()))
+        auto file = VFS::mapFile(path.string());
+        if (!file)
         {
-            VFS::createDirectories(directory.string());
+            return false;
         }
 
-        auto header = LocalDdc::DdcFileHeader{};
-        header.payloadSize = value.bytes.size();
-        auto keyHash = core::computeStringHash(key);
-        std::memcpy(header.keyHash.data(), keyHash.data(), std::min(keyHash.size(), header.keyHash.size()));
+        auto isReference = false;
+        auto payload = parseFile(file->getData(), path, isReference);
+        if (payload && isReference)
+        {
+            path = makePathForContent(std::string{reinterpret_cast<char const*>(payload->data()), payload->size()});
+            file = VFS::mapFile(path.string());
+            payload = file ? parseFile(file->getData(), path, isReference) : std::nullopt;
+            if (payload && isReference)
+            {
+                payload.reset();
+            }
+        }
 
-        auto fileBytes = std::vector<std::byte>{};
-        fileBytes.resize(sizeof(LocalDdc::DdcFileHeader) + value.bytes.size());
-        std::memcpy(fileBytes.data(), &header, sizeof(LocalDdc::DdcFileHeader));
-        if (!value.bytes.empty())
+        if (!payload)
         {
-            std::memcpy(fileBytes.data() + sizeof(LocalDdc::DdcFileHeader), value.bytes.data(), value.bytes.size());
+            return false;
+        }
+
+        if (offset > payload->size() || size > payload->size() - offset)
+        {
+            AP_WARN("[DDC] Range {}+{} outside payload of {} bytes: {}", offset, size, payload->size(), path.string());
+            return false;
         }
 
-        writeFile(path, fileBytes);
+        auto const range = payload->subspan(static_cast<size_t>(offset), static_cast<size_t>(size));
+        outValue.bytes.assign(range.begin(), range.end());
+        outValue.contentHash.clear();
+        return true;
     }
 
-    auto LocalDdc::exists(std::string const& key) -> bool
+    auto LocalDdc::getContentHash(std::string const& key) -> std::optional<std::string>
     {
+        auto const path = makePathForKey(key);
+        if (!VFS::existsFile(path.string()))
+        {
+            return std::nullopt;
+        }
+
+        // Key files written by this version are tiny references; older ones are hashed in full.
+        auto const fileBytes = readFile(path);
+        auto isReference = false;
+        auto const payload = parseFile(fileBytes, path, isReference);
+        if (!payload)
+        {
+            return std::nullopt;
+        }
+
+        if (isReference)
+        {
+            return std::string{reinterpret_cast<char const*>(payload->data()), payload->size()};
+        }
+        return core::Sha1{}.update(*payload).getHexDigest();
+    }
+
+    auto LocalDdc::prefetch(std::string const& key) -> bool
+    {
+        // Fault the payload's pages in through a mapping, so nothing is copied.
         auto path = makePathForKey(key);
-        return VFS::existsFile(path.string());
+        if (!VFS::existsFile(path.string()))
+        {
+            return false;
+        }
+
+        auto file = VFS::mapFile(path.string());
+        auto isReference = false;
+        auto payload = file ? parseFile(file->getData(), path, isReference) : std::nullopt;
+        if (payload && isReference)
+        {
+            path = makePathForContent(std::string{reinterpret_cast<char const*>(payload->data()), payload->size()});
+            file = VFS::existsFile(path.string()) ? VFS::mapFile(path.string()) : nullptr;
+            payload = file ? parseFile(file->getData(), path, isReference) : std::nullopt;
+        }
+
+        if (!payload || isReference)
+        {
+            return false;
+        }
+
+        file->prefetch(0, file->getSize());
+        return true;
+    }
+
+    auto LocalDdc::parseFile(
+        std::span<std::byte const> fileBytes,
+        std::filesystem::path const& path,
+        bool& isReference
+    ) -> std::optional<std::span<std::byte const>>
+    {
+        if (fileBytes.size() < sizeof(LocalDdc::DdcFileHeader))
+        {
+            AP_WARN("[DDC] Invalid DDC file size: {}", path.string());
+            return std::nullopt;
+        }
+
+        auto header = LocalDdc::DdcFileHeader{};
+        std::memcpy(&header, fileBytes.data(), sizeof(LocalDdc::DdcFileHeader));
+
+        if (header.magic != LocalDdc::DdcFileHeader{}.magic || (header.version != 1 && header.version != LocalDdc::DdcFileHeader{}.version))
+        {
+            AP_WARN("[DDC] Invalid DDC header: {}", path.string());
+            return std::nullopt;
+        }
+
+        auto const payload = fileBytes.subspan(sizeof(LocalDdc::DdcFileHeader));
+        if (payload.size() < header.payloadSize)
+        {
+            AP_WARN("[DDC] Truncated DDC payload: {}", path.string());
+            return std::nullopt;
+        }
+
+        isReference = header.version != 1 && (header.flags & kReference) != 0;
+        auto const stored = payload.first(static_cast<size_t>(header.payloadSize));
+
+        // References name a content file by its hex SHA1; anything else would build a bogus path.
+        auto const isHexDigit = [](std::byte value)
+        {
+            auto const ch = static_cast<char>(value);
+            return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+        };
+        if (isReference && (stored.size() != 40 || !std::ranges::all_of(stored, isHexDigit)))
+        {
+            AP_WARN("[DDC] Malformed content reference: {}", path.string());
+            return std::nullopt;
+        }
+        return stored;
     }
 
     auto LocalDdc::makePathForKey(std::string const& key) const -> std::filesystem::path
@@ -106,6 +284,11 @@ namespace april::asset
         return m_rootPath / subDir / subDir2 / (hash + ".bin");
     }
 
+    auto LocalDdc::makePathForContent(std::string const& contentHash) const -> std::filesystem::path
+    {
+        return m_rootPath / "content" / contentHash.substr(0, 2) / contentHash.substr(2, 2) / (contentHash + ".bin");
+    }
+
     auto LocalDdc::readFile(std::filesystem::path const& path) const -> std::vector<std::byte>
     {
         return VFS::readBinaryFile(path.string());
@@ -5,9 +5,15 @@
 #include <array>
 #include <filesystem>
 #include <mutex>
+#include <optional>
+#include <span>
 
 namespace april::asset
 {
+    /**
+     * File-per-key DDC. Payloads are content addressed: each key file references a blob under content/
+     * named by the payload's hash, so identical cooks of different assets are stored once.
+     */
     class LocalDdc final : public IDdc
     {
     public:
@@ -16,15 +22,20 @@ namespace april::asset
         auto get(std::string const& key, DdcValue& outValue) -> bool override;
         auto put(std::string const& key, DdcValue const& value) -> void override;
         auto exists(std::string const& key) -> bool override;
+        auto getRange(std::string const& key, uint64_t offset, uint64_t size, DdcValue& outValue) -> bool override;
+        auto getContentHash(std::string const& key) -> std::optional<std::string> override;
+        auto prefetch(std::string const& key) -> bool override;
 
         [[nodiscard]] auto getRootPath() const -> std::filesystem::path const& { return m_rootPath; }
 
     private:
+        static constexpr uint16_t kReference = 1;   // The payload is the content hash of a blob under content/
+
         struct DdcFileHeader
         {
             uint32_t magic = 0x30434444; // 'DDC0'
-            uint16_t version = 1;
-            uint16_t reserved = 0;
+            uint16_t version = 2;        // Version 1 files hold their payload inline and have no flags
+            uint16_t flags = 0;
             uint64_t payloadSize = 0;
             std::array<char, 40> keyHash{};
         };
@@ -32,7 +43,17 @@ namespace april::asset
         std::filesystem::path m_rootPath;
         mutable std::mutex m_writeMutex{};
 
+        /**
+         * Validate a stored file and return its payload. Sets isReference for key files that point at content.
+         */
+        [[nodiscard]] static auto parseFile(
+            std::span<std::byte const> fileBytes,
+            std::filesystem::path const& path,
+            bool& isReference
+        ) -> std::optional<std::span<std::byte const>>;
+
         [[nodiscard]] auto makePathForKey(std::string const& key) const -> std::filesystem::path;
+        [[nodiscard]] auto makePathForContent(std::string const& contentHash) const -> std::filesystem::path;
         [[nodiscard]] auto readFile(std::filesystem::path const& path) const -> std::vector<std::byte>;
         auto writeFile(std::filesystem::path const& path, std::vector<std::byte> const& data) const -> void;
     };
@@ -18,6 +18,8 @@ namespace april::asset
     {
         DepKind kind{DepKind::Strong};
         AssetRef asset{};
+
+        auto operator == (Dependency const& other) const -> bool = default;
     };
 
     auto to_json(nlohmann::json& j, Dependency const& dep) -> void;
@@ -2,6 +2,7 @@
 
 #include "../ddc/ddc-key.hpp"
 #include "../ddc/ddc-utils.hpp"
+#include "../mesh/tangent-generator.hpp"
 
 #include <core/file/vfs.hpp>
 #include <core/log/logger.hpp>
@@ -23,131 +24,287 @@
 
 namespace april::asset
 {
+    struct GltfDocument
+    {
+        tinygltf::Model model{};
+        std::vector<std::span<std::byte const>> buffers{}; // Parallel to model.buffers
+        std::vector<std::span<std::byte const>> images{};  // Encoded bytes per model.images entry, empty for external files
+        std::vector<std::shared_ptr<MappedFile>> mappings{}; // Keep the spans above alive
+    };
+
     namespace
     {
         auto sanitizeAssetName(std::string name) -> std::string;
 
-        auto loadModel(std::filesystem::path const& sourcePath, tinygltf::Model& outModel) -> bool
+        constexpr auto kGlbMagic = uint32_t{0x46546C67};     // "glTF"
+        constexpr auto kGlbChunkJson = uint32_t{0x4E4F534A}; // "JSON"
+        constexpr auto kGlbChunkBin = uint32_t{0x004E4942};  // "BIN\0"
+
+        // tinygltf copies every buffer it loads. Buffers read in place are swapped for this one-byte stub before
+        // the JSON reaches tinygltf (an empty data URI is rejected).
+        constexpr auto kStubBufferUri = "data:application/octet-stream;base64,AA==";
+
+        auto readUint32(std::span<std::byte const> bytes, size_t offset) -> uint32_t
         {
-            auto loader = tinygltf::TinyGLTF{};
-            auto err = std::string{};
-            auto warn = std::string{};
+            auto value = uint32_t{0};
+            std::memcpy(&value, bytes.data() + offset, sizeof(value));
+            return value;
+        }
 
-            auto callbacks = tinygltf::FsCallbacks{};
-            callbacks.FileExists = [](std::string const& path, void*) -> bool
+        // Split a GLB container into its JSON chunk and optional BIN chunk.
+        auto parseGlbChunks(
+            std::span<std::byte const> file,
+            std::span<std::byte const>& outJson,
+            std::span<std::byte const>& outBin
+        ) -> bool
+        {
+            if (file.size() < 20 || readUint32(file, 0) != kGlbMagic || readUint32(file, 4) != 2)
             {
-                return VFS::existsFile(path);
-            };
-            callbacks.ReadWholeFile = [](std::vector<unsigned char>* out,
-                                         std::string* outErr,
-                                         std::string const& path,
-                                         void*) -> bool
+                return false;
+            }
+
+            auto const totalSize = std::min<size_t>(readUint32(file, 8), file.size());
+            auto offset = size_t{12};
+            while (offset + 8 <= totalSize)
             {
-                auto data = VFS::readBinaryFile(path);
-                if (data.empty())
+                auto const chunkSize = size_t{readUint32(file, offset)};
+                auto const chunkType = readUint32(file, offset + 4);
+                offset += 8;
+                if (chunkSize > totalSize - offset)
                 {
-                    if (outErr)
-                    {
-                        *outErr = std::format("Failed to read file: {}", path);
-                    }
                     return false;
                 }
 
-                out->assign(reinterpret_cast<unsigned char const*>(data.data()),
-                    reinterpret_cast<unsigned char const*>(data.data() + data.size()));
-                return true;
-            };
-            callbacks.WriteWholeFile = [](std::string* outErr,
-                                          std::string const& path,
-                                          std::vector<unsigned char> const& data,
-                                          void*) -> bool
-            {
-                auto span = std::span<std::byte const>{
-                    reinterpret_cast<std::byte const*>(data.data()),
-                    data.size()};
-                if (!VFS::writeBinaryFile(path, span))
+                auto const chunk = file.subspan(offset, chunkSize);
+                if (chunkType == kGlbChunkJson && outJson.empty())
                 {
-                    if (outErr)
-                    {
-                        *outErr = std::format("Failed to write file: {}", path);
-                    }
-                    return false;
+                    outJson = chunk;
+                }
+                else if (chunkType == kGlbChunkBin && outBin.empty())
+                {
+                    outBin = chunk;
                 }
+                offset += (chunkSize + 3) & ~size_t{3};
+            }
 
-                return true;
-            };
-            callbacks.ExpandFilePath = [](std::string const& path, void*) -> std::string
+            return !outJson.empty();
+        }
+
+        auto decodeUri(std::string const& uri) -> std::string
+        {
+            auto decoded = std::string{};
+            tinygltf::URIDecode(uri, &decoded, nullptr);
+            return decoded;
+        }
+
+        auto sniffImageMimeType(std::span<std::byte const> bytes) -> std::string
+        {
+            auto const startsWith = [&](std::initializer_list<uint8_t> magic)
             {
-                return path;
+                return bytes.size() >= magic.size() && std::equal(magic.begin(), magic.end(), bytes.begin(),
+                    [](uint8_t expected, std::byte actual) { return std::to_integer<uint8_t>(actual) == expected; });
             };
-            callbacks.GetFileSizeInBytes = [](size_t* fileSize,
-                                              std::string* outErr,
-                                              std::string const& path,
-                                              void*) -> bool
+
+            if (startsWith({0x89, 'P', 'N', 'G'}))
+            {
+                return "image/png";
+            }
+            if (startsWith({0xFF, 0xD8, 0xFF}))
+            {
+                return "image/jpeg";
+            }
+            return {};
+        }
+
+        // Images are rebuilt from the original JSON instead of letting tinygltf load them from the stubbed buffers.
+        // Nothing is decoded: bufferView images stay in the mapped buffer, data: URIs are base64-decoded into
+        // image.image (flagged as_is), and external files are only referenced by uri.
+        auto loadImages(nlohmann::json const& images, GltfDocument& document) -> void
+        {
+            auto& model = document.model;
+            model.images.reserve(images.size());
+            document.images.resize(images.size());
+
+            for (size_t i = 0; i < images.size(); ++i)
             {
-                auto file = VFS::open(path);
-                if (!file)
+                auto const& entry = images[i];
+                auto image = tinygltf::Image{};
+                image.name = entry.value("name", std::string{});
+                image.mimeType = entry.value("mimeType", std::string{});
+                image.uri = entry.value("uri", std::string{});
+                image.bufferView = entry.value("bufferView", -1);
+
+                auto encoded = std::span<std::byte const>{};
+                if (image.bufferView >= 0)
                 {
-                    if (outErr)
+                    image.uri.clear();
+                    if (image.bufferView < static_cast<int>(model.bufferViews.size()))
                     {
-                        *outErr = std::format("Failed to open file: {}", path);
+                        auto const& view = model.bufferViews[image.bufferView];
+                        auto const buffer = view.buffer >= 0 && view.buffer < static_cast<int>(document.buffers.size())
+                            ? document.buffers[view.buffer]
+                            : std::span<std::byte const>{};
+                        if (view.byteOffset <= buffer.size() && view.byteLength <= buffer.size() - view.byteOffset)
+                        {
+                            encoded = buffer.subspan(view.byteOffset, view.byteLength);
+                        }
+                    }
+                }
+                else if (image.uri.starts_with("data:"))
+                {
+                    auto mimeType = std::string{};
+                    if (tinygltf::DecodeDataURI(&image.image, mimeType, image.uri, 0, false))
+                    {
+                        image.as_is = true;
+                        if (image.mimeType.empty())
+                        {
+                            image.mimeType = mimeType;
+                        }
                     }
-                    return false;
                 }
 
-                *fileSize = file->getSize();
-                return true;
-            };
-            callbacks.user_data = nullptr;
-            loader.SetFsCallbacks(callbacks);
+                if (image.mimeType.empty())
+                {
+                    image.mimeType = sniffImageMimeType(encoded);
+                }
+
+                model.images.push_back(std::move(image));
+                document.images[i] = encoded;
+            }
+
+            // Spans into image.image are taken once the vector has stopped growing.
+            for (size_t i = 0; i < model.images.size(); ++i)
+            {
+                if (model.images[i].as_is)
+                {
+                    document.images[i] = std::as_bytes(std::span{model.images[i].image});
+                }
+            }
+        }
 
+        /**
+         * Parse a glTF/GLB without copying its binary payload. The source file and external .bin buffers are mapped
+         * through the VFS and exposed as spans; only data: URI buffers are decoded by tinygltf.
+         */
+        auto loadDocument(std::filesystem::path const& sourcePath) -> std::shared_ptr<GltfDocument>
+        {
             auto extension = sourcePath.extension().string();
             std::transform(extension.begin(), extension.end(), extension.begin(),
                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
 
-            auto success = false;
-            if (extension == ".gltf")
+            if (extension != ".gltf" && extension != ".glb")
+            {
+                AP_ERROR("[GltfImporter] Unsupported mesh format: {}", sourcePath.string());
+                return nullptr;
+            }
+
+            auto sourceFile = VFS::mapFile(sourcePath.string());
+            if (!sourceFile)
+            {
+                AP_ERROR("[GltfImporter] Failed to open glTF file: {}", sourcePath.string());
+                return nullptr;
+            }
+
+            auto jsonBytes = sourceFile->getData();
+            auto binChunk = std::span<std::byte const>{};
+            if (extension == ".glb")
             {
-                auto payload = VFS::readTextFile(sourcePath.string());
-                if (payload.empty())
+                jsonBytes = {};
+                if (!parseGlbChunks(sourceFile->getData(), jsonBytes, binChunk))
                 {
-                    AP_ERROR("[GltfImporter] Failed to open glTF file: {}", sourcePath.string());
-                    return false;
+                    AP_ERROR("[GltfImporter] Invalid GLB container: {}", sourcePath.string());
+                    return nullptr;
                 }
+            }
+
+            auto const* jsonText = reinterpret_cast<char const*>(jsonBytes.data());
+            auto json = nlohmann::json::parse(jsonText, jsonText + jsonBytes.size(), nullptr, false);
+            if (json.is_discarded() || !json.is_object())
+            {
+                AP_ERROR("[GltfImporter] Failed to parse glTF JSON: {}", sourcePath.string());
+                return nullptr;
+            }
+
+            auto document = std::make_shared<GltfDocument>();
+            auto const baseDir = sourcePath.parent_path();
 
-                auto baseDir = VFS::resolvePath(sourcePath.parent_path().string());
-                success = loader.LoadASCIIFromString(
-                    &outModel,
-                    &err,
-                    &warn,
-                    payload.c_str(),
-                    static_cast<unsigned int>(payload.size()),
-                    std::filesystem::absolute(baseDir).string());
+            auto& buffers = json["buffers"];
+            if (!buffers.is_array())
+            {
+                buffers = nlohmann::json::array();
             }
-            else if (extension == ".glb")
+
+            document->buffers.resize(buffers.size());
+            auto inPlace = std::vector<bool>(buffers.size(), false);
+            auto usesBinChunk = false;
+            for (size_t i = 0; i < buffers.size(); ++i)
             {
-                auto payload = VFS::readBinaryFile(sourcePath.string());
-                if (payload.empty())
+                auto& buffer = buffers[i];
+                auto const uri = buffer.value("uri", std::string{});
+                auto const byteLength = buffer.value("byteLength", size_t{0});
+                if (uri.starts_with("data:"))
                 {
-                    AP_ERROR("[GltfImporter] Failed to open glTF file: {}", sourcePath.string());
-                    return false;
+                    continue;
+                }
+
+                auto data = std::span<std::byte const>{};
+                if (uri.empty())
+                {
+                    data = binChunk;
+                    usesBinChunk = true;
+                }
+                else
+                {
+                    auto const bufferPath = baseDir / decodeUri(uri);
+                    auto bufferFile = VFS::mapFile(bufferPath.string());
+                    if (!bufferFile)
+                    {
+                        AP_ERROR("[GltfImporter] Failed to open glTF buffer: {}", bufferPath.string());
+                        return nullptr;
+                    }
+                    data = bufferFile->getData();
+                    document->mappings.push_back(std::move(bufferFile));
                 }
 
-                auto baseDir = VFS::resolvePath(sourcePath.parent_path().string());
-                success = loader.LoadBinaryFromMemory(
-                    &outModel,
-                    &err,
-                    &warn,
-                    reinterpret_cast<unsigned char const*>(payload.data()),
-                    static_cast<unsigned int>(payload.size()),
-                    std::filesystem::absolute(baseDir).string());
+                if (data.size() < byteLength)
+                {
+                    AP_ERROR("[GltfImporter] Buffer {} is {} bytes, expected {}: {}", i, data.size(), byteLength, sourcePath.string());
+                    return nullptr;
+                }
+
+                document->buffers[i] = data.first(byteLength);
+                inPlace[i] = true;
+                buffer["uri"] = kStubBufferUri;
+                buffer["byteLength"] = 1;
             }
-            else
+
+            if (usesBinChunk)
             {
-                AP_ERROR("[GltfImporter] Unsupported mesh format: {}", sourcePath.string());
-                return false;
+                document->mappings.push_back(sourceFile);
+            }
+
+            auto images = nlohmann::json::array();
+            if (auto it = json.find("images"); it != json.end())
+            {
+                if (it->is_array())
+                {
+                    images = std::move(*it);
+                }
+                json.erase(it);
             }
 
+            auto loader = tinygltf::TinyGLTF{};
+            auto err = std::string{};
+            auto warn = std::string{};
+            auto const rewritten = json.dump();
+            auto const success = loader.LoadASCIIFromString(
+                &document->model,
+                &err,
+                &warn,
+                rewritten.c_str(),
+                static_cast<unsigned int>(rewritten.size()),
+                std::filesystem::absolute(VFS::resolvePath(baseDir.string())).string());
+
             if (!warn.empty())
             {
                 AP_WARN("[GltfImporter] glTF warning: {}", warn);
@@ -156,50 +313,90 @@ namespace april::asset
             if (!success || !err.empty())
             {
                 AP_ERROR("[GltfImporter] Failed to load glTF: {} - {}", sourcePath.string(), err);
-                return false;
+                return nullptr;
+            }
+
+            for (size_t i = 0; i < document->buffers.size() && i < document->model.buffers.size(); ++i)
+            {
+                auto& buffer = document->model.buffers[i];
+                if (!inPlace[i])
+                {
+                    document->buffers[i] = std::as_bytes(std::span{buffer.data});
+                }
+                else
+                {
+                    // Drop the stub so nothing mistakes it for payload.
+                    buffer.data.clear();
+                    buffer.uri.clear();
+                }
             }
 
-            return true;
+            loadImages(images, *document);
+            return document;
         }
 
+        /**
+         * Extract an embedded image for the texture importer. PNG and JPEG bytes are written out unchanged; other
+         * formats stb can decode are converted to PNG as a fallback.
+         */
         auto writeEmbeddedTexture(
             tinygltf::Image const& image,
+            std::span<std::byte const> encoded,
             std::filesystem::path const& sourcePath,
-            int textureIndex
+            int imageIndex
         ) -> std::optional<std::filesystem::path>
         {
-            if (image.image.empty() || image.width <= 0 || image.height <= 0)
+            if (encoded.empty())
             {
-                AP_WARN("[GltfImporter] Embedded texture data missing for index {}", textureIndex);
-                return std::nullopt;
-            }
-
-            if (image.component < 1 || image.component > 4)
-            {
-                AP_WARN("[GltfImporter] Unsupported embedded texture components: {}", image.component);
+                AP_WARN("[GltfImporter] Embedded texture data missing for index {}", imageIndex);
                 return std::nullopt;
             }
 
             auto name = image.name.empty()
-                ? std::format("{}_image{}", sourcePath.stem().string(), textureIndex)
+                ? std::format("{}_image{}", sourcePath.stem().string(), imageIndex)
                 : image.name;
             name = sanitizeAssetName(name);
 
             auto embeddedDir = sourcePath.parent_path() / "_embedded";
             VFS::createDirectories(embeddedDir.string());
 
+            auto mimeType = image.mimeType;
+            if (mimeType != "image/png" && mimeType != "image/jpeg")
+            {
+                // Trust the bytes over a missing or mislabeled mimeType.
+                if (auto sniffed = sniffImageMimeType(encoded); !sniffed.empty())
+                {
+                    mimeType = std::move(sniffed);
+                }
+            }
+
+            if (mimeType == "image/png" || mimeType == "image/jpeg")
+            {
+                auto outputPath = embeddedDir / (name + (mimeType == "image/png" ? ".png" : ".jpg"));
+                if (!VFS::existsFile(outputPath.string()) && !VFS::writeBinaryFile(outputPath.string(), encoded))
+                {
+                    AP_WARN("[GltfImporter] Failed to write embedded texture: {}", outputPath.string());
+                    return std::nullopt;
+                }
+                return outputPath;
+            }
+
             auto outputPath = embeddedDir / (name + ".png");
             if (!VFS::existsFile(outputPath.string()))
             {
-                auto const stride = image.width * image.component;
-                auto const ok = stbi_write_png(
-                    outputPath.string().c_str(),
-                    image.width,
-                    image.height,
-                    image.component,
-                    image.image.data(),
-                    stride
-                );
+                auto width = 0;
+                auto height = 0;
+                auto channels = 0;
+                auto* pixels = stbi_load_from_memory(
+                    reinterpret_cast<stbi_uc const*>(encoded.data()), static_cast<int>(encoded.size()), &width, &height, &channels, 4);
+                if (!pixels)
+                {
+                    AP_WARN("[GltfImporter] Unsupported embedded texture format '{}' for index {}", image.mimeType, imageIndex);
+                    return std::nullopt;
+                }
+
+                auto const ok = stbi_write_png(outputPath.string().c_str(), width, height, 4, pixels, width * 4);
+                stbi_image_free(pixels);
                 if (ok == 0)
                 {
                     AP_WARN("[GltfImporter] Failed to write embedded texture: {}", outputPath.string());
@@ -212,12 +409,13 @@ namespace april::asset
 
         template <typename T>
         auto resolveTextureSource(
-            tinygltf::Model const& model,
+            GltfDocument const& document,
             T const& textureInfo,
             std::filesystem::path const& baseDir,
             std::filesystem::path const& sourcePath
         ) -> std::optional<GltfTextureSource>
         {
+            auto const& model = document.model;
             if (textureInfo.index < 0)
             {
                 return std::nullopt;
@@ -248,7 +446,7 @@ namespace april::asset
                 AP_WARN("[GltfImporter] Texture file not found: {}", texturePath.string());
             }
 
-            if (auto embedded = writeEmbeddedTexture(image, sourcePath, texture.source))
+            if (auto embedded = writeEmbeddedTexture(image, document.images[texture.source], sourcePath, texture.source))
             {
                 return GltfTextureSource{*embedded, textureInfo.texCoord};
             }
@@ -282,153 +480,397 @@ namespace april::asset
             return name;
         }
 
-        auto normalizeVec3(std::array<float, 3> const& value) -> std::array<float, 3>
+        /**
+         * Append simplified index ranges of every submesh to indices. Each level is simplified from the previous
+         * one, so errors accumulate. Submeshes that stop reducing repeat their last range; levels no submesh
+         * reached are dropped.
+         * @return Level count including LOD 0. outLods receives (count - 1) entries per submesh, submesh-major.
+         */
+        auto buildLodChain(
+            std::vector<float> const& vertices,
+            std::vector<uint32_t>& indices,
+            std::vector<Submesh> const& submeshes,
+            size_t vertexStrideFloats,
+            MeshImportSettings const& settings,
+            std::vector<SubmeshLod>& outLods
+        ) -> uint32_t
         {
-            auto const lengthSq = value[0] * value[0] + value[1] * value[1] + value[2] * value[2];
-            if (lengthSq <= 0.0f)
+            auto const vertexCount = vertices.size() / vertexStrideFloats;
+            auto const vertexSize = vertexStrideFloats * sizeof(float);
+            auto const errorScale = meshopt_simplifyScale(vertices.data(), vertexCount, vertexSize);
+            auto const reduction = std::clamp(settings.lodReduction, 0.05f, 0.95f);
+
+            auto chains = std::vector<std::vector<SubmeshLod>>(submeshes.size());
+            auto lodCount = 1u;
+
+            for (size_t s = 0; s < submeshes.size(); ++s)
+            {
+                auto const& submesh = submeshes[s];
+                auto previous = std::vector<uint32_t>(
+                    indices.begin() + submesh.indexOffset,
+                    indices.begin() + submesh.indexOffset + submesh.indexCount
+                );
+                auto relativeError = 0.0f;
+
+                for (auto lod = 1u; lod < settings.lodCount; ++lod)
+                {
+                    auto const targetCount = static_cast<size_t>(static_cast<float>(previous.size()) * reduction) / 3 * 3;
+                    if (targetCount < 3)
+                    {
+                        break;
+                    }
+
+                    auto simplified = std::vector<uint32_t>(previous.size());
+                    auto levelError = 0.0f;
+                    auto count = meshopt_simplify(
+                        simplified.data(),
+                        previous.data(),
+                        previous.size(),
+                        vertices.data(),
+                        vertexCount,
+                        vertexSize,
+                        targetCount,
+                        settings.lodMaxError,
+                        0,
+                        &levelError
+                    );
+
+                    // Open borders and attribute seams can stall the topology-preserving pass far above the target.
+                    if (settings.lodAllowSloppy && count > targetCount + targetCount / 2)
+                    {
+                        count = meshopt_simplifySloppy(
+                            simplified.data(),
+                            previous.data(),
+                            previous.size(),
+                            vertices.data(),
+                            vertexCount,
+                            vertexSize,
+                            nullptr,
+                            targetCount,
+                            settings.lodMaxError,
+                            &levelError
+                        );
+                    }
+
+                    if (count == 0 || count >= previous.size())
+                    {
+                        break;
+                    }
+
+                    simplified.resize(count);
+                    if (settings.optimize)
+                    {
+                        meshopt_optimizeVertexCache(simplified.data(), simplified.data(), count, vertexCount);
+                    }
+
+                    relativeError += levelError;
+                    chains[s].push_back(SubmeshLod{
+                        static_cast<uint32_t>(indices.size()),
+                        static_cast<uint32_t>(count),
+                        relativeError * errorScale
+                    });
+                    indices.insert(indices.end(), simplified.begin(), simplified.end());
+                    previous = std::move(simplified);
+                }
+
+                lodCount = std::max(lodCount, static_cast<uint32_t>(chains[s].size()) + 1);
+            }
+
+            outLods.clear();
+            outLods.reserve(submeshes.size() * (lodCount - 1));
+            for (size_t s = 0; s < submeshes.size(); ++s)
             {
-                return {0.0f, 0.0f, 0.0f};
+                auto last = SubmeshLod{submeshes[s].indexOffset, submeshes[s].indexCount, 0.0f};
+                for (auto lod = 1u; lod < lodCount; ++lod)
+                {
+                    if (lod - 1 < chains[s].size())
+                    {
+                        last = chains[s][lod - 1];
+                    }
+                    outLods.push_back(last);
+                }
             }
 
-            auto const invLen = 1.0f / std::sqrt(lengthSq);
-            return {value[0] * invLen, value[1] * invLen, value[2] * invLen};
+            return lodCount;
         }
 
-        auto crossVec3(std::array<float, 3> const& a, std::array<float, 3> const& b) -> std::array<float, 3>
+        /**
+         * Cluster the full-detail range of every submesh into meshlets with bounding spheres and normal cones.
+         * Meshlets never straddle submeshes so each one keeps a single material.
+         */
+        auto buildMeshlets(
+            std::vector<float> const& vertices,
+            std::vector<uint32_t> const& indices,
+            std::vector<Submesh> const& submeshes,
+            size_t vertexStrideFloats,
+            MeshImportSettings const& settings,
+            GltfMeshData& outData
+        ) -> void
         {
-            return {
-                a[1] * b[2] - a[2] * b[1],
-                a[2] * b[0] - a[0] * b[2],
-                a[0] * b[1] - a[1] * b[0]
-            };
-        }
+            auto const vertexCount = vertices.size() / vertexStrideFloats;
+            auto const vertexSize = vertexStrideFloats * sizeof(float);
+            auto const maxVertices = static_cast<size_t>(std::clamp(settings.meshletMaxVertices, 3u, 256u));
+            auto const maxTriangles = static_cast<size_t>(std::clamp(settings.meshletMaxTriangles, 1u, 512u));
+            auto const coneWeight = std::clamp(settings.meshletConeWeight, 0.0f, 1.0f);
 
-        auto dotVec3(std::array<float, 3> const& a, std::array<float, 3> const& b) -> float
-        {
-            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+            for (size_t s = 0; s < submeshes.size(); ++s)
+            {
+                auto const& submesh = submeshes[s];
+                if (submesh.indexCount < 3)
+                {
+                    continue;
+                }
+
+                auto localMeshlets = std::vector<meshopt_Meshlet>(
+                    meshopt_buildMeshletsBound(submesh.indexCount, maxVertices, maxTriangles));
+                auto localVertices = std::vector<unsigned int>(submesh.indexCount);
+                auto localTriangles = std::vector<unsigned char>(submesh.indexCount);
+
+                auto const meshletCount = meshopt_buildMeshlets(
+                    localMeshlets.data(),
+                    localVertices.data(),
+                    localTriangles.data(),
+                    indices.data() + submesh.indexOffset,
+                    submesh.indexCount,
+                    vertices.data(),
+                    vertexCount,
+                    vertexSize,
+                    maxVertices,
+                    maxTriangles,
+                    coneWeight
+                );
+
+                for (size_t m = 0; m < meshletCount; ++m)
+                {
+                    auto const& local = localMeshlets[m];
+                    auto* pVertices = localVertices.data() + local.vertex_offset;
+                    auto* pTriangles = localTriangles.data() + local.triangle_offset;
+
+                    meshopt_optimizeMeshlet(pVertices, pTriangles, local.triangle_count, local.vertex_count);
+                    auto const bounds = meshopt_computeMeshletBounds(
+                        pVertices,
+                        pTriangles,
+                        local.triangle_count,
+                        vertices.data(),
+                        vertexCount,
+                        vertexSize
+                    );
+
+                    auto meshlet = Meshlet{};
+                    meshlet.vertexOffset = static_cast<uint32_t>(outData.meshletVertices.size());
+                    meshlet.triangleOffset = static_cast<uint32_t>(outData.meshletTriangles.size());
+                    meshlet.vertexCount = local.vertex_count;
+                    meshlet.triangleCount = local.triangle_count;
+                    std::copy_n(bounds.center, 3, meshlet.center);
+                    meshlet.radius = bounds.radius;
+                    std::copy_n(bounds.cone_apex, 3, meshlet.coneApex);
+                    std::copy_n(bounds.cone_axis, 3, meshlet.coneAxis);
+                    meshlet.coneCutoff = bounds.cone_cutoff;
+                    meshlet.submeshIndex = static_cast<uint32_t>(s);
+                    outData.meshlets.push_back(meshlet);
+
+                    outData.meshletVertices.insert(outData.meshletVertices.end(), pVertices, pVertices + local.vertex_count);
+                    outData.meshletTriangles.insert(outData.meshletTriangles.end(), pTriangles, pTriangles + local.triangle_count * 3);
+                    outData.meshletTriangles.resize((outData.meshletTriangles.size() + 3) & ~size_t{3}, 0);
+                }
+            }
         }
 
-        auto generateTangents(std::vector<float>& vertices, std::vector<uint32_t> const& indices, size_t vertexStrideFloats) -> bool
+        /**
+         * Octahedral mapping of a unit vector to [-1, 1]^2, quantized to Snorm16.
+         */
+        auto encodeOctahedral(float x, float y, float z) -> std::array<int16_t, 2>
         {
-            if (vertexStrideFloats < 12 || indices.size() < 3)
+            auto const l1 = std::abs(x) + std::abs(y) + std::abs(z);
+            if (l1 <= 0.0f)
             {
-                return false;
+                return {0, 0};
             }
 
-            auto const vertexCount = vertices.size() / vertexStrideFloats;
-            if (vertexCount == 0)
+            auto u = x / l1;
+            auto v = y / l1;
+            if (z < 0.0f)
             {
-                return false;
+                auto const foldedU = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+                auto const foldedV = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+                u = foldedU;
+                v = foldedV;
             }
 
-            auto tan1 = std::vector<std::array<float, 3>>(vertexCount, {0.0f, 0.0f, 0.0f});
-            auto tan2 = std::vector<std::array<float, 3>>(vertexCount, {0.0f, 0.0f, 0.0f});
-
-            auto fetchVec3 = [&](size_t vertexIndex, size_t offset) -> std::array<float, 3>
-            {
-                auto const base = vertexIndex * vertexStrideFloats + offset;
-                return {vertices[base + 0], vertices[base + 1], vertices[base + 2]};
+            return {
+                static_cast<int16_t>(meshopt_quantizeSnorm(u, 16)),
+                static_cast<int16_t>(meshopt_quantizeSnorm(v, 16))
             };
+        }
+
+        /**
+         * Quantize standard float vertices (pos3, norm3, tan4, uv2) into CompactVertex.
+         * Positions are stored relative to the mesh bounds; a flat axis quantizes to 0.
+         */
+        auto packCompactVertices(
+            std::vector<float> const& vertices,
+            size_t vertexStrideFloats,
+            std::array<float, 3> const& boundsMin,
+            std::array<float, 3> const& boundsMax
+        ) -> std::vector<CompactVertex>
+        {
+            auto const vertexCount = vertices.size() / vertexStrideFloats;
+            auto packed = std::vector<CompactVertex>(vertexCount);
 
-            auto fetchVec2 = [&](size_t vertexIndex, size_t offset) -> std::array<float, 2>
+            auto invExtent = std::array<float, 3>{};
+            for (size_t axis = 0; axis < 3; ++axis)
             {
-                auto const base = vertexIndex * vertexStrideFloats + offset;
-                return {vertices[base + 0], vertices[base + 1]};
-            };
+                auto const extent = boundsMax[axis] - boundsMin[axis];
+                invExtent[axis] = extent > 0.0f ? 1.0f / extent : 0.0f;
+            }
 
-            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            for (size_t v = 0; v < vertexCount; ++v)
             {
-                auto const i0 = static_cast<size_t>(indices[i + 0]);
-                auto const i1 = static_cast<size_t>(indices[i + 1]);
-                auto const i2 = static_cast<size_t>(indices[i + 2]);
-                if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+                auto const* src = vertices.data() + v * vertexStrideFloats;
+                auto& dst = packed[v];
+
+                for (size_t axis = 0; axis < 3; ++axis)
                 {
-                    continue;
+                    auto const t = std::clamp((src[axis] - boundsMin[axis]) * invExtent[axis], 0.0f, 1.0f);
+                    dst.position[axis] = static_cast<uint16_t>(meshopt_quantizeUnorm(t, 16));
                 }
+                dst.position[3] = src[9] < 0.0f ? 0 : 65535;
+
+                auto const normal = encodeOctahedral(src[3], src[4], src[5]);
+                auto const tangent = encodeOctahedral(src[6], src[7], src[8]);
+                dst.normal[0] = normal[0];
+                dst.normal[1] = normal[1];
+                dst.tangent[0] = tangent[0];
+                dst.tangent[1] = tangent[1];
+                dst.texCoord[0] = meshopt_quantizeHalf(src[10]);
+                dst.texCoord[1] = meshopt_quantizeHalf(src[11]);
+            }
 
-                auto const p0 = fetchVec3(i0, 0);
-                auto const p1 = fetchVec3(i1, 0);
-                auto const p2 = fetchVec3(i2, 0);
-
-                auto const uv0 = fetchVec2(i0, 10);
-                auto const uv1 = fetchVec2(i1, 10);
-                auto const uv2 = fetchVec2(i2, 10);
-
-                auto const x1 = p1[0] - p0[0];
-                auto const y1 = p1[1] - p0[1];
-                auto const z1 = p1[2] - p0[2];
-                auto const x2 = p2[0] - p0[0];
-                auto const y2 = p2[1] - p0[1];
-                auto const z2 = p2[2] - p0[2];
+            return packed;
+        }
 
-                auto const s1 = uv1[0] - uv0[0];
-                auto const t1 = uv1[1] - uv0[1];
-                auto const s2 = uv2[0] - uv0[0];
-                auto const t2 = uv2[1] - uv0[1];
+        auto alignBlobOffset(size_t offset) -> size_t
+        {
+            return (offset + 3) & ~size_t{3};
+        }
 
-                auto const denom = (s1 * t2 - s2 * t1);
-                if (std::abs(denom) < 1e-8f)
+        auto getNodeMatrix(tinygltf::Node const& node) -> float4x4
+        {
+            auto matrix = float4x4{1.0f};
+            if (node.matrix.size() == 16)
+            {
+                // glTF matrices are column-major, like glm.
+                for (int c = 0; c < 4; ++c)
                 {
-                    continue;
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        matrix[c][r] = static_cast<float>(node.matrix[c * 4 + r]);
+                    }
                 }
+                return matrix;
+            }
 
-                auto const r = 1.0f / denom;
-                auto const sdir = std::array<float, 3>{
-                    (x1 * t2 - x2 * t1) * r,
-                    (y1 * t2 - y2 * t1) * r,
-                    (z1 * t2 - z2 * t1) * r
-                };
-                auto const tdir = std::array<float, 3>{
-                    (x2 * s1 - x1 * s2) * r,
-                    (y2 * s1 - y1 * s2) * r,
-                    (z2 * s1 - z1 * s2) * r
+            if (node.translation.size() == 3)
+            {
+                matrix = glm::translate(matrix, float3{
+                    static_cast<float>(node.translation[0]),
+                    static_cast<float>(node.translation[1]),
+                    static_cast<float>(node.translation[2])
+                });
+            }
+            if (node.rotation.size() == 4)
+            {
+                auto const rotation = quaternion{
+                    static_cast<float>(node.rotation[3]),
+                    static_cast<float>(node.rotation[0]),
+                    static_cast<float>(node.rotation[1]),
+                    static_cast<float>(node.rotation[2])
                 };
+                matrix = matrix * glm::mat4_cast(rotation);
+            }
+            if (node.scale.size() == 3)
+            {
+                matrix = glm::scale(matrix, float3{
+                    static_cast<float>(node.scale[0]),
+                    static_cast<float>(node.scale[1]),
+                    static_cast<float>(node.scale[2])
+                });
+            }
+            return matrix;
+        }
 
-                for (auto const idx : {i0, i1, i2})
+        /**
+         * Flatten the default scene into parents-first order. Without a scene every unparented node is a root.
+         * Nodes reachable twice (malformed files) are emitted once.
+         */
+        auto buildSceneNodes(tinygltf::Model const& model) -> std::vector<SceneNode>
+        {
+            auto const nodeCount = static_cast<int>(model.nodes.size());
+            auto roots = std::vector<int>{};
+            if (!model.scenes.empty())
+            {
+                auto const sceneIndex = model.defaultScene >= 0 && model.defaultScene < static_cast<int>(model.scenes.size())
+                    ? model.defaultScene
+                    : 0;
+                roots = model.scenes[sceneIndex].nodes;
+            }
+            else
+            {
+                auto isChild = std::vector<bool>(model.nodes.size(), false);
+                for (auto const& node : model.nodes)
+                {
+                    for (auto const child : node.children)
+                    {
+                        if (child >= 0 && child < nodeCount)
+                        {
+                            isChild[child] = true;
+                        }
+                    }
+                }
+                for (int i = 0; i < nodeCount; ++i)
                 {
-                    tan1[idx][0] += sdir[0];
-                    tan1[idx][1] += sdir[1];
-                    tan1[idx][2] += sdir[2];
-                    tan2[idx][0] += tdir[0];
-                    tan2[idx][1] += tdir[1];
-                    tan2[idx][2] += tdir[2];
+                    if (!isChild[i])
+                    {
+                        roots.push_back(i);
+                    }
                 }
             }
 
-            for (size_t i = 0; i < vertexCount; ++i)
+            auto nodes = std::vector<SceneNode>{};
+            nodes.reserve(model.nodes.size());
+            auto visited = std::vector<bool>(model.nodes.size(), false);
+            auto pending = std::vector<std::pair<int, int32_t>>{}; // glTF node, parent slot
+            for (auto it = roots.rbegin(); it != roots.rend(); ++it)
             {
-                auto const normal = normalizeVec3(fetchVec3(i, 3));
-                auto tangent = tan1[i];
-
-                auto const nDotT = dotVec3(normal, tangent);
-                tangent = {
-                    tangent[0] - normal[0] * nDotT,
-                    tangent[1] - normal[1] * nDotT,
-                    tangent[2] - normal[2] * nDotT
-                };
-                tangent = normalizeVec3(tangent);
+                pending.emplace_back(*it, -1);
+            }
 
-                auto w = 1.0f;
-                auto const bitangent = tan2[i];
-                if (dotVec3(crossVec3(normal, tangent), bitangent) < 0.0f)
+            while (!pending.empty())
+            {
+                auto const [nodeIndex, parent] = pending.back();
+                pending.pop_back();
+                if (nodeIndex < 0 || nodeIndex >= nodeCount || visited[nodeIndex])
                 {
-                    w = -1.0f;
+                    continue;
                 }
-
-                if (tangent[0] == 0.0f && tangent[1] == 0.0f && tangent[2] == 0.0f)
+                visited[nodeIndex] = true;
+
+                auto const& gltfNode = model.nodes[nodeIndex];
+                auto node = SceneNode{};
+                node.name = gltfNode.name.empty() ? std::format("node{}", nodeIndex) : gltfNode.name;
+                node.parent = parent;
+                node.mesh = gltfNode.mesh >= 0 && gltfNode.mesh < static_cast<int>(model.meshes.size()) ? gltfNode.mesh : -1;
+                node.localMatrix = getNodeMatrix(gltfNode);
+
+                auto const slot = static_cast<int32_t>(nodes.size());
+                nodes.push_back(std::move(node));
+                for (auto it = gltfNode.children.rbegin(); it != gltfNode.children.rend(); ++it)
                 {
-                    tangent = {1.0f, 0.0f, 0.0f};
-                    w = 1.0f;
+                    pending.emplace_back(*it, slot);
                 }
-
-                auto const base = i * vertexStrideFloats + 6;
-                vertices[base + 0] = tangent[0];
-                vertices[base + 1] = tangent[1];
-                vertices[base + 2] = tangent[2];
-                vertices[base + 3] = w;
             }
 
-            return true;
+            return nodes;
         }
     }
 
@@ -449,36 +891,47 @@ namespace april::asset
 
         auto sourcePath = context.sourcePath;
 
-        auto meshAsset = std::make_shared<StaticMeshAsset>();
-        meshAsset->setSourcePath(sourcePath.string());
-        meshAsset->setAssetPath(sourcePath.string() + ".asset");
-
-        if (!context.importMaterials)
+        auto const document = loadSharedModel(sourcePath, context.sourceCache);
+        if (!document)
         {
-            result.primaryAsset = meshAsset;
-            result.assets.push_back(meshAsset);
+            result.errors.push_back("Failed to load glTF file");
             return result;
         }
 
-        auto materialsData = importMaterials(sourcePath);
-        if (!materialsData)
+        auto const& model = document->model;
+
+        if (model.meshes.empty())
         {
-            result.errors.push_back("Failed to load GLTF materials");
+            result.errors.push_back("No meshes found in glTF file");
             return result;
         }
+
+        // Assets cut from an earlier import keep their GUIDs (and user settings) so references stay valid.
+        auto findExisting = [&](std::string const& assetPath, AssetType type) -> std::shared_ptr<Asset>
+        {
+            if (!context.reuseExistingAssets || !context.findAssetBySource)
+            {
+                return nullptr;
+            }
+            auto existing = context.findAssetBySource(assetPath, type);
+            return existing && existing->getType() == type ? existing : nullptr;
+        };
+
         auto materialSlots = std::vector<MaterialSlot>{};
         auto materialAssets = std::vector<std::shared_ptr<MaterialAsset>>{};
-        auto textureRefs = context.importTextures ? importTextures(*materialsData, context)
-                                                   : std::unordered_map<std::string, AssetRef>{};
-        materialSlots = importMaterialAssets(
-            *materialsData,
-            textureRefs,
-            sourcePath.parent_path(),
-            context,
-            materialAssets
-        );
-
-        meshAsset->m_materialSlots = materialSlots;
+        if (context.importMaterials)
+        {
+            auto const materialsData = extractMaterials(*document, sourcePath);
+            auto textureRefs = context.importTextures ? importTextures(materialsData, context)
+                                                       : std::unordered_map<std::string, AssetRef>{};
+            materialSlots = importMaterialAssets(
+                materialsData,
+                textureRefs,
+                sourcePath.parent_path(),
+                context,
+                materialAssets
+            );
+        }
 
         auto meshRefs = std::vector<AssetRef>{};
         meshRefs.reserve(materialSlots.size());
@@ -486,10 +939,51 @@ namespace april::asset
         {
             meshRefs.push_back(slot.materialRef);
         }
-        meshAsset->setReferences(std::move(meshRefs));
 
-        result.primaryAsset = meshAsset;
-        result.assets.push_back(meshAsset);
+        auto sceneMeshes = std::vector<AssetRef>{};
+        sceneMeshes.reserve(model.meshes.size());
+        for (size_t i = 0; i < model.meshes.size(); ++i)
+        {
+            auto const assetPath = i == 0 ? sourcePath.string() + ".asset"
+                                          : std::format("{}.mesh{}.asset", sourcePath.string(), i);
+
+            auto meshAsset = std::static_pointer_cast<StaticMeshAsset>(findExisting(assetPath, AssetType::Mesh));
+            if (!meshAsset)
+            {
+                meshAsset = std::make_shared<StaticMeshAsset>();
+            }
+            meshAsset->setSourcePath(sourcePath.string());
+            meshAsset->setAssetPath(assetPath);
+            meshAsset->m_sourceMeshIndex = static_cast<uint32_t>(i);
+            if (context.importMaterials)
+            {
+                // Submesh material indices are glTF material indices, so every mesh gets the full slot table.
+                meshAsset->m_materialSlots = materialSlots;
+                meshAsset->setReferences(meshRefs);
+            }
+
+            sceneMeshes.push_back(AssetRef{meshAsset->getHandle(), 0});
+            result.assets.push_back(meshAsset);
+        }
+
+        result.primaryAsset = result.assets.front();
+
+        if (!model.nodes.empty())
+        {
+            auto const scenePath = sourcePath.string() + ".scene.asset";
+            auto sceneAsset = std::static_pointer_cast<SceneAsset>(findExisting(scenePath, AssetType::Scene));
+            if (!sceneAsset)
+            {
+                sceneAsset = std::make_shared<SceneAsset>();
+            }
+            sceneAsset->setSourcePath(sourcePath.string());
+            sceneAsset->setAssetPath(scenePath);
+            sceneAsset->m_meshes = std::move(sceneMeshes);
+            sceneAsset->m_nodes = buildSceneNodes(model);
+            AP_INFO("[GltfImporter] Scene: {} nodes, {} meshes", sceneAsset->m_nodes.size(), sceneAsset->m_meshes.size());
+            result.assets.push_back(sceneAsset);
+        }
+
         for (auto const& material : materialAssets)
         {
             result.assets.push_back(material);
@@ -516,12 +1010,13 @@ namespace april::asset
 
         auto settingsJson = nlohmann::json{};
         settingsJson["settings"] = asset.m_settings;
+        settingsJson["sourceMeshIndex"] = asset.m_sourceMeshIndex;
         auto settingsHash = hashJson(settingsJson);
 
         auto sourceHash = hashFileContents(context.sourcePath.empty() ? asset.getSourcePath() : context.sourcePath);
         auto depsHash = hashDependencies(context.deps.deps);
 
-        constexpr auto kMeshToolchainTag = "tinygltf@unknown|meshopt@unknown|meshblob@1";
+        constexpr auto kMeshToolchainTag = "tinygltf@unknown|meshopt@unknown|meshblob@4|tangents@2";
         auto key = buildDdcKey(FingerprintInput{
             "MS",
             asset.getHandle().toString(),
@@ -540,7 +1035,14 @@ namespace april::asset
             return result;
         }
 
-        auto meshData = importMesh(sourcePath, asset.m_settings);
+        auto const document = loadSharedModel(sourcePath, context.sourceCache);
+        if (!document)
+        {
+            result.errors.push_back("Failed to load glTF file");
+            return result;
+        }
+
+        auto meshData = extractMesh(*document, asset.m_sourceMeshIndex, asset.m_settings, sourcePath);
         if (!meshData)
         {
             result.errors.push_back("Mesh import failed");
@@ -558,24 +1060,48 @@ namespace april::asset
         return result;
     }
 
+    auto GltfImporter::loadSharedModel(
+        std::filesystem::path const& sourcePath,
+        ImportSourceCache* sourceCache
+    ) const -> std::shared_ptr<GltfDocument const>
+    {
+        if (!sourceCache)
+        {
+            return loadDocument(sourcePath);
+        }
+        return sourceCache->getOrLoad<GltfDocument>(sourcePath.string(), [&] { return loadDocument(sourcePath); });
+    }
+
     auto GltfImporter::importMesh(
         std::filesystem::path const& sourcePath,
-        MeshImportSettings const& settings
+        MeshImportSettings const& settings,
+        uint32_t meshIndex
     ) const -> std::optional<GltfMeshData>
     {
-        auto model = tinygltf::Model{};
-        if (!loadModel(sourcePath, model))
+        auto const document = loadDocument(sourcePath);
+        if (!document)
         {
             return std::nullopt;
         }
 
-        if (model.meshes.empty())
+        return extractMesh(*document, meshIndex, settings, sourcePath);
+    }
+
+    auto GltfImporter::extractMesh(
+        GltfDocument const& document,
+        uint32_t meshIndex,
+        MeshImportSettings const& settings,
+        std::filesystem::path const& sourcePath
+    ) const -> std::optional<GltfMeshData>
+    {
+        auto const& model = document.model;
+        if (meshIndex >= model.meshes.size())
         {
-            AP_ERROR("[GltfImporter] No meshes found in glTF file: {}", sourcePath.string());
+            AP_ERROR("[GltfImporter] Mesh {} not found in glTF file ({} meshes): {}", meshIndex, model.meshes.size(), sourcePath.string());
             return std::nullopt;
         }
 
-        auto const& mesh = model.meshes[0];
+        auto const& mesh = model.meshes[meshIndex];
         auto vertices = std::vector<float>{};
         auto indices = std::vector<uint32_t>{};
         auto submeshes = std::vector<Submesh>{};
@@ -599,10 +1125,38 @@ namespace april::asset
             if (accessorIdx < 0) return {nullptr, 0};
 
             auto const& accessor = model.accessors[accessorIdx];
+            if (accessor.bufferView < 0 || accessor.bufferView >= static_cast<int>(model.bufferViews.size()))
+            {
+                return {nullptr, 0};
+            }
+
             auto const& bufferView = model.bufferViews[accessor.bufferView];
-            auto const& buffer = model.buffers[bufferView.buffer];
+            if (bufferView.buffer < 0 || bufferView.buffer >= static_cast<int>(document.buffers.size()))
+            {
+                return {nullptr, 0};
+            }
+
+            // Accessors read straight out of the mapped source; reject any that would run past their buffer.
+            auto const buffer = document.buffers[bufferView.buffer];
+            auto const componentSize = tinygltf::GetComponentSizeInBytes(static_cast<uint32_t>(accessor.componentType));
+            auto const componentCount = tinygltf::GetNumComponentsInType(static_cast<uint32_t>(accessor.type));
+            if (componentSize <= 0 || componentCount <= 0)
+            {
+                return {nullptr, 0};
+            }
 
-            uint8_t const* dataStart = buffer.data.data() + bufferView.byteOffset + accessor.byteOffset;
+            auto const elementSize = static_cast<size_t>(componentSize * componentCount);
+            auto const byteStride = accessor.ByteStride(bufferView);
+            auto const viewStride = byteStride > 0 ? static_cast<size_t>(byteStride) : elementSize;
+            auto const start = bufferView.byteOffset + accessor.byteOffset;
+            auto const end = accessor.count == 0 ? start : start + (accessor.count - 1) * viewStride + elementSize;
+            if (end > buffer.size() || end > bufferView.byteOffset + bufferView.byteLength)
+            {
+                AP_ERROR("[GltfImporter] Accessor {} reads past the end of buffer {}", accessorIdx, bufferView.buffer);
+                return {nullptr, 0};
+            }
+
+            uint8_t const* dataStart = reinterpret_cast<uint8_t const*>(buffer.data()) + start;
 
             auto stride = accessor.ByteStride(bufferView);
             if (stride == 0)
@@ -747,7 +1301,7 @@ namespace april::asset
 
         if (canGenerateTangents)
         {
-            generateTangents(vertices, indices, vertexStrideFloats);
+            generateTangents(vertices, indices);
         }
         else if (settings.generateTangents)
         {
@@ -923,26 +1477,51 @@ namespace april::asset
             }
         }
 
+        auto lods = std::vector<SubmeshLod>{};
+        auto lodCount = 1u;
+        if (settings.lodCount > 1 && !indices.empty() && !vertices.empty())
+        {
+            lodCount = buildLodChain(vertices, indices, submeshes, vertexStrideFloats, settings, lods);
+            AP_INFO("[GltfImporter]   - LODs: {} levels, {} indices total", lodCount, indices.size());
+        }
+
         auto result = GltfMeshData{};
         result.vertices = std::move(vertices);
         result.indices = std::move(indices);
         result.submeshes = std::move(submeshes);
+        result.lods = std::move(lods);
+        result.lodCount = lodCount;
+
+        if (settings.buildMeshlets && !result.indices.empty() && !result.vertices.empty())
+        {
+            buildMeshlets(result.vertices, result.indices, result.submeshes, vertexStrideFloats, settings, result);
+            AP_INFO("[GltfImporter]   - Meshlets: {} clusters", result.meshlets.size());
+        }
         result.boundsMin = boundsMin;
         result.boundsMax = boundsMax;
 
         return result;
     }
 
-        auto GltfImporter::importMaterials(
-            std::filesystem::path const& sourcePath
-        ) const -> std::optional<std::vector<GltfMaterialData>>
+    auto GltfImporter::importMaterials(
+        std::filesystem::path const& sourcePath
+    ) const -> std::optional<std::vector<GltfMaterialData>>
     {
-        auto model = tinygltf::Model{};
-        if (!loadModel(sourcePath, model))
+        auto const document = loadDocument(sourcePath);
+        if (!document)
         {
             return std::nullopt;
         }
 
+        return extractMaterials(*document, sourcePath);
+    }
+
+    auto GltfImporter::extractMaterials(
+        GltfDocument const& document,
+        std::filesystem::path const& sourcePath
+    ) const -> std::vector<GltfMaterialData>
+    {
+        auto const& model = document.model;
         auto baseDir = sourcePath.parent_path();
         auto materials = std::vector<GltfMaterialData>{};
         materials.reserve(model.materials.size());
@@ -981,11 +1560,11 @@ namespace april::asset
             auto materialData = GltfMaterialData{};
             materialData.name = materialName;
             materialData.parameters = parameters;
-            materialData.baseColorTexture = resolveTextureSource(model, pbr.baseColorTexture, baseDir, sourcePath);
-            materialData.metallicRoughnessTexture = resolveTextureSource(model, pbr.metallicRoughnessTexture, baseDir, sourcePath);
-            materialData.normalTexture = resolveTextureSource(model, gltfMaterial.normalTexture, baseDir, sourcePath);
-            materialData.occlusionTexture = resolveTextureSource(model, gltfMaterial.occlusionTexture, baseDir, sourcePath);
-            materialData.emissiveTexture = resolveTextureSource(model, gltfMaterial.emissiveTexture, baseDir, sourcePath);
+            materialData.baseColorTexture = resolveTextureSource(document, pbr.baseColorTexture, baseDir, sourcePath);
+            materialData.metallicRoughnessTexture = resolveTextureSource(document, pbr.metallicRoughnessTexture, baseDir, sourcePath);
+            materialData.normalTexture = resolveTextureSource(document, gltfMaterial.normalTexture, baseDir, sourcePath);
+            materialData.occlusionTexture = resolveTextureSource(document, gltfMaterial.occlusionTexture, baseDir, sourcePath);
+            materialData.emissiveTexture = resolveTextureSource(document, gltfMaterial.emissiveTexture, baseDir, sourcePath);
 
             materials.push_back(std::move(materialData));
         }
@@ -1149,7 +1728,7 @@ namespace april::asset
         auto sourceHash = hashFileContents(context.sourcePath.empty() ? asset.getSourcePath() : context.sourcePath);
         auto depsHash = hashDependencies(context.deps.deps);
 
-        constexpr auto kMeshToolchainTag = "tinygltf@unknown|meshopt@unknown|meshblob@1";
+        constexpr auto kMeshToolchainTag = "tinygltf@unknown|meshopt@unknown|meshblob@4|tangents@2";
         auto key = buildDdcKey(FingerprintInput{
             "MS",
             asset.getHandle().toString(),
@@ -1171,6 +1750,7 @@ namespace april::asset
         auto const& vertices = meshData.vertices;
         auto const& indices = meshData.indices;
         auto const& submeshes = meshData.submeshes;
+        auto const& lods = meshData.lods;
 
         if (vertices.empty() || indices.empty())
         {
@@ -1178,10 +1758,13 @@ namespace april::asset
             return {};
         }
 
+        auto const& settings = asset.m_settings;
+        auto const vertexCount = vertices.size() / vertexStrideFloats;
+
         auto header = MeshHeader{};
-        header.vertexCount = static_cast<uint32_t>(vertices.size() / vertexStrideFloats);
+        header.vertexCount = static_cast<uint32_t>(vertexCount);
         header.indexCount = static_cast<uint32_t>(indices.size());
-        header.vertexStride = vertexStrideFloats * sizeof(float);
+        header.vertexStride = kStandardVertexStride;
         header.indexFormat = 1;
         header.submeshCount = static_cast<uint32_t>(submeshes.size());
         header.flags = 0;
@@ -1191,13 +1774,96 @@ namespace april::asset
         header.boundsMax[0] = meshData.boundsMax[0];
         header.boundsMax[1] = meshData.boundsMax[1];
         header.boundsMax[2] = meshData.boundsMax[2];
-        header.vertexDataSize = vertices.size() * sizeof(float);
-        header.indexDataSize = indices.size() * sizeof(uint32_t);
+        header.lodCount = meshData.lodCount;
+
+        // LODs and meshlets were built from the float vertices; quantization only changes the stored layout.
+        auto vertexBytes = std::vector<std::byte>{};
+        if (settings.compactVertices)
+        {
+            auto const packed = packCompactVertices(vertices, vertexStrideFloats, meshData.boundsMin, meshData.boundsMax);
+            vertexBytes.resize(packed.size() * sizeof(CompactVertex));
+            std::memcpy(vertexBytes.data(), packed.data(), vertexBytes.size());
+            header.vertexStride = kCompactVertexStride;
+            header.flags |= VertexFlags::Compact;
+        }
+        else
+        {
+            vertexBytes.resize(vertices.size() * sizeof(float));
+            std::memcpy(vertexBytes.data(), vertices.data(), vertexBytes.size());
+        }
+
+        auto indexBytes = std::vector<std::byte>{};
+        if (settings.compactVertices && vertexCount <= 0x10000)
+        {
+            auto shortIndices = std::vector<uint16_t>(indices.begin(), indices.end());
+            indexBytes.resize(alignBlobOffset(shortIndices.size() * sizeof(uint16_t)));
+            std::memcpy(indexBytes.data(), shortIndices.data(), shortIndices.size() * sizeof(uint16_t));
+            header.indexFormat = 0;
+        }
+        else
+        {
+            indexBytes.resize(indices.size() * sizeof(uint32_t));
+            std::memcpy(indexBytes.data(), indices.data(), indexBytes.size());
+        }
 
-        auto totalSize = sizeof(MeshHeader) +
-                         submeshes.size() * sizeof(Submesh) +
-                         header.vertexDataSize +
-                         header.indexDataSize;
+        header.vertexDataSize = vertexBytes.size();
+        header.indexDataSize = indexBytes.size();
+
+        if (settings.compressPayload)
+        {
+            // Lossless apart from the index codec rotating triangle corners; it encodes the 32-bit list whatever the stored format.
+            auto encodedVertices = std::vector<std::byte>(meshopt_encodeVertexBufferBound(vertexCount, header.vertexStride));
+            encodedVertices.resize(meshopt_encodeVertexBuffer(
+                reinterpret_cast<unsigned char*>(encodedVertices.data()),
+                encodedVertices.size(),
+                vertexBytes.data(),
+                vertexCount,
+                header.vertexStride
+            ));
+
+            auto encodedIndices = std::vector<std::byte>(meshopt_encodeIndexBufferBound(indices.size(), vertexCount));
+            encodedIndices.resize(meshopt_encodeIndexBuffer(
+                reinterpret_cast<unsigned char*>(encodedIndices.data()),
+                encodedIndices.size(),
+                indices.data(),
+                indices.size()
+            ));
+
+            if (!encodedVertices.empty() && !encodedIndices.empty())
+            {
+                vertexBytes = std::move(encodedVertices);
+                indexBytes = std::move(encodedIndices);
+                header.vertexDataSize = vertexBytes.size();
+                header.indexDataSize = indexBytes.size();
+                header.flags |= MeshStorageFlags::EncodedVertexData | MeshStorageFlags::EncodedIndexData;
+            }
+            else
+            {
+                AP_WARN("[GltfImporter] Mesh codec failed, storing uncompressed data");
+            }
+        }
+
+        auto meshletSection = MeshletSectionHeader{};
+        if (!meshData.meshlets.empty())
+        {
+            meshletSection.meshletCount = static_cast<uint32_t>(meshData.meshlets.size());
+            meshletSection.vertexCount = static_cast<uint32_t>(meshData.meshletVertices.size());
+            meshletSection.triangleByteCount = static_cast<uint32_t>(meshData.meshletTriangles.size());
+            meshletSection.maxVertices = std::clamp(settings.meshletMaxVertices, 3u, 256u);
+            meshletSection.maxTriangles = std::clamp(settings.meshletMaxTriangles, 1u, 512u);
+            header.meshletSectionSize = static_cast<uint32_t>(
+                sizeof(MeshletSectionHeader) +
+                meshData.meshlets.size() * sizeof(Meshlet) +
+                meshData.meshletVertices.size() * sizeof(uint32_t) +
+                meshData.meshletTriangles.size()
+            );
+        }
+
+        // Encoded sections have arbitrary sizes, so the following section is realigned to 4 bytes.
+        auto const prefixSize = sizeof(MeshHeader) + submeshes.size() * sizeof(Submesh) + lods.size() * sizeof(SubmeshLod);
+        auto const indexOffset = alignBlobOffset(prefixSize + vertexBytes.size());
+        auto const meshletOffset = alignBlobOffset(indexOffset + indexBytes.size());
+        auto const totalSize = meshletOffset + header.meshletSectionSize;
 
         auto blob = std::vector<std::byte>(totalSize);
         auto offset = size_t{0};
@@ -1208,13 +1874,26 @@ namespace april::asset
         std::memcpy(blob.data() + offset, submeshes.data(), submeshes.size() * sizeof(Submesh));
         offset += submeshes.size() * sizeof(Submesh);
 
-        std::memcpy(blob.data() + offset, vertices.data(), header.vertexDataSize);
-        offset += header.vertexDataSize;
+        std::memcpy(blob.data() + offset, lods.data(), lods.size() * sizeof(SubmeshLod));
+        offset += lods.size() * sizeof(SubmeshLod);
+
+        std::memcpy(blob.data() + offset, vertexBytes.data(), vertexBytes.size());
+        std::memcpy(blob.data() + indexOffset, indexBytes.data(), indexBytes.size());
+        offset = meshletOffset;
 
-        std::memcpy(blob.data() + offset, indices.data(), header.indexDataSize);
+        if (header.meshletSectionSize > 0)
+        {
+            std::memcpy(blob.data() + offset, &meshletSection, sizeof(MeshletSectionHeader));
+            offset += sizeof(MeshletSectionHeader);
+            std::memcpy(blob.data() + offset, meshData.meshlets.data(), meshData.meshlets.size() * sizeof(Meshlet));
+            offset += meshData.meshlets.size() * sizeof(Meshlet);
+            std::memcpy(blob.data() + offset, meshData.meshletVertices.data(), meshData.meshletVertices.size() * sizeof(uint32_t));
+            offset += meshData.meshletVertices.size() * sizeof(uint32_t);
+            std::memcpy(blob.data() + offset, meshData.meshletTriangles.data(), meshData.meshletTriangles.size());
+        }
 
-        AP_INFO("[GltfImporter] Compiled mesh: {} vertices, {} indices, {} submeshes, {} bytes",
-                header.vertexCount, header.indexCount, header.submeshCount, blob.size());
+        AP_INFO("[GltfImporter] Compiled mesh: {} vertices, {} indices, {} submeshes, {} LODs, {} meshlets, {} bytes",
+                header.vertexCount, header.indexCount, header.submeshCount, header.lodCount, meshletSection.meshletCount, blob.size());
 
         auto value = DdcValue{};
         value.bytes = std::move(blob);
@@ -3,6 +3,7 @@
 #include "importer.hpp"
 #include "../blob-header.hpp"
 #include "../material-asset.hpp"
+#include "../scene-asset.hpp"
 #include "../static-mesh-asset.hpp"
 
 #include <array>
@@ -13,13 +14,10 @@
 #include <unordered_map>
 #include <vector>
 
-namespace tinygltf
-{
-    class Model;
-}
-
 namespace april::asset
 {
+    struct GltfDocument;
+
     struct GltfTextureSource
     {
         std::filesystem::path path{};
@@ -43,10 +41,20 @@ namespace april::asset
         std::vector<float> vertices{};
         std::vector<uint32_t> indices{};
         std::vector<Submesh> submeshes{};
+        std::vector<SubmeshLod> lods{};   // (lodCount - 1) entries per submesh
+        uint32_t lodCount{1};
+        std::vector<Meshlet> meshlets{};
+        std::vector<uint32_t> meshletVertices{};
+        std::vector<uint8_t> meshletTriangles{};    // Padded to 4 bytes per meshlet
         std::array<float, 3> boundsMin{};
         std::array<float, 3> boundsMax{};
     };
 
+    /**
+     * Imports a glTF file as one StaticMeshAsset per glTF mesh plus a SceneAsset holding the node tree.
+     * The first mesh keeps the "<source>.asset" path and stays the primary asset; mesh N > 0 is written to
+     * "<source>.meshN.asset" and the scene to "<source>.scene.asset". Nodes sharing a glTF mesh share the asset.
+     */
     class GltfImporter final : public IImporter
     {
     public:
@@ -60,7 +68,8 @@ namespace april::asset
         // Legacy API for direct mesh/material extraction (used internally)
         [[nodiscard]] auto importMesh(
             std::filesystem::path const& sourcePath,
-            MeshImportSettings const& settings
+            MeshImportSettings const& settings,
+            uint32_t meshIndex = 0
         ) const -> std::optional<GltfMeshData>;
 
         [[nodiscard]] auto importMaterials(
@@ -68,6 +77,24 @@ namespace april::asset
         ) const -> std::optional<std::vector<GltfMaterialData>>;
 
     private:
+        // Parse a source once per batch and share it between the import and the cooks of all meshes cut from it.
+        auto loadSharedModel(
+            std::filesystem::path const& sourcePath,
+            ImportSourceCache* sourceCache
+        ) const -> std::shared_ptr<GltfDocument const>;
+
+        auto extractMesh(
+            GltfDocument const& document,
+            uint32_t meshIndex,
+            MeshImportSettings const& settings,
+            std::filesystem::path const& sourcePath
+        ) const -> std::optional<GltfMeshData>;
+
+        auto extractMaterials(
+            GltfDocument const& document,
+            std::filesystem::path const& sourcePath
+        ) const -> std::vector<GltfMaterialData>;
+
         // Import textures from material data, with deduplication
         auto importTextures(
             std::vector<GltfMaterialData> const& materials,
@@ -9,8 +9,10 @@
 #include <format>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace april::asset
@@ -23,6 +25,56 @@ namespace april::asset
         auto addWeak(AssetRef const& asset) -> void { deps.push_back(Dependency{DepKind::Weak, asset}); }
     };
 
+    /**
+     * Parsed sources shared by the imports and cooks of one batch, so the assets cut from one file parse it once.
+     * Owned by whoever runs the batch and dropped with it (or per source via release), so nothing stays mapped
+     * after the batch. Sources load in parallel; concurrent requests for one source wait for a single load.
+     */
+    class ImportSourceCache
+    {
+    public:
+        template<typename T, typename Load>
+        auto getOrLoad(std::string const& sourcePath, Load&& load) -> std::shared_ptr<T const>
+        {
+            auto entry = std::shared_ptr<Entry>{};
+            {
+                auto lock = std::scoped_lock{m_mutex};
+                auto& slot = m_entries[sourcePath];
+                if (!slot)
+                {
+                    slot = std::make_shared<Entry>();
+                }
+                entry = slot;
+            }
+
+            auto lock = std::scoped_lock{entry->mutex};
+            if (!entry->loaded)
+            {
+                entry->value = std::shared_ptr<T const>{load()};
+                entry->loaded = true;
+            }
+            return std::static_pointer_cast<T const>(entry->value);
+        }
+
+        // Drop the parsed form of sourcePath; callers already holding it keep it alive until they finish.
+        auto release(std::string const& sourcePath) -> void
+        {
+            auto lock = std::scoped_lock{m_mutex};
+            m_entries.erase(sourcePath);
+        }
+
+    private:
+        struct Entry
+        {
+            std::mutex mutex{};
+            bool loaded{false};
+            std::shared_ptr<void const> value{};
+        };
+
+        std::mutex m_mutex{};
+        std::unordered_map<std::string, std::shared_ptr<Entry>> m_entries{};
+    };
+
     struct ImportSourceContext
     {
         std::filesystem::path sourcePath{};
@@ -30,6 +82,7 @@ namespace april::asset
         bool importMaterials{true};
         bool importTextures{true};
         bool reuseExistingAssets{true};
+        ImportSourceCache* sourceCache{nullptr};    // Shared with the cooks of the same batch; may be null
 
         // Check if asset exists by source path (for deduplication)
         std::function<std::shared_ptr<Asset>(std::filesystem::path const&, AssetType)> findAssetBySource{};
@@ -47,6 +100,7 @@ namespace april::asset
         IDdc& ddc;
         DepRecorder& deps;
         bool forceReimport = false;
+        ImportSourceCache* sourceCache = nullptr;   // Parsed sources of the current batch; may be null
     };
 
     struct ImportSourceResult
@@ -4,14 +4,22 @@
 #include "../texture-asset.hpp"
 #include "../ddc/ddc-key.hpp"
 #include "../ddc/ddc-utils.hpp"
+#include "../texture/bc-encoder.hpp"
+#include "../texture/mip-generator.hpp"
+#include "../texture/texture-analysis.hpp"
+#include "../texture/texture-container.hpp"
 
 #include <core/file/vfs.hpp>
 #include <core/log/logger.hpp>
+#include <core/thread/thread-pool.hpp>
 
 #include <stb/stb_image.h>
 
+#include <cctype>
 #include <cstring>
 #include <algorithm>
+#include <array>
+#include <optional>
 #include <span>
 #include <nlohmann/json.hpp>
 #include <vector>
@@ -20,7 +28,18 @@ namespace april::asset
 {
     auto TextureImporter::supportsExtension(std::string_view extension) const -> bool
     {
-        return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga";
+        return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" ||
+               isTextureContainerExtension(extension);
+    }
+
+    namespace
+    {
+        auto looksLikeNormalMap(std::filesystem::path const& sourcePath) -> bool
+        {
+            auto stem = sourcePath.stem().string();
+            std::ranges::transform(stem, stem.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return stem.contains("normal") || stem.ends_with("_n") || stem.ends_with("_nrm") || stem.ends_with("_nor");
+        }
     }
 
     auto TextureImporter::import(ImportSourceContext const& context) -> ImportSourceResult
@@ -31,6 +50,12 @@ namespace april::asset
         asset->setSourcePath(context.sourcePath.string());
         asset->setAssetPath(context.sourcePath.string() + ".asset");
 
+        if (looksLikeNormalMap(context.sourcePath))
+        {
+            asset->m_settings.normalMap = true;
+            asset->m_settings.sRGB = false;
+        }
+
         result.primaryAsset = asset;
         result.assets.push_back(asset);
         return result;
@@ -38,69 +63,221 @@ namespace april::asset
 
     namespace
     {
-        constexpr auto kTextureToolchainTag = "stb_image@unknown|texblob@1";
+        constexpr auto kTextureToolchainTag = "stb_image@unknown|texblob@2|bcenc@1|mipgen@1|texanalysis@1";
+
+        struct TextureEncoding
+        {
+            std::optional<BcFormat> blockFormat{};
+            PixelFormat format{PixelFormat::RGBA8Unorm};
+            uint32_t channels{4};
+            bool sRGB{false};
+        };
 
-        auto calculateMipLevels(int width, int height) -> uint32_t
+        auto isUncompressed(std::string const& compression) -> bool
         {
-            auto levels = uint32_t{1};
-            while (width > 1 || height > 1)
+            return compression.empty() || compression == "RGBA8";
+        }
+
+        // Channels the content lets us drop without changing what a shader samples: R8/BC4 read back as (r, 0, 0, 1)
+        // and RG8/BC5 as (r, g, 0, 1), so B must be 0 and A must be 255 everywhere. There are no sRGB variants.
+        auto reducibleChannels(TextureContentInfo const* content, bool sRGB, bool normalMap) -> uint32_t
+        {
+            if (!content || sRGB || normalMap || content->maxValue[2] != 0 || !content->hasOpaqueAlpha())
             {
-                width = std::max(1, width / 2);
-                height = std::max(1, height / 2);
-                ++levels;
+                return 4;
             }
-            return levels;
+            return content->maxValue[1] == 0 ? 1 : 2;
         }
 
-        auto downsampleRgba8(std::span<uint8_t const> src, int width, int height) -> std::vector<uint8_t>
+        auto selectEncoding(TextureImportSettings const& settings, int width, int height, TextureContentInfo const* content) -> TextureEncoding
         {
-            auto const nextWidth = std::max(1, width / 2);
-            auto const nextHeight = std::max(1, height / 2);
-            auto result = std::vector<uint8_t>(static_cast<size_t>(nextWidth * nextHeight * 4));
+            auto encoding = TextureEncoding{};
+            encoding.sRGB = settings.sRGB && !settings.normalMap;
+
+            if (!isUncompressed(settings.compression))
+            {
+                encoding.blockFormat = settings.normalMap ? std::optional{BcFormat::BC5} : parseBcFormat(settings.compression);
+            }
+
+            auto const channels = reducibleChannels(content, encoding.sRGB, settings.normalMap);
+            if (encoding.blockFormat && channels < 4)
+            {
+                // BC4 never grows the blob; BC5 only replaces the 16-byte RGBA formats.
+                if (channels == 1 && *encoding.blockFormat != BcFormat::BC5)
+                {
+                    encoding.blockFormat = BcFormat::BC4;
+                }
+                else if (*encoding.blockFormat == BcFormat::BC3 || *encoding.blockFormat == BcFormat::BC7)
+                {
+                    encoding.blockFormat = BcFormat::BC5;
+                }
+            }
+            if (encoding.blockFormat == BcFormat::BC3 && content && content->hasOpaqueAlpha())
+            {
+                // BC3 spends half of every block on alpha; BC1 stores the same color endpoints without it.
+                encoding.blockFormat = BcFormat::BC1;
+            }
+
+            // The RHI rounds block-compressed textures up to whole blocks, which would change the
+            // texel grid of unaligned images; keep those uncompressed.
+            if (encoding.blockFormat && (width % 4 != 0 || height % 4 != 0))
+            {
+                AP_WARN("[TextureImporter] {}x{} is not a multiple of the 4x4 block size; storing RGBA8", width, height);
+                encoding.blockFormat.reset();
+            }
 
-            for (auto y = 0; y < nextHeight; ++y)
+            if (!encoding.blockFormat)
             {
-                for (auto x = 0; x < nextWidth; ++x)
+                encoding.channels = channels;
+                switch (encoding.channels)
                 {
-                    auto const srcX = x * 2;
-                    auto const srcY = y * 2;
+                case 1:
+                    encoding.format = PixelFormat::R8Unorm;
+                    break;
+                case 2:
+                    encoding.format = PixelFormat::RG8Unorm;
+                    break;
+                default:
+                    encoding.format = encoding.sRGB ? PixelFormat::RGBA8UnormSrgb : PixelFormat::RGBA8Unorm;
+                    break;
+                }
+                return encoding;
+            }
 
-                    auto const x1 = std::min(srcX + 1, width - 1);
-                    auto const y1 = std::min(srcY + 1, height - 1);
+            switch (*encoding.blockFormat)
+            {
+            case BcFormat::BC1:
+                encoding.format = encoding.sRGB ? PixelFormat::BC1UnormSrgb : PixelFormat::BC1Unorm;
+                break;
+            case BcFormat::BC3:
+                encoding.format = encoding.sRGB ? PixelFormat::BC3UnormSrgb : PixelFormat::BC3Unorm;
+                break;
+            case BcFormat::BC4:
+                encoding.format = PixelFormat::BC4Unorm;
+                encoding.channels = 1;
+                encoding.sRGB = false;
+                break;
+            case BcFormat::BC5:
+                encoding.format = PixelFormat::BC5Unorm;
+                encoding.channels = 2;
+                encoding.sRGB = false;
+                break;
+            case BcFormat::BC7:
+                encoding.format = encoding.sRGB ? PixelFormat::BC7UnormSrgb : PixelFormat::BC7Unorm;
+                break;
+            }
+            return encoding;
+        }
 
-                    auto const idx00 = (srcY * width + srcX) * 4;
-                    auto const idx10 = (srcY * width + x1) * 4;
-                    auto const idx01 = (y1 * width + srcX) * 4;
-                    auto const idx11 = (y1 * width + x1) * 4;
+        auto buildTextureBlob(TextureHeader header, std::span<std::span<std::byte const> const> levels) -> std::vector<std::byte>
+        {
+            header.dataSize = 0;
+            for (auto const& level : levels)
+            {
+                header.dataSize += level.size();
+            }
 
-                    auto const dstIndex = (y * nextWidth + x) * 4;
+            auto blob = std::vector<std::byte>(sizeof(TextureHeader) + header.dataSize);
+            std::memcpy(blob.data(), &header, sizeof(TextureHeader));
 
-                    for (auto c = 0; c < 4; ++c)
-                    {
-                        auto sum = static_cast<uint32_t>(src[idx00 + c]) +
-                                   static_cast<uint32_t>(src[idx10 + c]) +
-                                   static_cast<uint32_t>(src[idx01 + c]) +
-                                   static_cast<uint32_t>(src[idx11 + c]);
-                        result[static_cast<size_t>(dstIndex + c)] = static_cast<uint8_t>(sum / 4);
-                    }
+            auto offset = sizeof(TextureHeader);
+            for (auto const& level : levels)
+            {
+                if (!level.empty())
+                {
+                    std::memcpy(blob.data() + offset, level.data(), level.size());
+                    offset += level.size();
                 }
             }
+            return blob;
+        }
 
-            return result;
+        auto recordContent(TextureHeader& header, TextureContentInfo const& content) -> void
+        {
+            header.flags |= TextureAnalyzed;
+            header.flags |= content.isConstant() ? TextureConstant : 0;
+            header.flags |= content.hasOpaqueAlpha() ? TextureOpaqueAlpha : 0;
+            header.flags |= content.grayscale ? TextureGrayscale : 0;
+            header.minValue = content.minValue;
+            header.maxValue = content.maxValue;
+        }
+
+        // Keep the first channelCount bytes of every RGBA8 texel.
+        auto extractChannels(std::span<uint8_t const> rgba, uint32_t channelCount) -> std::vector<uint8_t>
+        {
+            auto const texelCount = rgba.size() / 4;
+            auto packed = std::vector<uint8_t>(texelCount * channelCount);
+            for (size_t i = 0; i < texelCount; ++i)
+            {
+                std::memcpy(&packed[i * channelCount], &rgba[i * 4], channelCount);
+            }
+            return packed;
         }
 
-        auto appendBytes(std::vector<std::byte>& dst, std::span<uint8_t const> src) -> void
+        // A texture with a single color samples the same at any size, so store one RGBA8 texel. The source
+        // dimensions are dropped; the material can also read the value from the header and skip the texture.
+        auto compileConstantTexture(TextureContentInfo const& content, TextureImportSettings const& settings, int width, int height) -> std::vector<std::byte>
         {
-            auto const offset = dst.size();
-            dst.resize(offset + src.size());
-            if (!src.empty())
+            auto header = TextureHeader{};
+            header.width = 1;
+            header.height = 1;
+            header.channels = 4;
+            header.mipLevels = 1;
+
+            auto const sRGB = settings.sRGB && !settings.normalMap;
+            header.format = sRGB ? PixelFormat::RGBA8UnormSrgb : PixelFormat::RGBA8Unorm;
+            header.flags = sRGB ? TextureSrgb : 0;
+            recordContent(header, content);
+
+            auto const levels = std::array{std::span<std::byte const>{std::as_bytes(std::span{content.minValue})}};
+            auto blob = buildTextureBlob(header, levels);
+
+            AP_INFO("[TextureImporter] Constant texture {}x{} stored as one texel ({}, {}, {}, {})",
+                    width, height, content.minValue[0], content.minValue[1], content.minValue[2], content.minValue[3]);
+
+            return blob;
+        }
+
+        // DDS/KTX2 payloads are already in a GPU format: copy the mip chain into the blob as authored.
+        auto compileContainerTexture(std::string const& sourcePath, TextureImportSettings const& settings) -> std::vector<std::byte>
+        {
+            auto const file = VFS::mapFile(sourcePath);
+            if (!file)
             {
-                std::memcpy(dst.data() + offset, src.data(), src.size());
+                AP_ERROR("[TextureImporter] Failed to open image: {}", sourcePath);
+                return {};
             }
+
+            auto const texture = readTextureContainer(file->getData(), settings.sRGB && !settings.normalMap);
+            if (!texture)
+            {
+                AP_ERROR("[TextureImporter] Failed to read texture container: {}", sourcePath);
+                return {};
+            }
+
+            auto header = TextureHeader{};
+            header.width = texture->width;
+            header.height = texture->height;
+            header.channels = texture->channels;
+            header.format = texture->format;
+            header.mipLevels = static_cast<uint32_t>(texture->levels.size());
+            header.flags = texture->sRGB ? TextureSrgb : 0;
+
+            auto blob = buildTextureBlob(header, texture->levels);
+
+            AP_INFO("[TextureImporter] Passed through precompressed texture: {}x{} format {}, {} mips, {} bytes",
+                    header.width, header.height, static_cast<uint32_t>(header.format), header.mipLevels, blob.size());
+
+            return blob;
         }
 
         auto compileTexture(std::string const& sourcePath, TextureImportSettings const& settings) -> std::vector<std::byte>
         {
+            if (isTextureContainerExtension(std::filesystem::path{sourcePath}.extension().string()))
+            {
+                return compileContainerTexture(sourcePath, settings);
+            }
+
             auto sourceBytes = VFS::readBinaryFile(sourcePath);
             if (sourceBytes.empty())
             {
@@ -127,47 +304,79 @@ namespace april::asset
             }
 
             auto const dataSize = static_cast<size_t>(width) * height * desiredChannels;
-            auto const mipLevels = settings.generateMips ? calculateMipLevels(width, height) : 1u;
-            auto mipBytes = std::vector<std::byte>{};
-            mipBytes.reserve(dataSize);
+            auto const base = std::span<uint8_t const>{pixels, dataSize};
 
-            auto levelPixels = std::vector<uint8_t>(pixels, pixels + dataSize);
-            appendBytes(mipBytes, levelPixels);
+            auto const content = settings.analyzeContent
+                ? std::optional{analyzeTextureContent(base, static_cast<uint32_t>(width), static_cast<uint32_t>(height))}
+                : std::nullopt;
+            if (content && content->isConstant())
+            {
+                stbi_image_free(pixels);
+                return compileConstantTexture(*content, settings, width, height);
+            }
+
+            auto levels = std::vector<MipSurface>{};
+            if (settings.generateMips)
+            {
+                auto mipSettings = MipGenerationSettings{};
+                mipSettings.filter = parseMipFilter(settings.mipFilter);
+                mipSettings.sRGB = settings.sRGB && !settings.normalMap;
+                mipSettings.normalMap = settings.normalMap;
+                mipSettings.alphaCutoff = settings.alphaCutoff;
+                levels = generateMipChain(base, static_cast<uint32_t>(width), static_cast<uint32_t>(height), mipSettings);
+            }
+            else
+            {
+                levels.push_back(MipSurface{static_cast<uint32_t>(width), static_cast<uint32_t>(height), std::vector<uint8_t>(base.begin(), base.end())});
+            }
 
             stbi_image_free(pixels);
 
-            if (settings.generateMips)
+            auto const encoding = selectEncoding(settings, width, height, content ? &*content : nullptr);
+            if (encoding.blockFormat)
             {
-                auto currentWidth = width;
-                auto currentHeight = height;
-                while (currentWidth > 1 || currentHeight > 1)
+                // Mips are encoded concurrently; each surface additionally splits its block rows across the pool.
+                auto const quality = parseBcQuality(settings.quality);
+                core::ThreadPool::get().parallelFor(levels.size(), 1, [&](size_t begin, size_t end)
                 {
-                    auto nextPixels = downsampleRgba8(levelPixels, currentWidth, currentHeight);
-                    appendBytes(mipBytes, nextPixels);
-                    levelPixels = std::move(nextPixels);
-                    currentWidth = std::max(1, currentWidth / 2);
-                    currentHeight = std::max(1, currentHeight / 2);
+                    for (auto i = begin; i < end; ++i)
+                    {
+                        auto& level = levels[i];
+                        level.pixels = compressBcSurface(*encoding.blockFormat, level.pixels, level.width, level.height, quality);
+                    }
+                });
+            }
+            else if (encoding.channels < 4)
+            {
+                for (auto& level : levels)
+                {
+                    level.pixels = extractChannels(level.pixels, encoding.channels);
                 }
             }
 
+            auto levelBytes = std::vector<std::span<std::byte const>>{};
+            levelBytes.reserve(levels.size());
+            for (auto const& level : levels)
+            {
+                levelBytes.push_back(std::as_bytes(std::span{level.pixels}));
+            }
+
             auto header = TextureHeader{};
             header.width = static_cast<uint32_t>(width);
             header.height = static_cast<uint32_t>(height);
-            header.channels = desiredChannels;
-            header.format = settings.sRGB ? PixelFormat::RGBA8UnormSrgb : PixelFormat::RGBA8Unorm;
-            header.mipLevels = mipLevels;
-            header.flags = settings.sRGB ? 1 : 0;
-            header.dataSize = mipBytes.size();
-
-            auto blob = std::vector<std::byte>(sizeof(TextureHeader) + header.dataSize);
-            std::memcpy(blob.data(), &header, sizeof(TextureHeader));
-            if (!mipBytes.empty())
+            header.channels = encoding.channels;
+            header.format = encoding.format;
+            header.mipLevels = static_cast<uint32_t>(levels.size());
+            header.flags = encoding.sRGB ? TextureSrgb : 0;
+            if (content)
             {
-                std::memcpy(blob.data() + sizeof(TextureHeader), mipBytes.data(), mipBytes.size());
+                recordContent(header, *content);
             }
 
-            AP_INFO("[TextureImporter] Compiled texture: {}x{} {} channels, {} mips, {} bytes",
-                    header.width, header.height, header.channels, header.mipLevels, blob.size());
+            auto blob = buildTextureBlob(header, levelBytes);
+
+            AP_INFO("[TextureImporter] Compiled texture: {}x{} {} channels, format {}, {} mips, {} bytes",
+                    header.width, header.height, header.channels, static_cast<uint32_t>(header.format), header.mipLevels, blob.size());
 
             return blob;
         }
@@ -201,10 +410,16 @@ namespace april::asset
 
         auto result = ImportCookResult{};
 
-        if (!asset.m_settings.compression.empty() && asset.m_settings.compression != "RGBA8")
+        if (!isUncompressed(asset.m_settings.compression) && !parseBcFormat(asset.m_settings.compression))
+        {
+            result.warnings.push_back("unknown compression setting, storing RGBA8");
+            AP_WARN("[TextureImporter] Unknown compression '{}', storing RGBA8", asset.m_settings.compression);
+        }
+
+        if (isTextureContainerExtension(std::filesystem::path{sourcePath}.extension().string()) &&
+            !isUncompressed(asset.m_settings.compression))
         {
-            result.warnings.push_back("compression setting is not implemented yet");
-            AP_WARN("[TextureImporter] compression '{}' not implemented", asset.m_settings.compression);
+            result.warnings.push_back("compression setting is ignored for precompressed containers");
         }
 
         if (asset.m_settings.brightness != 1.0f)
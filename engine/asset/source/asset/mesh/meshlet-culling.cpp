@@ -0,0 +1,98 @@
+#include "meshlet-culling.hpp"
+
+namespace april::asset
+{
+    auto extractFrustumPlanes(float4x4 const& viewProjection) -> std::array<float4, 6>
+    {
+        auto const row = [&](int i) -> float4
+        {
+            return float4{viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]};
+        };
+
+        auto const r0 = row(0);
+        auto const r1 = row(1);
+        auto const r2 = row(2);
+        auto const r3 = row(3);
+
+        auto planes = std::array<float4, 6>{
+            r3 + r0,
+            r3 - r0,
+            r3 + r1,
+            r3 - r1,
+            r2, // Depth is [0, 1], so the near plane is z >= 0
+            r3 - r2
+        };
+
+        for (auto& plane : planes)
+        {
+            auto const length = glm::length(float3{plane});
+            if (length > 0.0f)
+            {
+                plane /= length;
+            }
+        }
+
+        return planes;
+    }
+
+    auto cullMeshlets(
+        std::span<Meshlet const> meshlets,
+        MeshletCullView const& view,
+        std::vector<uint32_t>* pVisible
+    ) -> MeshletCullStats
+    {
+        auto stats = MeshletCullStats{};
+        stats.meshletCount = static_cast<uint32_t>(meshlets.size());
+
+        auto const planes = extractFrustumPlanes(view.viewProjection);
+
+        for (size_t i = 0; i < meshlets.size(); ++i)
+        {
+            auto const& meshlet = meshlets[i];
+            stats.triangleCount += meshlet.triangleCount;
+
+            if (view.frustumCulling)
+            {
+                auto const center = float3{meshlet.center[0], meshlet.center[1], meshlet.center[2]};
+                auto outside = false;
+                for (auto const& plane : planes)
+                {
+                    if (glm::dot(float3{plane}, center) + plane.w < -meshlet.radius)
+                    {
+                        outside = true;
+                        break;
+                    }
+                }
+
+                if (outside)
+                {
+                    ++stats.frustumCulledCount;
+                    continue;
+                }
+            }
+
+            // A cutoff of 1 means the normals spread too far for the cone to prove anything.
+            if (view.coneCulling && meshlet.coneCutoff < 1.0f)
+            {
+                auto const apex = float3{meshlet.coneApex[0], meshlet.coneApex[1], meshlet.coneApex[2]};
+                auto const axis = float3{meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]};
+                auto const toApex = apex - view.cameraPosition;
+                auto const distance = glm::length(toApex);
+                if (distance > 0.0f && glm::dot(toApex, axis) >= meshlet.coneCutoff * distance)
+                {
+                    ++stats.coneCulledCount;
+                    continue;
+                }
+            }
+
+            ++stats.visibleMeshletCount;
+            stats.visibleTriangleCount += meshlet.triangleCount;
+            if (pVisible)
+            {
+                pVisible->push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        return stats;
+    }
+} // namespace april::asset
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../blob-header.hpp"
+
+#include <core/math/type.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace april::asset
+{
+    /**
+     * View used to cull meshlets. Everything is in the mesh's object space: fold the model matrix into
+     * viewProjection and move the camera into object space. Cone culling assumes the model matrix has no
+     * non-uniform scale.
+     */
+    struct MeshletCullView
+    {
+        float4x4 viewProjection{1.0f};  // Object space to clip space (depth in [0, 1])
+        float3 cameraPosition{0.0f};    // Camera position in object space
+        bool frustumCulling{true};
+        bool coneCulling{true};
+    };
+
+    struct MeshletCullStats
+    {
+        uint32_t meshletCount{0};
+        uint32_t visibleMeshletCount{0};
+        uint32_t frustumCulledCount{0};
+        uint32_t coneCulledCount{0};
+        uint64_t triangleCount{0};
+        uint64_t visibleTriangleCount{0};
+
+        [[nodiscard]] auto getCulledTriangleFraction() const -> float
+        {
+            return triangleCount == 0 ? 0.0f : 1.0f - static_cast<float>(visibleTriangleCount) / static_cast<float>(triangleCount);
+        }
+    };
+
+    /**
+     * Normalized planes (xyz = inward normal, w = distance) in left, right, bottom, top, near, far order.
+     */
+    auto extractFrustumPlanes(float4x4 const& viewProjection) -> std::array<float4, 6>;
+
+    /**
+     * CPU reference of the cluster culling a GPU-driven renderer performs: bounding sphere against the
+     * frustum, then the normal cone against the camera position.
+     * @param[out] pVisible Optional list receiving the indices of surviving meshlets.
+     */
+    auto cullMeshlets(
+        std::span<Meshlet const> meshlets,
+        MeshletCullView const& view,
+        std::vector<uint32_t>* pVisible = nullptr
+    ) -> MeshletCullStats;
+} // namespace april::asset
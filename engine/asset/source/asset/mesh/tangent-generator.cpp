@@ -0,0 +1,301 @@
+#include "tangent-generator.hpp"
+
+#include <core/math/type.hpp>
+#include <core/thread/thread-pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APRIL_TANGENT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace april::asset
+{
+    namespace
+    {
+        constexpr auto kTrianglesPerTask = size_t{8192}; // Multiple of the 4-wide batch
+        constexpr auto kVerticesPerTask = size_t{4096};
+
+        // Unit UV-space tangent of one triangle, already flipped by its UV orientation. sign is +1/-1, or 0 when the
+        // triangle has no usable UV mapping and must not contribute.
+        struct FaceTangent
+        {
+            float x{0.0f};
+            float y{0.0f};
+            float z{0.0f};
+            float sign{0.0f};
+        };
+        static_assert(sizeof(FaceTangent) == 4 * sizeof(float));
+
+        auto computeFaceTangent(float const* p0, float const* p1, float const* p2, float const* uv0, float const* uv1, float const* uv2) -> FaceTangent
+        {
+            auto const d1 = float3{p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+            auto const d2 = float3{p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+            auto const t21x = uv1[0] - uv0[0];
+            auto const t21y = uv1[1] - uv0[1];
+            auto const t31x = uv2[0] - uv0[0];
+            auto const t31y = uv2[1] - uv0[1];
+
+            auto const area = t21x * t31y - t21y * t31x;
+            auto const os = float3{
+                t31y * d1.x - t21y * d2.x,
+                t31y * d1.y - t21y * d2.y,
+                t31y * d1.z - t21y * d2.z
+            };
+            auto const lengthSq = os.x * os.x + os.y * os.y + os.z * os.z;
+            if (!(std::abs(area) > std::numeric_limits<float>::min()) || !(lengthSq > 0.0f))
+            {
+                return {};
+            }
+
+            auto const orient = area > 0.0f ? 1.0f : -1.0f;
+            auto const scale = orient / std::sqrt(lengthSq);
+            return {os.x * scale, os.y * scale, os.z * scale, orient};
+        }
+
+        auto isTriangleInRange(std::span<uint32_t const> indices, size_t triangle, size_t vertexCount) -> bool
+        {
+            auto const* corner = &indices[triangle * 3];
+            return corner[0] < vertexCount && corner[1] < vertexCount && corner[2] < vertexCount;
+        }
+
+        auto computeFaceTangents(
+            std::span<float const> vertices,
+            std::span<uint32_t const> indices,
+            size_t vertexCount,
+            TangentVertexLayout const& layout,
+            size_t firstTriangle,
+            size_t lastTriangle,
+            FaceTangent* faces
+        ) -> void
+        {
+            auto const position = [&](uint32_t vertex) { return &vertices[vertex * layout.strideFloats + layout.positionOffset]; };
+            auto const texCoord = [&](uint32_t vertex) { return &vertices[vertex * layout.strideFloats + layout.texCoordOffset]; };
+
+            auto triangle = firstTriangle;
+#ifdef APRIL_TANGENT_SSE2
+            // Gather four triangles into SoA lanes: p0, p1, p2 (xyz) then uv0, uv1, uv2 (xy).
+            for (; triangle + 4 <= lastTriangle; triangle += 4)
+            {
+                alignas(16) float lanes[15][4]{};
+                auto inRange = std::array<bool, 4>{};
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    inRange[lane] = isTriangleInRange(indices, triangle + lane, vertexCount);
+                    if (!inRange[lane])
+                    {
+                        continue;
+                    }
+
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        auto const vertex = indices[(triangle + lane) * 3 + corner];
+                        auto const* p = position(vertex);
+                        auto const* uv = texCoord(vertex);
+                        lanes[corner * 3 + 0][lane] = p[0];
+                        lanes[corner * 3 + 1][lane] = p[1];
+                        lanes[corner * 3 + 2][lane] = p[2];
+                        lanes[9 + corner * 2 + 0][lane] = uv[0];
+                        lanes[9 + corner * 2 + 1][lane] = uv[1];
+                    }
+                }
+
+                auto const load = [&](size_t row) { return _mm_load_ps(lanes[row]); };
+                auto const d1x = _mm_sub_ps(load(3), load(0));
+                auto const d1y = _mm_sub_ps(load(4), load(1));
+                auto const d1z = _mm_sub_ps(load(5), load(2));
+                auto const d2x = _mm_sub_ps(load(6), load(0));
+                auto const d2y = _mm_sub_ps(load(7), load(1));
+                auto const d2z = _mm_sub_ps(load(8), load(2));
+                auto const t21x = _mm_sub_ps(load(11), load(9));
+                auto const t21y = _mm_sub_ps(load(12), load(10));
+                auto const t31x = _mm_sub_ps(load(13), load(9));
+                auto const t31y = _mm_sub_ps(load(14), load(10));
+
+                auto const area = _mm_sub_ps(_mm_mul_ps(t21x, t31y), _mm_mul_ps(t21y, t31x));
+                auto const osx = _mm_sub_ps(_mm_mul_ps(t31y, d1x), _mm_mul_ps(t21y, d2x));
+                auto const osy = _mm_sub_ps(_mm_mul_ps(t31y, d1y), _mm_mul_ps(t21y, d2y));
+                auto const osz = _mm_sub_ps(_mm_mul_ps(t31y, d1z), _mm_mul_ps(t21y, d2z));
+                auto const lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(osx, osx), _mm_mul_ps(osy, osy)), _mm_mul_ps(osz, osz));
+
+                auto const signBit = _mm_set1_ps(-0.0f);
+                auto const usable = _mm_and_ps(
+                    _mm_cmpgt_ps(_mm_andnot_ps(signBit, area), _mm_set1_ps(std::numeric_limits<float>::min())),
+                    _mm_cmpgt_ps(lengthSq, _mm_setzero_ps())
+                );
+                auto const orient = _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(signBit, area));
+                auto const scale = _mm_div_ps(orient, _mm_sqrt_ps(lengthSq));
+
+                // Unusable lanes may hold inf/NaN here; masking clears them to the zero "no contribution" face.
+                auto x = _mm_and_ps(usable, _mm_mul_ps(osx, scale));
+                auto y = _mm_and_ps(usable, _mm_mul_ps(osy, scale));
+                auto z = _mm_and_ps(usable, _mm_mul_ps(osz, scale));
+                auto w = _mm_and_ps(usable, orient);
+                _MM_TRANSPOSE4_PS(x, y, z, w);
+                _mm_storeu_ps(&faces[triangle + 0].x, x);
+                _mm_storeu_ps(&faces[triangle + 1].x, y);
+                _mm_storeu_ps(&faces[triangle + 2].x, z);
+                _mm_storeu_ps(&faces[triangle + 3].x, w);
+
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    if (!inRange[lane])
+                    {
+                        faces[triangle + lane] = {};
+                    }
+                }
+            }
+#endif
+            for (; triangle < lastTriangle; ++triangle)
+            {
+                if (!isTriangleInRange(indices, triangle, vertexCount))
+                {
+                    faces[triangle] = {};
+                    continue;
+                }
+
+                auto const* corner = &indices[triangle * 3];
+                faces[triangle] = computeFaceTangent(
+                    position(corner[0]), position(corner[1]), position(corner[2]),
+                    texCoord(corner[0]), texCoord(corner[1]), texCoord(corner[2])
+                );
+            }
+        }
+
+        auto projectNormalized(float3 const& value, float3 const& normal) -> float3
+        {
+            auto const projected = value - normal * glm::dot(normal, value);
+            auto const lengthSq = glm::dot(projected, projected);
+            return lengthSq > 0.0f ? projected / std::sqrt(lengthSq) : float3{0.0f};
+        }
+
+        auto anyPerpendicular(float3 const& normal) -> float3
+        {
+            auto const axis = std::abs(normal.x) < 0.9f ? float3{1.0f, 0.0f, 0.0f} : float3{0.0f, 1.0f, 0.0f};
+            auto const tangent = projectNormalized(axis, normal);
+            return glm::dot(tangent, tangent) > 0.0f ? tangent : float3{1.0f, 0.0f, 0.0f};
+        }
+    } // namespace
+
+    auto generateTangents(
+        std::span<float> vertices,
+        std::span<uint32_t const> indices,
+        TangentVertexLayout const& layout
+    ) -> bool
+    {
+        auto const stride = layout.strideFloats;
+        auto const required = std::max({layout.positionOffset + 3, layout.normalOffset + 3, layout.tangentOffset + 4, layout.texCoordOffset + 2});
+        if (stride < required || indices.size() < 3)
+        {
+            return false;
+        }
+
+        auto const vertexCount = vertices.size() / stride;
+        auto const triangleCount = indices.size() / 3;
+        if (vertexCount == 0)
+        {
+            return false;
+        }
+
+        auto& pool = core::ThreadPool::get();
+
+        auto faces = std::vector<FaceTangent>(triangleCount);
+        pool.parallelFor(triangleCount, kTrianglesPerTask, [&](size_t begin, size_t end)
+        {
+            computeFaceTangents(vertices, indices, vertexCount, layout, begin, end, faces.data());
+        });
+
+        // Vertex -> corner table in triangle order, so every vertex gathers its contributions in a fixed order.
+        auto cornerOffsets = std::vector<uint32_t>(vertexCount + 1, 0);
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            if (faces[triangle].sign == 0.0f)
+            {
+                continue;
+            }
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                ++cornerOffsets[indices[triangle * 3 + corner] + 1];
+            }
+        }
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            cornerOffsets[vertex + 1] += cornerOffsets[vertex];
+        }
+
+        auto corners = std::vector<uint32_t>(cornerOffsets.back());
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            if (faces[triangle].sign == 0.0f)
+            {
+                continue;
+            }
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                auto& cursor = cornerOffsets[indices[triangle * 3 + corner]];
+                corners[cursor++] = static_cast<uint32_t>(triangle * 3 + corner);
+            }
+        }
+        // The fill advanced every start to the next vertex's start; shift back.
+        std::copy_backward(cornerOffsets.begin(), cornerOffsets.end() - 1, cornerOffsets.end());
+        cornerOffsets[0] = 0;
+
+        auto const fetch3 = [&](size_t vertex, size_t offset) -> float3
+        {
+            auto const* value = &vertices[vertex * stride + offset];
+            return float3{value[0], value[1], value[2]};
+        };
+
+        pool.parallelFor(vertexCount, kVerticesPerTask, [&](size_t begin, size_t end)
+        {
+            for (auto vertex = begin; vertex < end; ++vertex)
+            {
+                auto normal = fetch3(vertex, layout.normalOffset);
+                auto const normalLengthSq = glm::dot(normal, normal);
+                normal = normalLengthSq > 0.0f ? normal / std::sqrt(normalLengthSq) : float3{0.0f};
+
+                auto const position = fetch3(vertex, layout.positionOffset);
+                auto tangentSum = float3{0.0f};
+                auto signSum = 0.0f;
+
+                for (auto slot = cornerOffsets[vertex]; slot < cornerOffsets[vertex + 1]; ++slot)
+                {
+                    auto const triangle = corners[slot] / 3;
+                    auto const corner = corners[slot] % 3;
+                    auto const& face = faces[triangle];
+
+                    auto const faceTangent = projectNormalized(float3{face.x, face.y, face.z}, normal);
+                    auto const edgeNext = projectNormalized(fetch3(indices[triangle * 3 + (corner + 1) % 3], layout.positionOffset) - position, normal);
+                    auto const edgePrev = projectNormalized(fetch3(indices[triangle * 3 + (corner + 2) % 3], layout.positionOffset) - position, normal);
+                    if (glm::dot(faceTangent, faceTangent) == 0.0f || glm::dot(edgeNext, edgeNext) == 0.0f || glm::dot(edgePrev, edgePrev) == 0.0f)
+                    {
+                        continue;
+                    }
+
+                    auto const angle = std::acos(std::clamp(glm::dot(edgeNext, edgePrev), -1.0f, 1.0f));
+                    tangentSum += faceTangent * angle;
+                    signSum += face.sign * angle;
+                }
+
+                auto tangent = projectNormalized(tangentSum, normal);
+                if (glm::dot(tangent, tangent) == 0.0f)
+                {
+                    tangent = anyPerpendicular(normal);
+                }
+
+                auto* target = &vertices[vertex * stride + layout.tangentOffset];
+                target[0] = tangent.x;
+                target[1] = tangent.y;
+                target[2] = tangent.z;
+                target[3] = signSum < 0.0f ? -1.0f : 1.0f;
+            }
+        });
+
+        return true;
+    }
+} // namespace april::asset
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace april::asset
+{
+    /**
+     * Float offsets of the attributes read and written inside one interleaved vertex.
+     * The defaults match the importer's standard layout: position(3) normal(3) tangent(4) uv(2).
+     */
+    struct TangentVertexLayout
+    {
+        size_t strideFloats{12};
+        size_t positionOffset{0};
+        size_t normalOffset{3};
+        size_t tangentOffset{6};
+        size_t texCoordOffset{10};
+    };
+
+    /**
+     * Write MikkTSpace-style tangents (xyz + bitangent sign in w) for an indexed triangle list.
+     * Each corner contributes the face's UV-space tangent projected onto the vertex normal's plane,
+     * weighted by the corner angle; the sign follows the angle-weighted UV orientation. Vertices are
+     * not split, so a vertex shared by mirrored UV islands takes the dominant orientation.
+     *
+     * Face tangents are computed four triangles at a time with SSE, then vertices gather from a
+     * vertex-to-corner table. Both passes split their ranges across the shared core::ThreadPool, so
+     * the result is identical regardless of thread count. Triangles referencing out-of-range vertices
+     * are ignored; vertices without a usable triangle get an arbitrary tangent perpendicular to the normal.
+     * @return False if there are no triangles or the stride cannot hold the layout.
+     */
+    auto generateTangents(
+        std::span<float> vertices,
+        std::span<uint32_t const> indices,
+        TangentVertexLayout const& layout = {}
+    ) -> bool;
+} // namespace april::asset
@@ -0,0 +1,108 @@
+#include "scene-asset.hpp"
+
+#include <core/math/json.hpp>
+
+#include <algorithm>
+
+namespace april::asset
+{
+    auto to_json(nlohmann::json& j, SceneNode const& node) -> void
+    {
+        j["name"] = node.name;
+        j["parent"] = node.parent;
+        j["mesh"] = node.mesh;
+        j["localMatrix"] = node.localMatrix;
+    }
+
+    auto from_json(nlohmann::json const& j, SceneNode& node) -> void
+    {
+        if (j.contains("name")) node.name = j.at("name").get<std::string>();
+        if (j.contains("parent")) node.parent = j.at("parent").get<int32_t>();
+        if (j.contains("mesh")) node.mesh = j.at("mesh").get<int32_t>();
+        if (j.contains("localMatrix")) j.at("localMatrix").get_to(node.localMatrix);
+    }
+
+    auto SceneAsset::getInstanceCount(int32_t meshIndex) const -> uint32_t
+    {
+        return static_cast<uint32_t>(std::count_if(m_nodes.begin(), m_nodes.end(),
+            [meshIndex](SceneNode const& node) { return node.mesh == meshIndex; }));
+    }
+
+    auto SceneAsset::serializeJson(nlohmann::json& outJson) -> void
+    {
+        rebuildReferences();
+        Asset::serializeJson(outJson);
+
+        outJson["meshes"] = m_meshes;
+        outJson["nodes"] = m_nodes;
+    }
+
+    auto SceneAsset::deserializeJson(nlohmann::json const& inJson) -> bool
+    {
+        if (!Asset::deserializeJson(inJson)) return false;
+
+        if (inJson.contains("meshes"))
+        {
+            m_meshes = inJson["meshes"].get<std::vector<AssetRef>>();
+        }
+
+        if (inJson.contains("nodes"))
+        {
+            m_nodes = inJson["nodes"].get<std::vector<SceneNode>>();
+        }
+
+        // Drop links that would break the parents-first invariant instead of trusting hand-edited files.
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            auto& node = m_nodes[i];
+            if (node.parent >= static_cast<int32_t>(i))
+            {
+                node.parent = -1;
+            }
+            if (node.mesh >= static_cast<int32_t>(m_meshes.size()))
+            {
+                node.mesh = -1;
+            }
+        }
+
+        rebuildReferences();
+        return true;
+    }
+
+    auto SceneAsset::getMemoryUsage() const -> size_t
+    {
+        auto bytes = Asset::getMemoryUsage() + sizeof(SceneAsset) - sizeof(Asset) +
+            m_meshes.capacity() * sizeof(AssetRef) + m_nodes.capacity() * sizeof(SceneNode);
+        for (auto const& node : m_nodes)
+        {
+            bytes += node.name.capacity();
+        }
+        return bytes;
+    }
+
+    auto SceneAsset::rebuildReferences() -> void
+    {
+        auto refs = m_meshes;
+
+        std::sort(refs.begin(), refs.end(),
+            [](AssetRef const& lhs, AssetRef const& rhs) {
+                auto lhsGuid = lhs.guid.toString();
+                auto rhsGuid = rhs.guid.toString();
+                if (lhsGuid != rhsGuid)
+                {
+                    return lhsGuid < rhsGuid;
+                }
+                return lhs.subId < rhs.subId;
+            }
+        );
+
+        refs.erase(std::unique(refs.begin(), refs.end(),
+            [](AssetRef const& lhs, AssetRef const& rhs) {
+                return lhs.guid == rhs.guid && lhs.subId == rhs.subId;
+            }),
+            refs.end()
+        );
+
+        setReferences(std::move(refs));
+    }
+} // namespace april::asset
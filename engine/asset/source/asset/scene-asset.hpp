@@ -0,0 +1,49 @@
+#pragma once
+
+#include "asset.hpp"
+
+#include <core/math/type.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace april::asset
+{
+    /**
+     * One node of an imported hierarchy. Nodes are stored parents-first: a node's parent index is always
+     * smaller than its own, so a single forward pass can resolve world transforms.
+     */
+    struct SceneNode
+    {
+        std::string name{};
+        int32_t parent{-1};            // Index into SceneAsset::m_nodes, -1 for roots
+        int32_t mesh{-1};              // Index into SceneAsset::m_meshes, -1 for transform-only nodes
+        float4x4 localMatrix{1.0f};    // Relative to the parent
+    };
+
+    auto to_json(nlohmann::json& j, SceneNode const& node) -> void;
+    auto from_json(nlohmann::json const& j, SceneNode& node) -> void;
+
+    /**
+     * Node tree of a multi-mesh source file (a prefab). Every distinct source mesh appears once in m_meshes;
+     * nodes that reference the same entry are instances of one StaticMeshAsset.
+     */
+    class SceneAsset : public Asset
+    {
+    public:
+        SceneAsset() : Asset(AssetType::Scene) {}
+
+        std::vector<AssetRef> m_meshes{};
+        std::vector<SceneNode> m_nodes{};
+
+        [[nodiscard]] auto getInstanceCount(int32_t meshIndex) const -> uint32_t;
+
+        auto serializeJson(nlohmann::json& outJson) -> void override;
+        auto deserializeJson(nlohmann::json const& inJson) -> bool override;
+        [[nodiscard]] auto getMemoryUsage() const -> size_t override;
+
+    private:
+        auto rebuildReferences() -> void;
+    };
+} // namespace april::asset
@@ -22,6 +22,16 @@ namespace april::asset
         j["generateTangents"] = settings.generateTangents;
         j["flipWindingOrder"] = settings.flipWindingOrder;
         j["scale"] = settings.scale;
+        j["compactVertices"] = settings.compactVertices;
+        j["compressPayload"] = settings.compressPayload;
+        j["lodCount"] = settings.lodCount;
+        j["lodReduction"] = settings.lodReduction;
+        j["lodMaxError"] = settings.lodMaxError;
+        j["lodAllowSloppy"] = settings.lodAllowSloppy;
+        j["buildMeshlets"] = settings.buildMeshlets;
+        j["meshletMaxVertices"] = settings.meshletMaxVertices;
+        j["meshletMaxTriangles"] = settings.meshletMaxTriangles;
+        j["meshletConeWeight"] = settings.meshletConeWeight;
     }
 
     auto from_json(nlohmann::json const& j, MeshImportSettings& settings) -> void
@@ -30,6 +40,16 @@ namespace april::asset
         if (j.contains("generateTangents")) settings.generateTangents = j.at("generateTangents").get<bool>();
         if (j.contains("flipWindingOrder")) settings.flipWindingOrder = j.at("flipWindingOrder").get<bool>();
         if (j.contains("scale")) settings.scale = j.at("scale").get<float>();
+        if (j.contains("compactVertices")) settings.compactVertices = j.at("compactVertices").get<bool>();
+        if (j.contains("compressPayload")) settings.compressPayload = j.at("compressPayload").get<bool>();
+        if (j.contains("lodCount")) settings.lodCount = j.at("lodCount").get<uint32_t>();
+        if (j.contains("lodReduction")) settings.lodReduction = j.at("lodReduction").get<float>();
+        if (j.contains("lodMaxError")) settings.lodMaxError = j.at("lodMaxError").get<float>();
+        if (j.contains("lodAllowSloppy")) settings.lodAllowSloppy = j.at("lodAllowSloppy").get<bool>();
+        if (j.contains("buildMeshlets")) settings.buildMeshlets = j.at("buildMeshlets").get<bool>();
+        if (j.contains("meshletMaxVertices")) settings.meshletMaxVertices = j.at("meshletMaxVertices").get<uint32_t>();
+        if (j.contains("meshletMaxTriangles")) settings.meshletMaxTriangles = j.at("meshletMaxTriangles").get<uint32_t>();
+        if (j.contains("meshletConeWeight")) settings.meshletConeWeight = j.at("meshletConeWeight").get<float>();
     }
 
     auto StaticMeshAsset::serializeJson(nlohmann::json& outJson) -> void
@@ -39,6 +59,7 @@ namespace april::asset
 
         outJson["settings"] = m_settings;
         outJson["materialSlots"] = m_materialSlots;
+        outJson["sourceMeshIndex"] = m_sourceMeshIndex;
     }
 
     auto StaticMeshAsset::deserializeJson(nlohmann::json const& inJson) -> bool
@@ -55,10 +76,25 @@ namespace april::asset
             m_materialSlots = inJson["materialSlots"].get<std::vector<MaterialSlot>>();
         }
 
+        if (inJson.contains("sourceMeshIndex"))
+        {
+            m_sourceMeshIndex = inJson["sourceMeshIndex"].get<uint32_t>();
+        }
+
         rebuildReferences();
         return true;
     }
 
+    auto StaticMeshAsset::getMemoryUsage() const -> size_t
+    {
+        auto bytes = Asset::getMemoryUsage() + sizeof(StaticMeshAsset) - sizeof(Asset) + m_materialSlots.capacity() * sizeof(MaterialSlot);
+        for (auto const& slot : m_materialSlots)
+        {
+            bytes += slot.name.capacity();
+        }
+        return bytes;
+    }
+
     auto StaticMeshAsset::rebuildReferences() -> void
     {
         auto refs = std::vector<AssetRef>{};
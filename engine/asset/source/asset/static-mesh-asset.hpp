@@ -22,6 +22,20 @@ namespace april::asset
         bool generateTangents = true;   // Compute tangent space
         bool flipWindingOrder = false;  // Flip triangle winding
         float scale = 1.0f;             // Uniform scale factor
+        bool compactVertices = false;   // 20-byte quantized vertices and 16-bit indices when they fit
+        bool compressPayload = true;    // meshopt vertex/index codecs on the cooked blob
+
+        // Level-of-detail chain
+        uint32_t lodCount = 4;          // Levels including full detail; 1 disables LOD generation
+        float lodReduction = 0.5f;      // Target index count of each level relative to the previous one
+        float lodMaxError = 0.02f;      // Error budget per level, relative to the mesh extents
+        bool lodAllowSloppy = true;     // Fall back to topology-ignoring simplification when a level stalls
+
+        // Meshlets for cluster culling / mesh shaders
+        bool buildMeshlets = true;
+        uint32_t meshletMaxVertices = 64;   // <= 256
+        uint32_t meshletMaxTriangles = 124; // <= 512
+        float meshletConeWeight = 0.25f;    // 0 ignores normal cones when clustering, 1 favours tight cones
     };
 
     auto to_json(nlohmann::json& j, MeshImportSettings const& settings) -> void;
@@ -34,9 +48,11 @@ namespace april::asset
 
         MeshImportSettings m_settings;
         std::vector<MaterialSlot> m_materialSlots{};
+        uint32_t m_sourceMeshIndex{0};  // Mesh within a multi-mesh source file (glTF meshes[] index)
 
         auto serializeJson(nlohmann::json& outJson)  -> void override;
         auto deserializeJson(nlohmann::json const& inJson) -> bool  override;
+        [[nodiscard]] auto getMemoryUsage() const -> size_t override;
 
     private:
         auto rebuildReferences() -> void;
@@ -6,7 +6,12 @@ namespace april::asset
     {
         j["sRGB"] = settings.sRGB;
         j["generateMips"] = settings.generateMips;
+        j["mipFilter"] = settings.mipFilter;
+        j["alphaCutoff"] = settings.alphaCutoff;
         j["compression"] = settings.compression;
+        j["quality"] = settings.quality;
+        j["normalMap"] = settings.normalMap;
+        j["analyzeContent"] = settings.analyzeContent;
         j["brightness"] = settings.brightness;
     }
 
@@ -14,7 +19,12 @@ namespace april::asset
     {
         if (j.contains("sRGB")) settings.sRGB = j.at("sRGB").get<bool>();
         if (j.contains("generateMips")) settings.generateMips = j.at("generateMips").get<bool>();
+        if (j.contains("mipFilter")) settings.mipFilter = j.at("mipFilter").get<std::string>();
+        if (j.contains("alphaCutoff")) settings.alphaCutoff = j.at("alphaCutoff").get<float>();
         if (j.contains("compression")) settings.compression = j.at("compression").get<std::string>();
+        if (j.contains("quality")) settings.quality = j.at("quality").get<std::string>();
+        if (j.contains("normalMap")) settings.normalMap = j.at("normalMap").get<bool>();
+        if (j.contains("analyzeContent")) settings.analyzeContent = j.at("analyzeContent").get<bool>();
         if (j.contains("brightness")) settings.brightness = j.at("brightness").get<float>();
     }
 
@@ -8,7 +8,12 @@ namespace april::asset
     {
         bool sRGB = true;
         bool generateMips = true;
-        std::string compression = "BC7";
+        std::string mipFilter = "Kaiser";  // Mip downsampling filter: "Box", "Kaiser", "Lanczos"
+        float alphaCutoff = 0.0f;          // Alpha-test threshold; > 0 preserves alpha coverage across mips
+        std::string compression = "BC7";   // "BC1", "BC3", "BC4", "BC5", "BC7" or "RGBA8" (uncompressed)
+        std::string quality = "Normal";    // Block-compression effort: "Fast", "Normal", "High"
+        bool normalMap = false;            // Tangent-space normal map: stored linear, compressed as BC5 (RG)
+        bool analyzeContent = true;        // Collapse constant images to one texel and drop zero B / opaque A channels
         float brightness = 1.0f;
     };
 
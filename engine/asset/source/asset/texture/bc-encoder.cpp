@@ -0,0 +1,994 @@
+#include "bc-encoder.hpp"
+#include "texture-utils.hpp"
+
+#include <core/thread/thread-pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APRIL_BC_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace april::asset
+{
+    namespace
+    {
+        constexpr auto kBlockPixels = uint32_t{16};
+        constexpr auto kBlockRowsPerTask = size_t{4};
+        constexpr auto kBc7Weights = std::array<uint32_t, 16>{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        using Endpoint = std::array<float, 4>;
+        using Indices = std::array<uint8_t, kBlockPixels>;
+
+        // Channel-major so four pixels of one channel load as a single vector.
+        struct BlockPixels
+        {
+            alignas(16) std::array<std::array<float, kBlockPixels>, 4> channel{};
+        };
+
+        struct Palette
+        {
+            std::array<Endpoint, 16> entry{};
+            uint32_t count{0};
+        };
+
+        auto refinementPasses(BcQuality quality) -> uint32_t
+        {
+            switch (quality)
+            {
+            case BcQuality::Fast: return 0;
+            case BcQuality::Normal: return 2;
+            case BcQuality::High: return 6;
+            }
+            return 0;
+        }
+
+        auto loadBlock(std::span<uint8_t const, 64> rgba, uint32_t firstChannel, uint32_t channelCount) -> BlockPixels
+        {
+            auto pixels = BlockPixels{};
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                for (uint32_t c = 0; c < channelCount; ++c)
+                {
+                    pixels.channel[c][p] = static_cast<float>(rgba[p * 4 + firstChannel + c]);
+                }
+            }
+            return pixels;
+        }
+
+        /**
+         * Assign every pixel to its nearest palette entry.
+         * @return Summed squared error of the block.
+         */
+        auto fitIndices(BlockPixels const& pixels, Palette const& palette, uint32_t channelCount, Indices& indices) -> float
+        {
+#ifdef APRIL_BC_SSE2
+            auto total = _mm_setzero_ps();
+            for (uint32_t p = 0; p < kBlockPixels; p += 4)
+            {
+                auto best = _mm_set1_ps(std::numeric_limits<float>::max());
+                auto bestIndex = _mm_setzero_si128();
+                for (uint32_t i = 0; i < palette.count; ++i)
+                {
+                    auto distance = _mm_setzero_ps();
+                    for (uint32_t c = 0; c < channelCount; ++c)
+                    {
+                        auto const delta = _mm_sub_ps(_mm_load_ps(&pixels.channel[c][p]), _mm_set1_ps(palette.entry[i][c]));
+                        distance = _mm_add_ps(distance, _mm_mul_ps(delta, delta));
+                    }
+
+                    auto const closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+                    best = _mm_min_ps(distance, best);
+                    bestIndex = _mm_or_si128(
+                        _mm_and_si128(closer, _mm_set1_epi32(static_cast<int>(i))),
+                        _mm_andnot_si128(closer, bestIndex));
+                }
+
+                alignas(16) auto lanes = std::array<int32_t, 4>{};
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), bestIndex);
+                for (uint32_t k = 0; k < 4; ++k)
+                {
+                    indices[p + k] = static_cast<uint8_t>(lanes[k]);
+                }
+                total = _mm_add_ps(total, best);
+            }
+
+            alignas(16) auto sums = std::array<float, 4>{};
+            _mm_store_ps(sums.data(), total);
+            return sums[0] + sums[1] + sums[2] + sums[3];
+#else
+            auto total = 0.0f;
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto best = std::numeric_limits<float>::max();
+                auto bestIndex = uint8_t{0};
+                for (uint32_t i = 0; i < palette.count; ++i)
+                {
+                    auto distance = 0.0f;
+                    for (uint32_t c = 0; c < channelCount; ++c)
+                    {
+                        auto const delta = pixels.channel[c][p] - palette.entry[i][c];
+                        distance += delta * delta;
+                    }
+                    if (distance < best)
+                    {
+                        best = distance;
+                        bestIndex = static_cast<uint8_t>(i);
+                    }
+                }
+                indices[p] = bestIndex;
+                total += best;
+            }
+            return total;
+#endif
+        }
+
+        /**
+         * Initial endpoints. Fast uses the inset bounding box, flipped per channel to follow the
+         * dominant correlation; other presets fit the principal axis of the block's colors.
+         */
+        auto computeEndpoints(BlockPixels const& pixels, uint32_t channelCount, BcQuality quality, Endpoint& low, Endpoint& high) -> void
+        {
+            auto mean = Endpoint{};
+            low.fill(255.0f);
+            high.fill(0.0f);
+            for (uint32_t c = 0; c < channelCount; ++c)
+            {
+                for (uint32_t p = 0; p < kBlockPixels; ++p)
+                {
+                    auto const value = pixels.channel[c][p];
+                    low[c] = std::min(low[c], value);
+                    high[c] = std::max(high[c], value);
+                    mean[c] += value;
+                }
+                mean[c] /= static_cast<float>(kBlockPixels);
+            }
+
+            auto covariance = std::array<Endpoint, 4>{};
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                for (uint32_t a = 0; a < channelCount; ++a)
+                {
+                    for (uint32_t b = 0; b < channelCount; ++b)
+                    {
+                        covariance[a][b] += (pixels.channel[a][p] - mean[a]) * (pixels.channel[b][p] - mean[b]);
+                    }
+                }
+            }
+
+            auto reference = uint32_t{0};
+            for (uint32_t c = 1; c < channelCount; ++c)
+            {
+                if (covariance[c][c] > covariance[reference][reference])
+                {
+                    reference = c;
+                }
+            }
+
+            if (quality == BcQuality::Fast)
+            {
+                for (uint32_t c = 0; c < channelCount; ++c)
+                {
+                    if (covariance[reference][c] < 0.0f)
+                    {
+                        std::swap(low[c], high[c]);
+                    }
+                    auto const inset = (high[c] - low[c]) / 16.0f;
+                    low[c] += inset;
+                    high[c] -= inset;
+                }
+                return;
+            }
+
+            auto axis = covariance[reference];
+            for (auto iteration = 0; iteration < 8; ++iteration)
+            {
+                auto next = Endpoint{};
+                auto largest = 0.0f;
+                for (uint32_t a = 0; a < channelCount; ++a)
+                {
+                    for (uint32_t b = 0; b < channelCount; ++b)
+                    {
+                        next[a] += covariance[a][b] * axis[b];
+                    }
+                    largest = std::max(largest, std::abs(next[a]));
+                }
+
+                if (largest < 1e-6f)
+                {
+                    // Constant block.
+                    low = mean;
+                    high = mean;
+                    return;
+                }
+
+                for (uint32_t c = 0; c < channelCount; ++c)
+                {
+                    axis[c] = next[c] / largest;
+                }
+            }
+
+            auto length = 0.0f;
+            for (uint32_t c = 0; c < channelCount; ++c)
+            {
+                length += axis[c] * axis[c];
+            }
+            length = std::sqrt(length);
+
+            auto minProjection = std::numeric_limits<float>::max();
+            auto maxProjection = std::numeric_limits<float>::lowest();
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto projection = 0.0f;
+                for (uint32_t c = 0; c < channelCount; ++c)
+                {
+                    projection += (pixels.channel[c][p] - mean[c]) * axis[c] / length;
+                }
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+
+            for (uint32_t c = 0; c < channelCount; ++c)
+            {
+                low[c] = std::clamp(mean[c] + minProjection * axis[c] / length, 0.0f, 255.0f);
+                high[c] = std::clamp(mean[c] + maxProjection * axis[c] / length, 0.0f, 255.0f);
+            }
+        }
+
+        /**
+         * Least-squares endpoints for fixed indices. weights[i] is the interpolation factor of palette
+         * entry i towards the second endpoint. Only pixels set in pixelMask contribute.
+         */
+        auto refineEndpoints(
+            BlockPixels const& pixels,
+            uint32_t channelCount,
+            Indices const& indices,
+            std::span<float const> weights,
+            uint32_t pixelMask,
+            Endpoint& low,
+            Endpoint& high
+        ) -> bool
+        {
+            auto alpha2 = 0.0f;
+            auto beta2 = 0.0f;
+            auto alphaBeta = 0.0f;
+            auto alphaX = Endpoint{};
+            auto betaX = Endpoint{};
+
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                if ((pixelMask & (1u << p)) == 0)
+                {
+                    continue;
+                }
+
+                auto const t = weights[indices[p]];
+                auto const s = 1.0f - t;
+                alpha2 += s * s;
+                beta2 += t * t;
+                alphaBeta += s * t;
+                for (uint32_t c = 0; c < channelCount; ++c)
+                {
+                    alphaX[c] += s * pixels.channel[c][p];
+                    betaX[c] += t * pixels.channel[c][p];
+                }
+            }
+
+            auto const determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+            if (std::abs(determinant) < 1e-6f)
+            {
+                return false;
+            }
+
+            for (uint32_t c = 0; c < channelCount; ++c)
+            {
+                low[c] = std::clamp((alphaX[c] * beta2 - betaX[c] * alphaBeta) / determinant, 0.0f, 255.0f);
+                high[c] = std::clamp((betaX[c] * alpha2 - alphaX[c] * alphaBeta) / determinant, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        class BitWriter
+        {
+        public:
+            explicit BitWriter(std::span<uint8_t> bytes) : m_bytes{bytes}
+            {
+                std::ranges::fill(m_bytes, uint8_t{0});
+            }
+
+            auto write(uint32_t value, uint32_t bitCount) -> void
+            {
+                for (uint32_t i = 0; i < bitCount; ++i, ++m_position)
+                {
+                    if ((value >> i) & 1u)
+                    {
+                        m_bytes[m_position / 8] |= static_cast<uint8_t>(1u << (m_position % 8));
+                    }
+                }
+            }
+
+        private:
+            std::span<uint8_t> m_bytes;
+            uint32_t m_position{0};
+        };
+
+        class BitReader
+        {
+        public:
+            explicit BitReader(std::span<uint8_t const> bytes) : m_bytes{bytes} {}
+
+            auto read(uint32_t bitCount) -> uint32_t
+            {
+                auto value = uint32_t{0};
+                for (uint32_t i = 0; i < bitCount; ++i, ++m_position)
+                {
+                    value |= ((m_bytes[m_position / 8] >> (m_position % 8)) & 1u) << i;
+                }
+                return value;
+            }
+
+        private:
+            std::span<uint8_t const> m_bytes;
+            uint32_t m_position{0};
+        };
+
+        // -- BC1 color block ----------------------------------------------------------------------
+
+        constexpr auto kColorWeights4 = std::array<float, 4>{0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+        constexpr auto kColorWeights3 = std::array<float, 4>{0.0f, 1.0f, 0.5f, 0.0f};
+
+        struct ColorCandidate
+        {
+            uint16_t color0{0};
+            uint16_t color1{0};
+            Indices indices{};
+            float error{std::numeric_limits<float>::max()};
+        };
+
+        auto packRgb565(Endpoint const& color) -> uint16_t
+        {
+            auto quantize = [](float value, float maxValue) -> uint32_t
+            {
+                return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0f, 255.0f) * maxValue / 255.0f));
+            };
+            return static_cast<uint16_t>((quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5) | quantize(color[2], 31.0f));
+        }
+
+        auto unpackRgb565(uint16_t packed) -> std::array<uint32_t, 3>
+        {
+            auto const r = (packed >> 11) & 0x1Fu;
+            auto const g = (packed >> 5) & 0x3Fu;
+            auto const b = packed & 0x1Fu;
+            return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+        }
+
+        auto evaluateColorCandidate(BlockPixels const& pixels, Endpoint const& low, Endpoint const& high, bool threeColor) -> ColorCandidate
+        {
+            auto const packedLow = packRgb565(low);
+            auto const packedHigh = packRgb565(high);
+
+            // Four-color mode requires color0 > color1, three-color mode color0 <= color1.
+            auto candidate = ColorCandidate{};
+            candidate.color0 = threeColor ? std::min(packedLow, packedHigh) : std::max(packedLow, packedHigh);
+            candidate.color1 = threeColor ? std::max(packedLow, packedHigh) : std::min(packedLow, packedHigh);
+
+            auto const c0 = unpackRgb565(candidate.color0);
+            auto const c1 = unpackRgb565(candidate.color1);
+
+            auto palette = Palette{};
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                auto const a = static_cast<float>(c0[c]);
+                auto const b = static_cast<float>(c1[c]);
+                palette.entry[0][c] = a;
+                palette.entry[1][c] = b;
+                palette.entry[2][c] = threeColor ? (a + b) / 2.0f : (2.0f * a + b) / 3.0f;
+                palette.entry[3][c] = (a + 2.0f * b) / 3.0f;
+            }
+
+            if (threeColor)
+            {
+                palette.count = 3;
+            }
+            else
+            {
+                // Equal endpoints decode in three-color mode; index 0 is the only safe choice.
+                palette.count = candidate.color0 == candidate.color1 ? 1 : 4;
+            }
+
+            candidate.error = fitIndices(pixels, palette, 3, candidate.indices);
+            return candidate;
+        }
+
+        auto encodeColorBlock(std::span<uint8_t const, 64> rgba, BcQuality quality, bool allowTransparency, std::span<uint8_t> block) -> void
+        {
+            auto transparentMask = uint32_t{0};
+            if (allowTransparency)
+            {
+                for (uint32_t p = 0; p < kBlockPixels; ++p)
+                {
+                    if (rgba[p * 4 + 3] < 128)
+                    {
+                        transparentMask |= 1u << p;
+                    }
+                }
+            }
+
+            auto writeBlock = [&block](uint16_t color0, uint16_t color1, uint32_t bits) -> void
+            {
+                std::memcpy(block.data(), &color0, sizeof(color0));
+                std::memcpy(block.data() + 2, &color1, sizeof(color1));
+                std::memcpy(block.data() + 4, &bits, sizeof(bits));
+            };
+
+            if (transparentMask == 0xFFFFu)
+            {
+                writeBlock(0, 0, 0xFFFFFFFFu);
+                return;
+            }
+
+            auto pixels = loadBlock(rgba, 0, 3);
+            if (transparentMask != 0)
+            {
+                // Transparent pixels decode to black regardless of endpoints; keep them out of the fit.
+                auto const firstOpaque = static_cast<uint32_t>(std::countr_zero(~transparentMask & 0xFFFFu));
+                for (uint32_t p = 0; p < kBlockPixels; ++p)
+                {
+                    if (transparentMask & (1u << p))
+                    {
+                        for (uint32_t c = 0; c < 3; ++c)
+                        {
+                            pixels.channel[c][p] = pixels.channel[c][firstOpaque];
+                        }
+                    }
+                }
+            }
+
+            auto const threeColor = transparentMask != 0;
+            auto const weights = threeColor ? std::span<float const>{kColorWeights3} : std::span<float const>{kColorWeights4};
+
+            auto low = Endpoint{};
+            auto high = Endpoint{};
+            computeEndpoints(pixels, 3, quality, low, high);
+            auto best = evaluateColorCandidate(pixels, low, high, threeColor);
+
+            if (quality == BcQuality::High)
+            {
+                auto boxLow = Endpoint{};
+                auto boxHigh = Endpoint{};
+                computeEndpoints(pixels, 3, BcQuality::Fast, boxLow, boxHigh);
+                auto candidate = evaluateColorCandidate(pixels, boxLow, boxHigh, threeColor);
+                if (candidate.error < best.error)
+                {
+                    best = candidate;
+                }
+            }
+
+            for (uint32_t pass = 0; pass < refinementPasses(quality) && best.error > 0.0f; ++pass)
+            {
+                if (!refineEndpoints(pixels, 3, best.indices, weights, ~transparentMask & 0xFFFFu, low, high))
+                {
+                    break;
+                }
+
+                auto candidate = evaluateColorCandidate(pixels, low, high, threeColor);
+                if (candidate.error >= best.error)
+                {
+                    break;
+                }
+                best = candidate;
+            }
+
+            auto bits = uint32_t{0};
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto const index = (transparentMask & (1u << p)) ? 3u : static_cast<uint32_t>(best.indices[p]);
+                bits |= index << (2 * p);
+            }
+            writeBlock(best.color0, best.color1, bits);
+        }
+
+        auto decodeColorBlock(std::span<uint8_t const> block, bool allowThreeColor, std::span<uint8_t, 64> rgba) -> void
+        {
+            auto color0 = uint16_t{0};
+            auto color1 = uint16_t{0};
+            auto bits = uint32_t{0};
+            std::memcpy(&color0, block.data(), sizeof(color0));
+            std::memcpy(&color1, block.data() + 2, sizeof(color1));
+            std::memcpy(&bits, block.data() + 4, sizeof(bits));
+
+            auto const c0 = unpackRgb565(color0);
+            auto const c1 = unpackRgb565(color1);
+            auto const fourColor = !allowThreeColor || color0 > color1;
+
+            auto palette = std::array<std::array<uint32_t, 4>, 4>{};
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                palette[0][c] = c0[c];
+                palette[1][c] = c1[c];
+                palette[2][c] = fourColor ? (2 * c0[c] + c1[c]) / 3 : (c0[c] + c1[c]) / 2;
+                palette[3][c] = fourColor ? (c0[c] + 2 * c1[c]) / 3 : 0;
+            }
+            palette[0][3] = palette[1][3] = palette[2][3] = 255;
+            palette[3][3] = fourColor ? 255 : 0;
+
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto const& color = palette[(bits >> (2 * p)) & 0x3u];
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    rgba[p * 4 + c] = static_cast<uint8_t>(color[c]);
+                }
+            }
+        }
+
+        // -- BC4 single channel block -------------------------------------------------------------
+
+        constexpr auto kAlphaWeights8 = std::array<float, 8>{0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f};
+
+        struct AlphaCandidate
+        {
+            uint8_t endpoint0{0};
+            uint8_t endpoint1{0};
+            Indices indices{};
+            float error{std::numeric_limits<float>::max()};
+        };
+
+        auto alphaPalette(uint32_t endpoint0, uint32_t endpoint1) -> std::array<uint32_t, 8>
+        {
+            auto palette = std::array<uint32_t, 8>{endpoint0, endpoint1};
+            if (endpoint0 > endpoint1)
+            {
+                for (uint32_t i = 2; i < 8; ++i)
+                {
+                    palette[i] = ((8 - i) * endpoint0 + (i - 1) * endpoint1) / 7;
+                }
+            }
+            else
+            {
+                for (uint32_t i = 2; i < 6; ++i)
+                {
+                    palette[i] = ((6 - i) * endpoint0 + (i - 1) * endpoint1) / 5;
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+            return palette;
+        }
+
+        auto evaluateAlphaCandidate(BlockPixels const& pixels, uint8_t endpoint0, uint8_t endpoint1) -> AlphaCandidate
+        {
+            auto palette = Palette{};
+            auto const values = alphaPalette(endpoint0, endpoint1);
+            for (uint32_t i = 0; i < 8; ++i)
+            {
+                palette.entry[i][0] = static_cast<float>(values[i]);
+            }
+            palette.count = 8;
+
+            auto candidate = AlphaCandidate{endpoint0, endpoint1};
+            candidate.error = fitIndices(pixels, palette, 1, candidate.indices);
+            return candidate;
+        }
+
+        auto encodeAlphaBlock(std::span<uint8_t const, 64> rgba, uint32_t channel, BcQuality quality, std::span<uint8_t> block) -> void
+        {
+            auto const pixels = loadBlock(rgba, channel, 1);
+
+            auto minValue = uint8_t{255};
+            auto maxValue = uint8_t{0};
+            auto innerMin = uint8_t{255};
+            auto innerMax = uint8_t{0};
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto const value = rgba[p * 4 + channel];
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+                if (value != 0 && value != 255)
+                {
+                    innerMin = std::min(innerMin, value);
+                    innerMax = std::max(innerMax, value);
+                }
+            }
+
+            auto best = evaluateAlphaCandidate(pixels, maxValue, minValue);
+
+            if (quality != BcQuality::Fast && best.error > 0.0f)
+            {
+                // Six-value mode spends two codes on exact 0 and 255, which suits blocks mixing extremes with mid-range values.
+                if ((minValue == 0 || maxValue == 255) && innerMin <= innerMax)
+                {
+                    auto candidate = evaluateAlphaCandidate(pixels, innerMin, innerMax);
+                    if (candidate.error < best.error)
+                    {
+                        best = candidate;
+                    }
+                }
+
+                for (uint32_t pass = 0; pass < refinementPasses(quality) && best.endpoint0 > best.endpoint1; ++pass)
+                {
+                    auto low = Endpoint{};
+                    auto high = Endpoint{};
+                    if (!refineEndpoints(pixels, 1, best.indices, kAlphaWeights8, 0xFFFFu, low, high))
+                    {
+                        break;
+                    }
+
+                    auto const endpoint0 = static_cast<uint8_t>(std::lround(std::max(low[0], high[0])));
+                    auto const endpoint1 = static_cast<uint8_t>(std::lround(std::min(low[0], high[0])));
+                    if (endpoint0 == endpoint1)
+                    {
+                        break;
+                    }
+
+                    auto candidate = evaluateAlphaCandidate(pixels, endpoint0, endpoint1);
+                    if (candidate.error >= best.error)
+                    {
+                        break;
+                    }
+                    best = candidate;
+                }
+            }
+
+            if (quality == BcQuality::High && best.endpoint0 > best.endpoint1)
+            {
+                auto const center = best;
+                for (auto d0 = -1; d0 <= 1; ++d0)
+                {
+                    for (auto d1 = -1; d1 <= 1; ++d1)
+                    {
+                        auto const endpoint0 = std::clamp(center.endpoint0 + d0, 0, 255);
+                        auto const endpoint1 = std::clamp(center.endpoint1 + d1, 0, 255);
+                        if (endpoint0 <= endpoint1)
+                        {
+                            continue;
+                        }
+
+                        auto candidate = evaluateAlphaCandidate(pixels, static_cast<uint8_t>(endpoint0), static_cast<uint8_t>(endpoint1));
+                        if (candidate.error < best.error)
+                        {
+                            best = candidate;
+                        }
+                    }
+                }
+            }
+
+            auto bits = uint64_t{0};
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                bits |= static_cast<uint64_t>(best.indices[p]) << (3 * p);
+            }
+
+            block[0] = best.endpoint0;
+            block[1] = best.endpoint1;
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                block[2 + i] = static_cast<uint8_t>(bits >> (8 * i));
+            }
+        }
+
+        auto decodeAlphaBlock(std::span<uint8_t const> block, uint32_t channel, std::span<uint8_t, 64> rgba) -> void
+        {
+            auto const palette = alphaPalette(block[0], block[1]);
+
+            auto bits = uint64_t{0};
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                bits |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+            }
+
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                rgba[p * 4 + channel] = static_cast<uint8_t>(palette[(bits >> (3 * p)) & 0x7u]);
+            }
+        }
+
+        // -- BC7 (mode 6: single subset, RGBA 7.7.7.7 endpoints + unique p-bits, 4-bit indices) ---
+
+        constexpr auto kBc7Mode6 = uint32_t{6};
+
+        struct Bc7Endpoint
+        {
+            std::array<uint32_t, 4> value{}; // 7-bit
+            uint32_t pbit{0};
+        };
+
+        struct Bc7Candidate
+        {
+            Bc7Endpoint endpoint0{};
+            Bc7Endpoint endpoint1{};
+            Indices indices{};
+            float error{std::numeric_limits<float>::max()};
+        };
+
+        auto quantizeBc7Endpoint(Endpoint const& color) -> Bc7Endpoint
+        {
+            auto best = Bc7Endpoint{};
+            auto bestError = std::numeric_limits<float>::max();
+            for (uint32_t pbit = 0; pbit < 2; ++pbit)
+            {
+                auto candidate = Bc7Endpoint{{}, pbit};
+                auto error = 0.0f;
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    auto const quantized = std::clamp(std::lround((color[c] - static_cast<float>(pbit)) / 2.0f), 0L, 127L);
+                    candidate.value[c] = static_cast<uint32_t>(quantized);
+                    auto const delta = static_cast<float>(candidate.value[c] * 2 + pbit) - color[c];
+                    error += delta * delta;
+                }
+                if (error < bestError)
+                {
+                    best = candidate;
+                    bestError = error;
+                }
+            }
+            return best;
+        }
+
+        auto bc7Palette(Bc7Endpoint const& endpoint0, Bc7Endpoint const& endpoint1) -> std::array<std::array<uint32_t, 4>, 16>
+        {
+            auto palette = std::array<std::array<uint32_t, 4>, 16>{};
+            for (uint32_t c = 0; c < 4; ++c)
+            {
+                auto const a = endpoint0.value[c] * 2 + endpoint0.pbit;
+                auto const b = endpoint1.value[c] * 2 + endpoint1.pbit;
+                for (uint32_t i = 0; i < 16; ++i)
+                {
+                    palette[i][c] = ((64 - kBc7Weights[i]) * a + kBc7Weights[i] * b + 32) >> 6;
+                }
+            }
+            return palette;
+        }
+
+        auto evaluateBc7Candidate(BlockPixels const& pixels, Endpoint const& low, Endpoint const& high) -> Bc7Candidate
+        {
+            auto candidate = Bc7Candidate{quantizeBc7Endpoint(low), quantizeBc7Endpoint(high)};
+
+            auto palette = Palette{};
+            auto const values = bc7Palette(candidate.endpoint0, candidate.endpoint1);
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    palette.entry[i][c] = static_cast<float>(values[i][c]);
+                }
+            }
+            palette.count = 16;
+
+            candidate.error = fitIndices(pixels, palette, 4, candidate.indices);
+            return candidate;
+        }
+
+        auto encodeBc7Block(std::span<uint8_t const, 64> rgba, BcQuality quality, std::span<uint8_t> block) -> void
+        {
+            auto const pixels = loadBlock(rgba, 0, 4);
+
+            auto low = Endpoint{};
+            auto high = Endpoint{};
+            computeEndpoints(pixels, 4, quality, low, high);
+            auto best = evaluateBc7Candidate(pixels, low, high);
+
+            if (quality == BcQuality::High)
+            {
+                auto boxLow = Endpoint{};
+                auto boxHigh = Endpoint{};
+                computeEndpoints(pixels, 4, BcQuality::Fast, boxLow, boxHigh);
+                auto candidate = evaluateBc7Candidate(pixels, boxLow, boxHigh);
+                if (candidate.error < best.error)
+                {
+                    best = candidate;
+                }
+            }
+
+            auto weights = std::array<float, 16>{};
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                weights[i] = static_cast<float>(kBc7Weights[i]) / 64.0f;
+            }
+
+            for (uint32_t pass = 0; pass < refinementPasses(quality) && best.error > 0.0f; ++pass)
+            {
+                if (!refineEndpoints(pixels, 4, best.indices, weights, 0xFFFFu, low, high))
+                {
+                    break;
+                }
+
+                auto candidate = evaluateBc7Candidate(pixels, low, high);
+                if (candidate.error >= best.error)
+                {
+                    break;
+                }
+                best = candidate;
+            }
+
+            // The anchor index (pixel 0) is stored without its top bit; mirror the palette if it is set.
+            if (best.indices[0] >= 8)
+            {
+                std::swap(best.endpoint0, best.endpoint1);
+                for (auto& index : best.indices)
+                {
+                    index = static_cast<uint8_t>(15 - index);
+                }
+            }
+
+            auto writer = BitWriter{block};
+            writer.write(1u << kBc7Mode6, kBc7Mode6 + 1);
+            for (uint32_t c = 0; c < 4; ++c)
+            {
+                writer.write(best.endpoint0.value[c], 7);
+                writer.write(best.endpoint1.value[c], 7);
+            }
+            writer.write(best.endpoint0.pbit, 1);
+            writer.write(best.endpoint1.pbit, 1);
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                writer.write(best.indices[p], p == 0 ? 3 : 4);
+            }
+        }
+
+        auto decodeBc7Block(std::span<uint8_t const> block, std::span<uint8_t, 64> rgba) -> bool
+        {
+            if (block[0] == 0 || std::countr_zero(block[0]) != static_cast<int>(kBc7Mode6))
+            {
+                return false;
+            }
+
+            auto reader = BitReader{block};
+            reader.read(kBc7Mode6 + 1);
+
+            auto endpoint0 = Bc7Endpoint{};
+            auto endpoint1 = Bc7Endpoint{};
+            for (uint32_t c = 0; c < 4; ++c)
+            {
+                endpoint0.value[c] = reader.read(7);
+                endpoint1.value[c] = reader.read(7);
+            }
+            endpoint0.pbit = reader.read(1);
+            endpoint1.pbit = reader.read(1);
+
+            auto const palette = bc7Palette(endpoint0, endpoint1);
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                auto const index = reader.read(p == 0 ? 3 : 4);
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    rgba[p * 4 + c] = static_cast<uint8_t>(palette[index][c]);
+                }
+            }
+            return true;
+        }
+    } // namespace
+
+    auto parseBcFormat(std::string_view name) -> std::optional<BcFormat>
+    {
+        if (equalsIgnoreCase(name, "BC1")) return BcFormat::BC1;
+        if (equalsIgnoreCase(name, "BC3")) return BcFormat::BC3;
+        if (equalsIgnoreCase(name, "BC4")) return BcFormat::BC4;
+        if (equalsIgnoreCase(name, "BC5")) return BcFormat::BC5;
+        if (equalsIgnoreCase(name, "BC7")) return BcFormat::BC7;
+        return std::nullopt;
+    }
+
+    auto parseBcQuality(std::string_view name) -> BcQuality
+    {
+        if (equalsIgnoreCase(name, "Fast")) return BcQuality::Fast;
+        if (equalsIgnoreCase(name, "High")) return BcQuality::High;
+        return BcQuality::Normal;
+    }
+
+    auto getBcBlockSize(BcFormat format) -> size_t
+    {
+        return format == BcFormat::BC1 || format == BcFormat::BC4 ? 8 : 16;
+    }
+
+    auto getBcSurfaceSize(BcFormat format, uint32_t width, uint32_t height) -> size_t
+    {
+        auto const blocksX = std::max<size_t>(1, (size_t{width} + 3) / 4);
+        auto const blocksY = std::max<size_t>(1, (size_t{height} + 3) / 4);
+        return blocksX * blocksY * getBcBlockSize(format);
+    }
+
+    auto encodeBcBlock(BcFormat format, std::span<uint8_t const, 64> rgba, BcQuality quality, std::span<uint8_t> block) -> void
+    {
+        switch (format)
+        {
+        case BcFormat::BC1:
+            encodeColorBlock(rgba, quality, true, block);
+            break;
+        case BcFormat::BC3:
+            encodeAlphaBlock(rgba, 3, quality, block.subspan(0, 8));
+            encodeColorBlock(rgba, quality, false, block.subspan(8, 8));
+            break;
+        case BcFormat::BC4:
+            encodeAlphaBlock(rgba, 0, quality, block);
+            break;
+        case BcFormat::BC5:
+            encodeAlphaBlock(rgba, 0, quality, block.subspan(0, 8));
+            encodeAlphaBlock(rgba, 1, quality, block.subspan(8, 8));
+            break;
+        case BcFormat::BC7:
+            encodeBc7Block(rgba, quality, block);
+            break;
+        }
+    }
+
+    auto decodeBcBlock(BcFormat format, std::span<uint8_t const> block, std::span<uint8_t, 64> rgba) -> bool
+    {
+        switch (format)
+        {
+        case BcFormat::BC1:
+            decodeColorBlock(block, true, rgba);
+            return true;
+        case BcFormat::BC3:
+            decodeColorBlock(block.subspan(8, 8), false, rgba);
+            decodeAlphaBlock(block.subspan(0, 8), 3, rgba);
+            return true;
+        case BcFormat::BC4:
+        case BcFormat::BC5:
+            std::ranges::fill(rgba, uint8_t{0});
+            decodeAlphaBlock(block.subspan(0, 8), 0, rgba);
+            if (format == BcFormat::BC5)
+            {
+                decodeAlphaBlock(block.subspan(8, 8), 1, rgba);
+            }
+            for (uint32_t p = 0; p < kBlockPixels; ++p)
+            {
+                rgba[p * 4 + 3] = 255;
+            }
+            return true;
+        case BcFormat::BC7:
+            return decodeBc7Block(block, rgba);
+        }
+        return false;
+    }
+
+    auto compressBcSurface(
+        BcFormat format,
+        std::span<uint8_t const> rgba,
+        uint32_t width,
+        uint32_t height,
+        BcQuality quality
+    ) -> std::vector<uint8_t>
+    {
+        if (width == 0 || height == 0 || rgba.size() < size_t{width} * height * 4)
+        {
+            return {};
+        }
+
+        auto const blocksX = std::max<uint32_t>(1, (width + 3) / 4);
+        auto const blocksY = std::max<uint32_t>(1, (height + 3) / 4);
+        auto const blockSize = getBcBlockSize(format);
+        auto output = std::vector<uint8_t>(size_t{blocksX} * blocksY * blockSize);
+
+        core::ThreadPool::get().parallelFor(blocksY, kBlockRowsPerTask, [&](size_t begin, size_t end)
+        {
+            auto pixels = std::array<uint8_t, 64>{};
+            for (auto blockY = begin; blockY < end; ++blockY)
+            {
+                for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+                {
+                    for (uint32_t y = 0; y < 4; ++y)
+                    {
+                        auto const sourceY = std::min<size_t>(blockY * 4 + y, height - 1);
+                        for (uint32_t x = 0; x < 4; ++x)
+                        {
+                            auto const sourceX = std::min<size_t>(size_t{blockX} * 4 + x, width - 1);
+                            std::memcpy(&pixels[(y * 4 + x) * 4], &rgba[(sourceY * width + sourceX) * 4], 4);
+                        }
+                    }
+
+                    auto const offset = (blockY * blocksX + blockX) * blockSize;
+                    encodeBcBlock(format, pixels, quality, std::span{output}.subspan(offset, blockSize));
+                }
+            }
+        });
+
+        return output;
+    }
+} // namespace april::asset
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace april::asset
+{
+    enum class BcFormat : uint8_t
+    {
+        BC1, // RGB + 1-bit alpha, 8 bytes per block
+        BC3, // RGBA with interpolated alpha, 16 bytes per block
+        BC4, // Single channel (R), 8 bytes per block
+        BC5, // Two channels (RG), 16 bytes per block - used for tangent-space normal maps
+        BC7  // High quality RGBA, 16 bytes per block
+    };
+
+    /**
+     * Encoder effort. Fast uses bounding-box endpoints, Normal adds a principal-axis fit and
+     * least-squares refinement, High runs more refinement passes and tries extra endpoint candidates.
+     */
+    enum class BcQuality : uint8_t
+    {
+        Fast,
+        Normal,
+        High
+    };
+
+    /**
+     * Parse a compression setting ("BC1", "BC3", "BC4", "BC5", "BC7"). Case-insensitive.
+     */
+    auto parseBcFormat(std::string_view name) -> std::optional<BcFormat>;
+
+    /**
+     * Parse a quality preset ("Fast", "Normal", "High"). Unknown names map to Normal.
+     */
+    auto parseBcQuality(std::string_view name) -> BcQuality;
+
+    auto getBcBlockSize(BcFormat format) -> size_t;
+
+    /**
+     * Size of a compressed surface. Partial blocks at the right/bottom edge count as whole blocks.
+     */
+    auto getBcSurfaceSize(BcFormat format, uint32_t width, uint32_t height) -> size_t;
+
+    /**
+     * Encode one 4x4 block of RGBA8 pixels (row-major) into getBcBlockSize(format) bytes.
+     * BC4 reads the red channel, BC5 reads red and green.
+     */
+    auto encodeBcBlock(BcFormat format, std::span<uint8_t const, 64> rgba, BcQuality quality, std::span<uint8_t> block) -> void;
+
+    /**
+     * Decode one block back to RGBA8. BC7 decoding covers mode 6, which is the mode the encoder emits.
+     * @return False if the block uses an unsupported BC7 mode.
+     */
+    auto decodeBcBlock(BcFormat format, std::span<uint8_t const> block, std::span<uint8_t, 64> rgba) -> bool;
+
+    /**
+     * Compress an RGBA8 surface. Edge blocks replicate the last row/column.
+     * Block rows are encoded in parallel on the shared core::ThreadPool.
+     */
+    auto compressBcSurface(
+        BcFormat format,
+        std::span<uint8_t const> rgba,
+        uint32_t width,
+        uint32_t height,
+        BcQuality quality
+    ) -> std::vector<uint8_t>;
+} // namespace april::asset
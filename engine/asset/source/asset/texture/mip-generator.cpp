@@ -0,0 +1,452 @@
+#include "mip-generator.hpp"
+#include "texture-utils.hpp"
+
+#include <core/thread/thread-pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#define APRIL_MIP_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APRIL_MIP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace april::asset
+{
+    namespace
+    {
+        constexpr auto kPi = 3.14159265358979f;
+        constexpr auto kWindowedRadius = 3.0f;
+        constexpr auto kKaiserAlpha = 4.0f;
+        constexpr auto kRowsPerTask = size_t{16};
+        constexpr auto kLinearToSrgbEntries = 4096u;
+
+        auto srgbToLinearTable() -> std::array<float, 256> const&
+        {
+            static auto const table = []()
+            {
+                auto values = std::array<float, 256>{};
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    auto const c = static_cast<float>(i) / 255.0f;
+                    values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+                }
+                return values;
+            }();
+            return table;
+        }
+
+        auto linearToSrgbTable() -> std::array<uint8_t, kLinearToSrgbEntries> const&
+        {
+            static auto const table = []()
+            {
+                auto values = std::array<uint8_t, kLinearToSrgbEntries>{};
+                for (uint32_t i = 0; i < kLinearToSrgbEntries; ++i)
+                {
+                    auto const c = static_cast<float>(i) / static_cast<float>(kLinearToSrgbEntries - 1);
+                    auto const encoded = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+                    values[i] = static_cast<uint8_t>(std::lround(std::clamp(encoded, 0.0f, 1.0f) * 255.0f));
+                }
+                return values;
+            }();
+            return table;
+        }
+
+        auto sinc(float x) -> float
+        {
+            if (std::abs(x) < 1e-5f)
+            {
+                return 1.0f;
+            }
+            return std::sin(kPi * x) / (kPi * x);
+        }
+
+        // Zeroth-order modified Bessel function of the first kind (power series).
+        auto besselI0(float x) -> float
+        {
+            auto sum = 1.0f;
+            auto term = 1.0f;
+            auto const halfX = x * 0.5f;
+            for (auto k = 1; k < 16; ++k)
+            {
+                term *= (halfX / static_cast<float>(k)) * (halfX / static_cast<float>(k));
+                sum += term;
+            }
+            return sum;
+        }
+
+        auto windowedKernel(MipFilter filter, float x) -> float
+        {
+            auto const t = std::abs(x);
+            if (t >= kWindowedRadius)
+            {
+                return 0.0f;
+            }
+
+            if (filter == MipFilter::Lanczos)
+            {
+                return sinc(t) * sinc(t / kWindowedRadius);
+            }
+
+            auto const ratio = t / kWindowedRadius;
+            return sinc(t) * besselI0(kKaiserAlpha * std::sqrt(1.0f - ratio * ratio)) / besselI0(kKaiserAlpha);
+        }
+
+        /**
+         * Per-destination taps of a 1D resampling pass, padded to a fixed tap count.
+         */
+        struct FilterTable
+        {
+            uint32_t taps{0};
+            std::vector<uint32_t> sourceIndex{};
+            std::vector<float> weight{};
+        };
+
+        auto buildFilterTable(uint32_t sourceSize, uint32_t targetSize, MipFilter filter) -> FilterTable
+        {
+            auto const scale = static_cast<float>(sourceSize) / static_cast<float>(targetSize);
+            auto const radius = filter == MipFilter::Box ? 0.5f * scale : kWindowedRadius * scale;
+
+            auto table = FilterTable{};
+            table.taps = static_cast<uint32_t>(std::ceil(radius * 2.0f)) + 2;
+            table.sourceIndex.resize(size_t{targetSize} * table.taps);
+            table.weight.resize(size_t{targetSize} * table.taps);
+
+            for (uint32_t target = 0; target < targetSize; ++target)
+            {
+                auto const footprintBegin = static_cast<float>(target) * scale;
+                auto const footprintEnd = footprintBegin + scale;
+                auto const center = footprintBegin + 0.5f * scale;
+                auto const first = static_cast<int64_t>(std::floor(center - radius));
+
+                auto* indices = &table.sourceIndex[size_t{target} * table.taps];
+                auto* weights = &table.weight[size_t{target} * table.taps];
+                auto sum = 0.0f;
+
+                for (uint32_t k = 0; k < table.taps; ++k)
+                {
+                    auto const source = first + static_cast<int64_t>(k);
+                    auto const sourceCenter = static_cast<float>(source) + 0.5f;
+
+                    auto w = 0.0f;
+                    if (filter == MipFilter::Box)
+                    {
+                        w = std::max(0.0f, std::min(static_cast<float>(source + 1), footprintEnd) - std::max(static_cast<float>(source), footprintBegin));
+                    }
+                    else
+                    {
+                        w = windowedKernel(filter, (sourceCenter - center) / scale);
+                    }
+
+                    indices[k] = static_cast<uint32_t>(std::clamp<int64_t>(source, 0, static_cast<int64_t>(sourceSize) - 1));
+                    weights[k] = w;
+                    sum += w;
+                }
+
+                if (std::abs(sum) < 1e-6f)
+                {
+                    std::fill(weights, weights + table.taps, 0.0f);
+                    indices[0] = std::min(static_cast<uint32_t>(center), sourceSize - 1);
+                    weights[0] = 1.0f;
+                    continue;
+                }
+
+                for (uint32_t k = 0; k < table.taps; ++k)
+                {
+                    weights[k] /= sum;
+                }
+            }
+
+            return table;
+        }
+
+        // Linear float RGBA image used between levels.
+        struct FloatImage
+        {
+            uint32_t width{0};
+            uint32_t height{0};
+            std::vector<float> texels{};
+        };
+
+        auto horizontalPass(FloatImage const& source, uint32_t targetWidth, FilterTable const& table) -> FloatImage
+        {
+            auto result = FloatImage{targetWidth, source.height, std::vector<float>(size_t{targetWidth} * source.height * 4)};
+
+            core::ThreadPool::get().parallelFor(source.height, kRowsPerTask, [&](size_t begin, size_t end)
+            {
+                for (auto y = begin; y < end; ++y)
+                {
+                    auto const* sourceRow = &source.texels[y * source.width * 4];
+                    auto* targetRow = &result.texels[y * targetWidth * 4];
+
+                    for (uint32_t x = 0; x < targetWidth; ++x)
+                    {
+                        auto const* indices = &table.sourceIndex[size_t{x} * table.taps];
+                        auto const* weights = &table.weight[size_t{x} * table.taps];
+#ifdef APRIL_MIP_SSE2
+                        // One RGBA texel per SSE register.
+                        auto sum = _mm_setzero_ps();
+                        for (uint32_t k = 0; k < table.taps; ++k)
+                        {
+                            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(sourceRow + size_t{indices[k]} * 4)));
+                        }
+                        _mm_storeu_ps(targetRow + size_t{x} * 4, sum);
+#else
+                        auto sum = std::array<float, 4>{};
+                        for (uint32_t k = 0; k < table.taps; ++k)
+                        {
+                            for (uint32_t c = 0; c < 4; ++c)
+                            {
+                                sum[c] += weights[k] * sourceRow[size_t{indices[k]} * 4 + c];
+                            }
+                        }
+                        std::memcpy(targetRow + size_t{x} * 4, sum.data(), sizeof(sum));
+#endif
+                    }
+                }
+            });
+
+            return result;
+        }
+
+        // dst[i] += weight * src[i] over a whole row.
+        auto accumulateRow(float* target, float const* source, float weight, size_t count) -> void
+        {
+            auto i = size_t{0};
+#if defined(APRIL_MIP_AVX2)
+            auto const w8 = _mm256_set1_ps(weight);
+            for (; i + 8 <= count; i += 8)
+            {
+                _mm256_storeu_ps(target + i, _mm256_add_ps(_mm256_loadu_ps(target + i), _mm256_mul_ps(w8, _mm256_loadu_ps(source + i))));
+            }
+#endif
+#if defined(APRIL_MIP_SSE2)
+            auto const w4 = _mm_set1_ps(weight);
+            for (; i + 4 <= count; i += 4)
+            {
+                _mm_storeu_ps(target + i, _mm_add_ps(_mm_loadu_ps(target + i), _mm_mul_ps(w4, _mm_loadu_ps(source + i))));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                target[i] += weight * source[i];
+            }
+        }
+
+        auto verticalPass(FloatImage const& source, uint32_t targetHeight, FilterTable const& table) -> FloatImage
+        {
+            auto const rowFloats = size_t{source.width} * 4;
+            auto result = FloatImage{source.width, targetHeight, std::vector<float>(rowFloats * targetHeight)};
+
+            core::ThreadPool::get().parallelFor(targetHeight, kRowsPerTask, [&](size_t begin, size_t end)
+            {
+                for (auto y = begin; y < end; ++y)
+                {
+                    auto* targetRow = &result.texels[y * rowFloats];
+                    for (uint32_t k = 0; k < table.taps; ++k)
+                    {
+                        auto const weight = table.weight[y * table.taps + k];
+                        if (weight != 0.0f)
+                        {
+                            accumulateRow(targetRow, &source.texels[size_t{table.sourceIndex[y * table.taps + k]} * rowFloats], weight, rowFloats);
+                        }
+                    }
+                }
+            });
+
+            return result;
+        }
+
+        auto renormalize(FloatImage& image) -> void
+        {
+            core::ThreadPool::get().parallelFor(image.height, kRowsPerTask, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin * image.width; i < end * image.width; ++i)
+                {
+                    auto* texel = &image.texels[i * 4];
+                    auto const x = texel[0] * 2.0f - 1.0f;
+                    auto const y = texel[1] * 2.0f - 1.0f;
+                    auto const z = texel[2] * 2.0f - 1.0f;
+                    auto const length = std::sqrt(x * x + y * y + z * z);
+                    if (length > 1e-6f)
+                    {
+                        texel[0] = x / length * 0.5f + 0.5f;
+                        texel[1] = y / length * 0.5f + 0.5f;
+                        texel[2] = z / length * 0.5f + 0.5f;
+                    }
+                }
+            });
+        }
+
+        auto decode(std::span<uint8_t const> rgba, uint32_t width, uint32_t height, bool sRGB) -> FloatImage
+        {
+            auto image = FloatImage{width, height, std::vector<float>(size_t{width} * height * 4)};
+            auto const& toLinear = srgbToLinearTable();
+
+            core::ThreadPool::get().parallelFor(height, kRowsPerTask, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin * width * 4; i < end * width * 4; ++i)
+                {
+                    auto const isColor = sRGB && (i % 4) != 3;
+                    image.texels[i] = isColor ? toLinear[rgba[i]] : static_cast<float>(rgba[i]) / 255.0f;
+                }
+            });
+
+            return image;
+        }
+
+        auto encode(FloatImage const& image, bool sRGB) -> MipSurface
+        {
+            auto surface = MipSurface{image.width, image.height, std::vector<uint8_t>(image.texels.size())};
+            auto const& toSrgb = linearToSrgbTable();
+
+            core::ThreadPool::get().parallelFor(image.height, kRowsPerTask, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin * image.width * 4; i < end * image.width * 4; ++i)
+                {
+                    // Windowed-sinc filters overshoot near edges; clamp before quantizing.
+                    auto const value = std::clamp(image.texels[i], 0.0f, 1.0f);
+                    if (sRGB && (i % 4) != 3)
+                    {
+                        surface.pixels[i] = toSrgb[static_cast<size_t>(value * static_cast<float>(kLinearToSrgbEntries - 1) + 0.5f)];
+                    }
+                    else
+                    {
+                        surface.pixels[i] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+                    }
+                }
+            });
+
+            return surface;
+        }
+
+        auto alphaHistogram(std::vector<uint8_t> const& rgba) -> std::array<uint64_t, 256>
+        {
+            auto histogram = std::array<uint64_t, 256>{};
+            for (auto i = size_t{3}; i < rgba.size(); i += 4)
+            {
+                ++histogram[rgba[i]];
+            }
+            return histogram;
+        }
+
+        auto coverage(std::array<uint64_t, 256> const& histogram, float scale, float cutoff) -> double
+        {
+            auto covered = uint64_t{0};
+            auto total = uint64_t{0};
+            for (uint32_t alpha = 0; alpha < 256; ++alpha)
+            {
+                total += histogram[alpha];
+                if (std::min(255.0f, std::round(static_cast<float>(alpha) * scale)) > cutoff)
+                {
+                    covered += histogram[alpha];
+                }
+            }
+            return total == 0 ? 0.0 : static_cast<double>(covered) / static_cast<double>(total);
+        }
+
+        /**
+         * Scale the level's alpha so the fraction of texels passing the alpha test matches mip 0;
+         * plain filtering makes alpha-tested foliage thin out with distance.
+         */
+        auto preserveCoverage(MipSurface& surface, double targetCoverage, float cutoff) -> void
+        {
+            auto const histogram = alphaHistogram(surface.pixels);
+
+            auto low = 0.0f;
+            auto high = 4.0f;
+            for (auto iteration = 0; iteration < 12; ++iteration)
+            {
+                auto const middle = (low + high) * 0.5f;
+                if (coverage(histogram, middle, cutoff) < targetCoverage)
+                {
+                    low = middle;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            // Coverage is quantized by the texel count; take whichever bracket lands closer.
+            auto const lowError = std::abs(coverage(histogram, low, cutoff) - targetCoverage);
+            auto const highError = std::abs(coverage(histogram, high, cutoff) - targetCoverage);
+            auto const scale = lowError < highError ? low : high;
+            for (auto i = size_t{3}; i < surface.pixels.size(); i += 4)
+            {
+                surface.pixels[i] = static_cast<uint8_t>(std::min(255.0f, std::round(static_cast<float>(surface.pixels[i]) * scale)));
+            }
+        }
+    } // namespace
+
+    auto parseMipFilter(std::string_view name) -> MipFilter
+    {
+        if (equalsIgnoreCase(name, "Box")) return MipFilter::Box;
+        if (equalsIgnoreCase(name, "Lanczos")) return MipFilter::Lanczos;
+        return MipFilter::Kaiser;
+    }
+
+    auto calculateMipCount(uint32_t width, uint32_t height) -> uint32_t
+    {
+        auto levels = uint32_t{1};
+        while (width > 1 || height > 1)
+        {
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+            ++levels;
+        }
+        return levels;
+    }
+
+    auto generateMipChain(
+        std::span<uint8_t const> rgba,
+        uint32_t width,
+        uint32_t height,
+        MipGenerationSettings const& settings
+    ) -> std::vector<MipSurface>
+    {
+        if (width == 0 || height == 0 || rgba.size() < size_t{width} * height * 4)
+        {
+            return {};
+        }
+
+        auto surfaces = std::vector<MipSurface>{};
+        surfaces.reserve(calculateMipCount(width, height));
+        surfaces.push_back(MipSurface{width, height, std::vector<uint8_t>(rgba.begin(), rgba.begin() + size_t{width} * height * 4)});
+
+        auto const alphaTested = settings.alphaCutoff > 0.0f;
+        auto const cutoff = settings.alphaCutoff * 255.0f;
+        auto const baseCoverage = alphaTested ? coverage(alphaHistogram(surfaces.front().pixels), 1.0f, cutoff) : 0.0;
+
+        auto level = decode(rgba, width, height, settings.sRGB);
+        while (level.width > 1 || level.height > 1)
+        {
+            auto const targetWidth = std::max(1u, level.width / 2);
+            auto const targetHeight = std::max(1u, level.height / 2);
+
+            auto horizontal = horizontalPass(level, targetWidth, buildFilterTable(level.width, targetWidth, settings.filter));
+            level = verticalPass(horizontal, targetHeight, buildFilterTable(level.height, targetHeight, settings.filter));
+
+            if (settings.normalMap)
+            {
+                renormalize(level);
+            }
+
+            auto surface = encode(level, settings.sRGB);
+            if (alphaTested)
+            {
+                preserveCoverage(surface, baseCoverage, cutoff);
+            }
+            surfaces.push_back(std::move(surface));
+        }
+
+        return surfaces;
+    }
+} // namespace april::asset
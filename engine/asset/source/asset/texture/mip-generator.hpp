@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace april::asset
+{
+    enum class MipFilter : uint8_t
+    {
+        Box,     // Area average. Cheapest, slightly blurry.
+        Kaiser,  // Kaiser-windowed sinc (radius 3). Sharp with little ringing.
+        Lanczos  // Lanczos-3. Sharpest, can ring on hard edges.
+    };
+
+    struct MipGenerationSettings
+    {
+        MipFilter filter{MipFilter::Kaiser};
+        bool sRGB{false};          // Decode to linear before filtering, re-encode afterwards
+        bool normalMap{false};     // Renormalize XYZ after every level
+        float alphaCutoff{0.0f};   // > 0 rescales alpha per level so the coverage above the cutoff matches mip 0
+    };
+
+    struct MipSurface
+    {
+        uint32_t width{0};
+        uint32_t height{0};
+        std::vector<uint8_t> pixels{}; // RGBA8
+    };
+
+    /**
+     * Parse a filter name ("Box", "Kaiser", "Lanczos"). Case-insensitive; unknown names map to Kaiser.
+     */
+    auto parseMipFilter(std::string_view name) -> MipFilter;
+
+    /**
+     * Number of levels down to 1x1. Each level halves (rounding down) until both dimensions are 1.
+     */
+    auto calculateMipCount(uint32_t width, uint32_t height) -> uint32_t;
+
+    /**
+     * Build the full mip chain of an RGBA8 image, level 0 included.
+     * Filtering runs in floating point from the previous level's unquantized result, so non-power-of-two
+     * sizes are resampled with fractional footprints. Rows of each pass are split across the shared
+     * core::ThreadPool; the call is safe to make from several cooking threads at once.
+     */
+    auto generateMipChain(
+        std::span<uint8_t const> rgba,
+        uint32_t width,
+        uint32_t height,
+        MipGenerationSettings const& settings
+    ) -> std::vector<MipSurface>;
+} // namespace april::asset
@@ -0,0 +1,93 @@
+#include "texture-analysis.hpp"
+
+#include <core/thread/thread-pool.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define APRIL_ANALYSIS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace april::asset
+{
+    namespace
+    {
+        constexpr auto kRowsPerTask = size_t{64};
+
+        auto merge(TextureContentInfo& target, TextureContentInfo const& source) -> void
+        {
+            for (size_t c = 0; c < 4; ++c)
+            {
+                target.minValue[c] = std::min(target.minValue[c], source.minValue[c]);
+                target.maxValue[c] = std::max(target.maxValue[c], source.maxValue[c]);
+            }
+            target.grayscale = target.grayscale && source.grayscale;
+        }
+
+        auto analyzeTexels(uint8_t const* texels, size_t count) -> TextureContentInfo
+        {
+            auto info = TextureContentInfo{};
+            auto i = size_t{0};
+#if defined(APRIL_ANALYSIS_SSE2)
+            // Four RGBA texels per register; channel c of every texel lives in byte c of its 32-bit lane.
+            auto minimum = _mm_set1_epi8(static_cast<char>(0xFF));
+            auto maximum = _mm_setzero_si128();
+            auto grayMask = 0xFFFF;
+            for (; i + 4 <= count; i += 4)
+            {
+                auto const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(texels + i * 4));
+                minimum = _mm_min_epu8(minimum, v);
+                maximum = _mm_max_epu8(maximum, v);
+                // Shifting each lane down one byte lines G up with R and B with G.
+                grayMask &= _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_srli_epi32(v, 8)));
+            }
+
+            alignas(16) auto lanes = std::array<uint8_t, 32>{};
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), minimum);
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes.data() + 16), maximum);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    info.minValue[c] = std::min(info.minValue[c], lanes[lane * 4 + c]);
+                    info.maxValue[c] = std::max(info.maxValue[c], lanes[16 + lane * 4 + c]);
+                }
+            }
+            info.grayscale = (grayMask & 0x3333) == 0x3333;
+#endif
+            for (; i < count; ++i)
+            {
+                auto const* texel = texels + i * 4;
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    info.minValue[c] = std::min(info.minValue[c], texel[c]);
+                    info.maxValue[c] = std::max(info.maxValue[c], texel[c]);
+                }
+                info.grayscale = info.grayscale && texel[0] == texel[1] && texel[1] == texel[2];
+            }
+            return info;
+        }
+    }
+
+    auto analyzeTextureContent(std::span<uint8_t const> rgba, uint32_t width, uint32_t height) -> TextureContentInfo
+    {
+        auto const rowTexels = size_t{width};
+        auto const rows = std::min<size_t>(height, rowTexels == 0 ? 0 : rgba.size() / (rowTexels * 4));
+
+        // One slot per task keeps the merge order, and therefore the result, independent of scheduling.
+        auto partial = std::vector<TextureContentInfo>((rows + kRowsPerTask - 1) / kRowsPerTask);
+        core::ThreadPool::get().parallelFor(rows, kRowsPerTask, [&](size_t begin, size_t end)
+        {
+            partial[begin / kRowsPerTask] = analyzeTexels(rgba.data() + begin * rowTexels * 4, (end - begin) * rowTexels);
+        });
+
+        auto info = TextureContentInfo{};
+        for (auto const& chunk : partial)
+        {
+            merge(info, chunk);
+        }
+        return info;
+    }
+} // namespace april::asset
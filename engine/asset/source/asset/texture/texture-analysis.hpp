@@ -0,0 +1,29 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace april::asset
+{
+    /**
+     * Per-channel value range of an RGBA8 image, as stored (sRGB textures are not linearized).
+     */
+    struct TextureContentInfo
+    {
+        std::array<uint8_t, 4> minValue{255, 255, 255, 255};
+        std::array<uint8_t, 4> maxValue{0, 0, 0, 0};
+        bool grayscale{true}; // R == G == B in every texel
+
+        [[nodiscard]] auto isChannelConstant(size_t channel) const -> bool { return minValue[channel] == maxValue[channel]; }
+        [[nodiscard]] auto isConstant() const -> bool { return minValue == maxValue; }
+        [[nodiscard]] auto hasOpaqueAlpha() const -> bool { return minValue[3] == 255; }
+    };
+
+    /**
+     * Scan an RGBA8 image for per-channel min/max and grayscale content.
+     * Four texels are tested per SSE2 step; rows are split across the shared core::ThreadPool.
+     */
+    auto analyzeTextureContent(std::span<uint8_t const> rgba, uint32_t width, uint32_t height) -> TextureContentInfo;
+} // namespace april::asset
@@ -0,0 +1,348 @@
+#include "texture-container.hpp"
+
+#include "bc-encoder.hpp"
+#include "mip-generator.hpp"
+
+#include <core/log/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <string>
+
+namespace april::asset
+{
+    namespace
+    {
+        constexpr auto kDdsMagic = uint32_t{0x20534444}; // "DDS "
+        constexpr auto kDdsHeaderSize = size_t{124};
+        constexpr auto kDdsDx10HeaderSize = size_t{20};
+        constexpr auto kDdsFlagMipMapCount = uint32_t{0x20000};
+        constexpr auto kDdsPixelFourCC = uint32_t{0x4};
+        constexpr auto kDdsPixelRgb = uint32_t{0x40};
+        constexpr auto kDdsCaps2Cubemap = uint32_t{0x200};
+        constexpr auto kDdsCaps2Volume = uint32_t{0x200000};
+        constexpr auto kDxgiDimensionTexture2D = uint32_t{3};
+        constexpr auto kDxgiMiscTextureCube = uint32_t{0x4};
+
+        constexpr auto kKtx2Identifier = std::array<uint8_t, 12>{0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+        constexpr auto kKtx2HeaderSize = size_t{80};
+        constexpr auto kKtx2LevelIndexEntrySize = size_t{24};
+
+        constexpr auto fourCC(char a, char b, char c, char d) -> uint32_t
+        {
+            return uint32_t(uint8_t(a)) | (uint32_t(uint8_t(b)) << 8) | (uint32_t(uint8_t(c)) << 16) | (uint32_t(uint8_t(d)) << 24);
+        }
+
+        template <typename T>
+        auto read(std::span<std::byte const> bytes, size_t offset) -> T
+        {
+            auto value = T{};
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            return value;
+        }
+
+        auto srgbVariant(PixelFormat format) -> PixelFormat
+        {
+            switch (format)
+            {
+            case PixelFormat::RGBA8Unorm: return PixelFormat::RGBA8UnormSrgb;
+            case PixelFormat::BC1Unorm: return PixelFormat::BC1UnormSrgb;
+            case PixelFormat::BC3Unorm: return PixelFormat::BC3UnormSrgb;
+            case PixelFormat::BC7Unorm: return PixelFormat::BC7UnormSrgb;
+            default: return format;
+            }
+        }
+
+        auto isSrgb(PixelFormat format) -> bool
+        {
+            return format == PixelFormat::RGBA8UnormSrgb || format == PixelFormat::BC1UnormSrgb ||
+                   format == PixelFormat::BC3UnormSrgb || format == PixelFormat::BC7UnormSrgb;
+        }
+
+        auto getChannelCount(PixelFormat format) -> uint32_t
+        {
+            switch (format)
+            {
+            case PixelFormat::BC4Unorm: return 1;
+            case PixelFormat::BC5Unorm: return 2;
+            default: return 4;
+            }
+        }
+
+        auto fromDxgiFormat(uint32_t dxgiFormat) -> PixelFormat
+        {
+            switch (dxgiFormat)
+            {
+            case 28: return PixelFormat::RGBA8Unorm;
+            case 29: return PixelFormat::RGBA8UnormSrgb;
+            case 71: return PixelFormat::BC1Unorm;
+            case 72: return PixelFormat::BC1UnormSrgb;
+            case 77: return PixelFormat::BC3Unorm;
+            case 78: return PixelFormat::BC3UnormSrgb;
+            case 80: return PixelFormat::BC4Unorm;
+            case 83: return PixelFormat::BC5Unorm;
+            case 98: return PixelFormat::BC7Unorm;
+            case 99: return PixelFormat::BC7UnormSrgb;
+            default: return PixelFormat::Unknown;
+            }
+        }
+
+        auto fromVkFormat(uint32_t vkFormat) -> PixelFormat
+        {
+            switch (vkFormat)
+            {
+            case 37: return PixelFormat::RGBA8Unorm;
+            case 43: return PixelFormat::RGBA8UnormSrgb;
+            case 131: // BC1_RGB
+            case 133: return PixelFormat::BC1Unorm;
+            case 132:
+            case 134: return PixelFormat::BC1UnormSrgb;
+            case 137: return PixelFormat::BC3Unorm;
+            case 138: return PixelFormat::BC3UnormSrgb;
+            case 139: return PixelFormat::BC4Unorm;
+            case 141: return PixelFormat::BC5Unorm;
+            case 145: return PixelFormat::BC7Unorm;
+            case 146: return PixelFormat::BC7UnormSrgb;
+            default: return PixelFormat::Unknown;
+            }
+        }
+
+        auto makeTexture(uint32_t width, uint32_t height, PixelFormat format) -> ContainerTexture
+        {
+            auto texture = ContainerTexture{};
+            texture.width = width;
+            texture.height = height;
+            texture.format = format;
+            texture.channels = getChannelCount(format);
+            texture.sRGB = isSrgb(format);
+            return texture;
+        }
+
+        auto readDds(std::span<std::byte const> bytes, bool preferSrgb) -> std::optional<ContainerTexture>
+        {
+            if (bytes.size() < 4 + kDdsHeaderSize || read<uint32_t>(bytes, 4) != kDdsHeaderSize)
+            {
+                AP_ERROR("[TextureContainer] Truncated DDS header");
+                return std::nullopt;
+            }
+
+            auto const flags = read<uint32_t>(bytes, 8);
+            auto const height = read<uint32_t>(bytes, 12);
+            auto const width = read<uint32_t>(bytes, 16);
+            auto const pixelFlags = read<uint32_t>(bytes, 80);
+            auto const pixelFourCC = read<uint32_t>(bytes, 84);
+            auto const caps2 = read<uint32_t>(bytes, 112);
+
+            if (caps2 & (kDdsCaps2Cubemap | kDdsCaps2Volume))
+            {
+                AP_ERROR("[TextureContainer] DDS cube maps and volume textures are not supported");
+                return std::nullopt;
+            }
+
+            if (width == 0 || height == 0)
+            {
+                AP_ERROR("[TextureContainer] DDS texture has zero size");
+                return std::nullopt;
+            }
+
+            // Levels past the 1x1 mip are not part of the chain; drop them rather than upload past it.
+            auto const storedMipCount = (flags & kDdsFlagMipMapCount) ? std::max(read<uint32_t>(bytes, 28), 1u) : 1u;
+            auto const mipCount = std::min(storedMipCount, calculateMipCount(width, height));
+
+            auto format = PixelFormat::Unknown;
+            auto dataOffset = 4 + kDdsHeaderSize;
+            if ((pixelFlags & kDdsPixelFourCC) && pixelFourCC == fourCC('D', 'X', '1', '0'))
+            {
+                if (bytes.size() < dataOffset + kDdsDx10HeaderSize)
+                {
+                    AP_ERROR("[TextureContainer] Truncated DDS DX10 header");
+                    return std::nullopt;
+                }
+
+                auto const dimension = read<uint32_t>(bytes, dataOffset + 4);
+                auto const miscFlags = read<uint32_t>(bytes, dataOffset + 8);
+                auto const arraySize = read<uint32_t>(bytes, dataOffset + 12);
+                if (dimension != kDxgiDimensionTexture2D || (miscFlags & kDxgiMiscTextureCube) || arraySize > 1)
+                {
+                    AP_ERROR("[TextureContainer] Only single 2D DDS textures are supported");
+                    return std::nullopt;
+                }
+
+                format = fromDxgiFormat(read<uint32_t>(bytes, dataOffset));
+                dataOffset += kDdsDx10HeaderSize;
+            }
+            else if (pixelFlags & kDdsPixelFourCC)
+            {
+                switch (pixelFourCC)
+                {
+                case fourCC('D', 'X', 'T', '1'): format = PixelFormat::BC1Unorm; break;
+                case fourCC('D', 'X', 'T', '4'):
+                case fourCC('D', 'X', 'T', '5'): format = PixelFormat::BC3Unorm; break;
+                case fourCC('A', 'T', 'I', '1'):
+                case fourCC('B', 'C', '4', 'U'): format = PixelFormat::BC4Unorm; break;
+                case fourCC('A', 'T', 'I', '2'):
+                case fourCC('B', 'C', '5', 'U'): format = PixelFormat::BC5Unorm; break;
+                default: break;
+                }
+
+                if (preferSrgb)
+                {
+                    format = srgbVariant(format);
+                }
+            }
+            else if ((pixelFlags & kDdsPixelRgb) && read<uint32_t>(bytes, 88) == 32 &&
+                     read<uint32_t>(bytes, 92) == 0x000000FF && read<uint32_t>(bytes, 96) == 0x0000FF00 &&
+                     read<uint32_t>(bytes, 100) == 0x00FF0000)
+            {
+                format = preferSrgb ? PixelFormat::RGBA8UnormSrgb : PixelFormat::RGBA8Unorm;
+            }
+
+            if (format == PixelFormat::Unknown)
+            {
+                AP_ERROR("[TextureContainer] Unsupported DDS pixel format");
+                return std::nullopt;
+            }
+
+            auto texture = makeTexture(width, height, format);
+            auto offset = dataOffset;
+            for (uint32_t level = 0; level < mipCount; ++level)
+            {
+                auto const size = getSurfaceSize(format, std::max(width >> level, 1u), std::max(height >> level, 1u));
+                if (size > bytes.size() - offset)
+                {
+                    AP_ERROR("[TextureContainer] DDS mip {} runs past the end of the file", level);
+                    return std::nullopt;
+                }
+
+                texture.levels.push_back(bytes.subspan(offset, size));
+                offset += size;
+            }
+
+            return texture;
+        }
+
+        auto readKtx2(std::span<std::byte const> bytes) -> std::optional<ContainerTexture>
+        {
+            if (bytes.size() < kKtx2HeaderSize)
+            {
+                AP_ERROR("[TextureContainer] Truncated KTX2 header");
+                return std::nullopt;
+            }
+
+            auto const vkFormat = read<uint32_t>(bytes, 12);
+            auto const width = read<uint32_t>(bytes, 20);
+            auto const height = std::max(read<uint32_t>(bytes, 24), 1u); // 0 marks a 1D texture
+            auto const depth = read<uint32_t>(bytes, 28);
+            auto const layerCount = read<uint32_t>(bytes, 32);
+            auto const faceCount = read<uint32_t>(bytes, 36);
+            auto const levelCount = std::max(read<uint32_t>(bytes, 40), 1u);
+            auto const supercompression = read<uint32_t>(bytes, 44);
+
+            if (supercompression != 0)
+            {
+                AP_ERROR("[TextureContainer] Supercompressed KTX2 (scheme {}) is not supported", supercompression);
+                return std::nullopt;
+            }
+
+            if (depth > 1 || layerCount > 1 || faceCount != 1)
+            {
+                AP_ERROR("[TextureContainer] Only single 2D KTX2 textures are supported");
+                return std::nullopt;
+            }
+
+            auto const format = fromVkFormat(vkFormat);
+            if (format == PixelFormat::Unknown)
+            {
+                AP_ERROR("[TextureContainer] Unsupported KTX2 vkFormat {}", vkFormat);
+                return std::nullopt;
+            }
+
+            if (width == 0)
+            {
+                AP_ERROR("[TextureContainer] KTX2 texture has zero size");
+                return std::nullopt;
+            }
+
+            if (levelCount > 32 || bytes.size() < kKtx2HeaderSize + levelCount * kKtx2LevelIndexEntrySize)
+            {
+                AP_ERROR("[TextureContainer] Truncated KTX2 level index");
+                return std::nullopt;
+            }
+
+            auto texture = makeTexture(width, height, format);
+            auto const mipCount = std::min(levelCount, calculateMipCount(width, height));
+            for (uint32_t level = 0; level < mipCount; ++level)
+            {
+                auto const entry = kKtx2HeaderSize + level * kKtx2LevelIndexEntrySize;
+                auto const offset = read<uint64_t>(bytes, entry);
+                auto const length = read<uint64_t>(bytes, entry + 8);
+                auto const expected = getSurfaceSize(format, std::max(width >> level, 1u), std::max(height >> level, 1u));
+                if (length != expected || offset > bytes.size() || length > bytes.size() - offset)
+                {
+                    AP_ERROR("[TextureContainer] KTX2 mip {} has an invalid range", level);
+                    return std::nullopt;
+                }
+
+                texture.levels.push_back(bytes.subspan(static_cast<size_t>(offset), static_cast<size_t>(length)));
+            }
+
+            return texture;
+        }
+    } // namespace
+
+    auto isTextureContainerExtension(std::string_view extension) -> bool
+    {
+        auto lower = std::string{extension};
+        std::ranges::transform(lower, lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return lower == ".dds" || lower == ".ktx2";
+    }
+
+    auto getSurfaceSize(PixelFormat format, uint32_t width, uint32_t height) -> size_t
+    {
+        switch (format)
+        {
+        case PixelFormat::R8Unorm: return size_t{width} * height;
+        case PixelFormat::RG8Unorm: return size_t{width} * height * 2;
+        case PixelFormat::RGBA8Unorm:
+        case PixelFormat::RGBA8UnormSrgb: return size_t{width} * height * 4;
+        case PixelFormat::BC1Unorm:
+        case PixelFormat::BC1UnormSrgb: return getBcSurfaceSize(BcFormat::BC1, width, height);
+        case PixelFormat::BC3Unorm:
+        case PixelFormat::BC3UnormSrgb: return getBcSurfaceSize(BcFormat::BC3, width, height);
+        case PixelFormat::BC4Unorm: return getBcSurfaceSize(BcFormat::BC4, width, height);
+        case PixelFormat::BC5Unorm: return getBcSurfaceSize(BcFormat::BC5, width, height);
+        case PixelFormat::BC7Unorm:
+        case PixelFormat::BC7UnormSrgb: return getBcSurfaceSize(BcFormat::BC7, width, height);
+        default: return 0;
+        }
+    }
+
+    auto readTextureContainer(std::span<std::byte const> bytes, bool preferSrgb) -> std::optional<ContainerTexture>
+    {
+        auto texture = std::optional<ContainerTexture>{};
+        if (bytes.size() >= 4 && read<uint32_t>(bytes, 0) == kDdsMagic)
+        {
+            texture = readDds(bytes, preferSrgb);
+        }
+        else if (bytes.size() >= kKtx2Identifier.size() &&
+                 std::memcmp(bytes.data(), kKtx2Identifier.data(), kKtx2Identifier.size()) == 0)
+        {
+            texture = readKtx2(bytes);
+        }
+        else
+        {
+            AP_ERROR("[TextureContainer] Not a DDS or KTX2 file");
+            return std::nullopt;
+        }
+
+        if (texture && (texture->width == 0 || texture->height == 0))
+        {
+            AP_ERROR("[TextureContainer] Texture has zero size");
+            return std::nullopt;
+        }
+
+        return texture;
+    }
+} // namespace april::asset
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../blob-header.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace april::asset
+{
+    /**
+     * A single 2D image with its mip chain, read from a DDS or KTX2 container in a GPU-ready format.
+     */
+    struct ContainerTexture
+    {
+        uint32_t width{0};
+        uint32_t height{0};
+        PixelFormat format{PixelFormat::Unknown};
+        uint32_t channels{4};
+        bool sRGB{false};
+        std::vector<std::span<std::byte const>> levels{}; // Largest first; views into the container bytes
+    };
+
+    /**
+     * True for the precompressed container extensions (".dds", ".ktx2"). Case-insensitive.
+     */
+    auto isTextureContainerExtension(std::string_view extension) -> bool;
+
+    /**
+     * Bytes of one surface in format, with partial 4x4 blocks counted as whole blocks.
+     * Returns 0 for formats the texture blob cannot hold.
+     */
+    auto getSurfaceSize(PixelFormat format, uint32_t width, uint32_t height) -> size_t;
+
+    /**
+     * Parse a DDS (legacy FourCC or DX10 header) or KTX2 container holding BC1, BC3, BC4, BC5, BC7 or RGBA8 data.
+     * Nothing is decoded; the levels point into bytes, which must outlive the result.
+     * @param preferSrgb Color space for legacy DDS FourCCs, which do not record one.
+     * @return nullopt for malformed files, supercompressed KTX2, cube maps, arrays, volumes and other formats.
+     */
+    auto readTextureContainer(std::span<std::byte const> bytes, bool preferSrgb) -> std::optional<ContainerTexture>;
+} // namespace april::asset
@@ -0,0 +1,248 @@
+#include "texture-streaming.hpp"
+#include "texture-container.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace april::asset
+{
+    namespace
+    {
+        auto getMipExtent(uint32_t extent, uint32_t mip) -> uint32_t
+        {
+            return mip >= 32 ? 1u : std::max(extent >> mip, 1u);
+        }
+
+        auto getMipSize(TextureHeader const& header, uint32_t mip) -> uint64_t
+        {
+            return getSurfaceSize(header.format, getMipExtent(header.width, mip), getMipExtent(header.height, mip));
+        }
+
+        auto getLastMip(TextureHeader const& header) -> uint32_t
+        {
+            return std::max(header.mipLevels, 1u) - 1;
+        }
+    }
+
+    auto getMipMaxDimension(TextureHeader const& header, uint32_t mip) -> uint32_t
+    {
+        return std::max(getMipExtent(header.width, mip), getMipExtent(header.height, mip));
+    }
+
+    auto getFirstMipWithin(TextureHeader const& header, uint32_t maxDimension) -> uint32_t
+    {
+        auto const lastMip = getLastMip(header);
+        for (uint32_t mip = 0; mip < lastMip; ++mip)
+        {
+            if (getMipMaxDimension(header, mip) <= maxDimension)
+            {
+                return mip;
+            }
+        }
+        return lastMip;
+    }
+
+    auto getMipChainSize(TextureHeader const& header, uint32_t firstMip) -> uint64_t
+    {
+        auto size = uint64_t{0};
+        for (auto mip = firstMip; mip < header.mipLevels; ++mip)
+        {
+            auto const mipSize = getMipSize(header, mip);
+            if (mipSize == 0)
+            {
+                return 0;
+            }
+            size += mipSize;
+        }
+        return size;
+    }
+
+    auto computeDesiredMip(TextureHeader const& header, float projectedSize, float bias) -> uint32_t
+    {
+        auto const lastMip = getLastMip(header);
+        if (!(projectedSize > 0.0f))
+        {
+            return lastMip;
+        }
+
+        auto const lod = std::log2(static_cast<float>(getMipMaxDimension(header, 0)) / projectedSize) + bias;
+        if (!(lod > 0.0f))
+        {
+            return 0;
+        }
+        return std::min(static_cast<uint32_t>(std::min(lod, 31.0f)), lastMip);
+    }
+
+    TextureResidencyPlanner::TextureResidencyPlanner(TextureStreamingSettings const& settings)
+        : m_settings{settings}
+    {}
+
+    auto TextureResidencyPlanner::addTexture(core::UUID const& id, TextureHeader const& header, uint32_t residentMip) -> void
+    {
+        auto entry = Entry{};
+        entry.id = id;
+        entry.header = header;
+        entry.tailMip = getFirstMipWithin(header, m_settings.mipTailSize);
+        entry.residentMip = std::min(residentMip, getLastMip(header));
+        entry.requestedMip = entry.tailMip;
+
+        if (auto const it = m_indices.find(id); it != m_indices.end())
+        {
+            m_entries[it->second] = entry;
+            return;
+        }
+
+        m_indices.emplace(id, m_entries.size());
+        m_entries.push_back(entry);
+    }
+
+    auto TextureResidencyPlanner::removeTexture(core::UUID const& id) -> void
+    {
+        auto const it = m_indices.find(id);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        auto const index = it->second;
+        m_indices.erase(it);
+        if (index + 1 != m_entries.size())
+        {
+            m_entries[index] = std::move(m_entries.back());
+            m_indices[m_entries[index].id] = index;
+        }
+        m_entries.pop_back();
+    }
+
+    auto TextureResidencyPlanner::requestMip(core::UUID const& id, uint32_t mip, uint64_t frame) -> void
+    {
+        auto const it = m_indices.find(id);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        auto& entry = m_entries[it->second];
+        if (!entry.requested || entry.lastRequestFrame != frame)
+        {
+            entry.requestedMip = mip;
+        }
+        else
+        {
+            entry.requestedMip = std::min(entry.requestedMip, mip);
+        }
+        entry.lastRequestFrame = frame;
+        entry.requested = true;
+    }
+
+    auto TextureResidencyPlanner::setResidentMip(core::UUID const& id, uint32_t mip) -> void
+    {
+        if (auto const it = m_indices.find(id); it != m_indices.end())
+        {
+            auto& entry = m_entries[it->second];
+            entry.residentMip = std::min(mip, getLastMip(entry.header));
+        }
+    }
+
+    auto TextureResidencyPlanner::getResidentMip(core::UUID const& id) const -> uint32_t
+    {
+        auto const it = m_indices.find(id);
+        return it == m_indices.end() ? 0 : m_entries[it->second].residentMip;
+    }
+
+    auto TextureResidencyPlanner::getTailMip(core::UUID const& id) const -> uint32_t
+    {
+        auto const it = m_indices.find(id);
+        return it == m_indices.end() ? 0 : m_entries[it->second].tailMip;
+    }
+
+    auto TextureResidencyPlanner::getResidentBytes() const -> uint64_t
+    {
+        auto bytes = uint64_t{0};
+        for (auto const& entry : m_entries)
+        {
+            bytes += getMipChainSize(entry.header, entry.residentMip);
+        }
+        return bytes;
+    }
+
+    auto TextureResidencyPlanner::plan(uint64_t frame) -> std::vector<Change>
+    {
+        struct Step
+        {
+            size_t entry{0};
+            uint32_t mip{0};
+            uint32_t height{0};  // Levels above the desired mip; coarse levels are worth more
+            uint64_t lastRequestFrame{0};
+            uint64_t bytes{0};
+        };
+
+        auto targets = std::vector<uint32_t>(m_entries.size());
+        auto steps = std::vector<Step>{};
+        auto used = uint64_t{0};
+
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            auto const& entry = m_entries[i];
+            targets[i] = entry.tailMip;
+            used += getMipChainSize(entry.header, entry.tailMip);
+
+            auto const stale = !entry.requested || frame > entry.lastRequestFrame + m_settings.evictAfterFrames;
+            auto const desired = stale ? entry.tailMip : std::min(entry.requestedMip, entry.tailMip);
+            for (auto mip = entry.tailMip; mip-- > desired;)
+            {
+                steps.push_back(Step{i, mip, mip - desired, entry.lastRequestFrame, getMipSize(entry.header, mip)});
+            }
+        }
+
+        std::ranges::sort(steps, [](Step const& lhs, Step const& rhs)
+        {
+            if (lhs.height != rhs.height)
+            {
+                return lhs.height > rhs.height;
+            }
+            if (lhs.lastRequestFrame != rhs.lastRequestFrame)
+            {
+                return lhs.lastRequestFrame > rhs.lastRequestFrame;
+            }
+            if (lhs.entry != rhs.entry)
+            {
+                return lhs.entry < rhs.entry;
+            }
+            return lhs.mip > rhs.mip;
+        });
+
+        // A texture that cannot afford a level stops there; finer levels would leave a hole in its chain.
+        auto blocked = std::vector<bool>(m_entries.size(), false);
+        for (auto const& step : steps)
+        {
+            if (blocked[step.entry])
+            {
+                continue;
+            }
+            if (used + step.bytes > m_settings.budgetBytes)
+            {
+                blocked[step.entry] = true;
+                continue;
+            }
+            used += step.bytes;
+            targets[step.entry] = step.mip;
+        }
+
+        auto changes = std::vector<Change>{};
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            if (targets[i] != m_entries[i].residentMip)
+            {
+                changes.push_back(Change{m_entries[i].id, targets[i]});
+            }
+        }
+
+        // Evictions first so their memory is released before the upgrades arrive.
+        std::ranges::stable_partition(changes, [this](Change const& change)
+        {
+            return change.targetMip > getResidentMip(change.id);
+        });
+        return changes;
+    }
+} // namespace april::asset
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../blob-header.hpp"
+
+#include <core/tools/uuid.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace april::asset
+{
+    struct TextureStreamingSettings
+    {
+        uint64_t budgetBytes{512ull << 20};  // Texture memory for streamed mips; the mip tails are always resident
+        uint32_t mipTailSize{128};           // Mips whose larger side is at most this are loaded up front
+        uint32_t evictAfterFrames{120};      // Textures not requested for this long fall back to their mip tail
+        float mipBias{0.0f};                 // Added to the desired mip; > 0 trades sharpness for memory
+        size_t maxLoadsInFlight{8};          // Residency changes the streamer keeps queued at once
+    };
+
+    /**
+     * Larger side of a mip level, at least 1.
+     */
+    auto getMipMaxDimension(TextureHeader const& header, uint32_t mip) -> uint32_t;
+
+    /**
+     * First mip whose larger side fits maxDimension; the last mip if none does.
+     */
+    auto getFirstMipWithin(TextureHeader const& header, uint32_t maxDimension) -> uint32_t;
+
+    /**
+     * Bytes of mips [firstMip, mipLevels) as laid out in the blob. Returns 0 for unknown formats.
+     */
+    auto getMipChainSize(TextureHeader const& header, uint32_t firstMip) -> uint64_t;
+
+    /**
+     * Mip that maps about one texel to one pixel when the texture spans projectedSize pixels on screen,
+     * offset by bias and clamped to the chain. projectedSize <= 0 selects the last mip.
+     */
+    auto computeDesiredMip(TextureHeader const& header, float projectedSize, float bias = 0.0f) -> uint32_t;
+
+    /**
+     * Decides which mips of each streamed texture should be resident under a memory budget.
+     * Mip tails are always kept. The remaining budget is handed out one mip at a time, coarsest relative
+     * to each texture's desired mip first and recently requested textures first, so a tight budget
+     * degrades every texture evenly instead of starving some. Pure bookkeeping: it never touches GPU
+     * resources, the caller reports finished loads through setResidentMip.
+     */
+    class TextureResidencyPlanner
+    {
+    public:
+        struct Change
+        {
+            core::UUID id{};
+            uint32_t targetMip{0};
+        };
+
+        explicit TextureResidencyPlanner(TextureStreamingSettings const& settings = {});
+
+        auto setSettings(TextureStreamingSettings const& settings) -> void { m_settings = settings; }
+        [[nodiscard]] auto getSettings() const -> TextureStreamingSettings const& { return m_settings; }
+
+        /**
+         * Track a texture. header describes the full stored chain; residentMip is the first mip already loaded.
+         */
+        auto addTexture(core::UUID const& id, TextureHeader const& header, uint32_t residentMip) -> void;
+        auto removeTexture(core::UUID const& id) -> void;
+        [[nodiscard]] auto contains(core::UUID const& id) const -> bool { return m_indices.contains(id); }
+
+        /**
+         * Ask for mip (or finer) during frame. Several requests in one frame keep the finest.
+         */
+        auto requestMip(core::UUID const& id, uint32_t mip, uint64_t frame) -> void;
+        auto setResidentMip(core::UUID const& id, uint32_t mip) -> void;
+
+        [[nodiscard]] auto getResidentMip(core::UUID const& id) const -> uint32_t;
+        [[nodiscard]] auto getTailMip(core::UUID const& id) const -> uint32_t;
+        [[nodiscard]] auto getResidentBytes() const -> uint64_t;
+
+        /**
+         * Compute the target mip of every texture for frame and return those that differ from the resident one,
+         * evictions (coarser targets) first.
+         */
+        auto plan(uint64_t frame) -> std::vector<Change>;
+
+    private:
+        struct Entry
+        {
+            core::UUID id{};
+            TextureHeader header{};
+            uint32_t tailMip{0};
+            uint32_t residentMip{0};
+            uint32_t requestedMip{0};
+            uint64_t lastRequestFrame{0};
+            bool requested{false};
+        };
+
+        TextureStreamingSettings m_settings{};
+        std::vector<Entry> m_entries{};
+        std::unordered_map<core::UUID, size_t> m_indices{};
+    };
+} // namespace april::asset
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <string_view>
+
+namespace april::asset
+{
+    // ASCII case-insensitive comparison used when parsing texture setting names.
+    [[nodiscard]] inline auto equalsIgnoreCase(std::string_view lhs, std::string_view rhs) -> bool
+    {
+        return std::ranges::equal(lhs, rhs, [](char a, char b)
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        });
+    }
+}
@@ -0,0 +1,179 @@
+#include "mapped-file.hpp"
+#include "core/log/logger.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace april
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+    {
+        if (this != &other)
+        {
+            close();
+            mp_data = std::exchange(other.mp_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_isOpen = std::exchange(other.m_isOpen, false);
+#ifdef _WIN32
+            mp_fileHandle = std::exchange(other.mp_fileHandle, nullptr);
+            mp_mappingHandle = std::exchange(other.mp_mappingHandle, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    auto MappedFile::open(std::filesystem::path const& path) -> bool
+    {
+        close();
+
+#ifdef _WIN32
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            AP_ERROR("[MappedFile] Failed to open file: {}", path.string());
+            return false;
+        }
+
+        auto fileSize = LARGE_INTEGER{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            AP_ERROR("[MappedFile] Failed to query file size: {}", path.string());
+            return false;
+        }
+
+        mp_fileHandle = file;
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        m_isOpen = true;
+        if (m_size == 0)
+        {
+            return true;
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            AP_ERROR("[MappedFile] Failed to create file mapping: {}", path.string());
+            close();
+            return false;
+        }
+        mp_mappingHandle = mapping;
+
+        auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            AP_ERROR("[MappedFile] Failed to map view of file: {}", path.string());
+            close();
+            return false;
+        }
+        mp_data = static_cast<std::byte const*>(view);
+#else
+        auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            AP_ERROR("[MappedFile] Failed to open file: {}", path.string());
+            return false;
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            AP_ERROR("[MappedFile] Failed to query file size: {}", path.string());
+            return false;
+        }
+
+        m_size = static_cast<size_t>(st.st_size);
+        m_isOpen = true;
+        if (m_size > 0)
+        {
+            auto* view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view == MAP_FAILED)
+            {
+                ::close(fd);
+                m_size = 0;
+                m_isOpen = false;
+                AP_ERROR("[MappedFile] Failed to map file: {}", path.string());
+                return false;
+            }
+            mp_data = static_cast<std::byte const*>(view);
+        }
+        ::close(fd);
+#endif
+        return true;
+    }
+
+    auto MappedFile::prefetch(size_t offset, size_t size) const -> void
+    {
+        if (!mp_data || size == 0 || offset >= m_size)
+        {
+            return;
+        }
+
+        auto constexpr kPageSize = size_t{4096};
+        size = std::min(size, m_size - offset);
+#ifndef _WIN32
+        // Start the reads for the whole range at once; touching the pages below then mostly hits memory.
+        auto const alignedOffset = offset & ~(kPageSize - 1);
+        madvise(const_cast<std::byte*>(mp_data) + alignedOffset, size + (offset - alignedOffset), MADV_WILLNEED);
+#endif
+
+        auto sum = uint8_t{0};
+        for (auto position = offset; position < offset + size; position += kPageSize)
+        {
+            sum += static_cast<uint8_t>(*reinterpret_cast<std::byte const volatile*>(mp_data + position));
+        }
+        // The stride above can step over the last page of a range that does not start page aligned
+        sum += static_cast<uint8_t>(*reinterpret_cast<std::byte const volatile*>(mp_data + offset + size - 1));
+        static_cast<void>(sum);
+    }
+
+    auto MappedFile::close() -> void
+    {
+#ifdef _WIN32
+        if (mp_data)
+        {
+            UnmapViewOfFile(mp_data);
+        }
+        if (mp_mappingHandle)
+        {
+            CloseHandle(mp_mappingHandle);
+        }
+        if (mp_fileHandle)
+        {
+            CloseHandle(mp_fileHandle);
+        }
+        mp_mappingHandle = nullptr;
+        mp_fileHandle = nullptr;
+#else
+        if (mp_data)
+        {
+            munmap(const_cast<std::byte*>(mp_data), m_size);
+        }
+#endif
+        mp_data = nullptr;
+        m_size = 0;
+        m_isOpen = false;
+    }
+} // namespace april
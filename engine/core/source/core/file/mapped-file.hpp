@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace april
+{
+    /**
+     * Read-only memory mapping of a whole file.
+     * The mapped bytes stay valid until the object is closed or destroyed.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile const&) = delete;
+        auto operator=(MappedFile const&) -> MappedFile& = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+        /**
+         * Map a physical file. Returns false if the file cannot be opened or mapped.
+         */
+        auto open(std::filesystem::path const& path) -> bool;
+        auto close() -> void;
+
+        [[nodiscard]] auto isOpen() const -> bool { return m_isOpen; }
+        [[nodiscard]] auto getSize() const -> size_t { return m_size; }
+        [[nodiscard]] auto getData() const -> std::span<std::byte const> { return {mp_data, m_size}; }
+
+        /**
+         * Fault in the pages of [offset, offset + size), clamped to the file, so later reads of the range
+         * do not wait on the disk. The pages stay in the OS cache after the mapping is closed.
+         */
+        auto prefetch(size_t offset, size_t size) const -> void;
+
+    private:
+        std::byte const* mp_data{nullptr};
+        size_t m_size{0};
+        bool m_isOpen{false};
+#ifdef _WIN32
+        void* mp_fileHandle{nullptr};
+        void* mp_mappingHandle{nullptr};
+#endif
+    };
+} // namespace april
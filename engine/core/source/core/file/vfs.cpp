@@ -259,6 +259,17 @@ namespace april
         return file->readAll();
     }
 
+    auto VFS::mapFile(std::string const& virtualPath) -> std::shared_ptr<MappedFile>
+    {
+        auto mapped = std::make_shared<MappedFile>();
+        if (!mapped->open(resolvePath(virtualPath)))
+        {
+            return nullptr;
+        }
+
+        return mapped;
+    }
+
     auto VFS::writeTextFile(std::string const& virtualPath, std::string const& contents) -> bool
     {
         auto path = resolvePath(virtualPath);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "mapped-file.hpp"
+
 #include <string>
 #include <vector>
 #include <memory>
@@ -50,6 +52,11 @@ namespace april
         [[nodiscard]] static auto writeTextFile(std::string const& virtualPath, std::string const& contents) -> bool;
         [[nodiscard]] static auto writeBinaryFile(std::string const& virtualPath, std::span<std::byte const> contents) -> bool;
 
+        /**
+         * Memory-map a file read-only. Returns nullptr on failure.
+         */
+        [[nodiscard]] static auto mapFile(std::string const& virtualPath) -> std::shared_ptr<MappedFile>;
+
         [[nodiscard]] static auto resolvePath(std::string const& virtualPath) -> std::filesystem::path;
 
         [[nodiscard]] static auto listFilesRecursive(
@@ -70,6 +70,7 @@ namespace april
         auto removeSink(std::shared_ptr<ILogSink> p_sink) -> void;
 
         auto setLevel(ELogLevel level) -> void { m_minLevel = level; }
+        auto getLevel() const -> ELogLevel { return m_minLevel; }
 
         auto setConfig(LogConfig const& config) -> void { m_config = config; }
         auto getConfig() const -> LogConfig const& { return m_config; }
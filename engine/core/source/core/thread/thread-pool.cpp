@@ -0,0 +1,108 @@
+#include "thread-pool.hpp"
+
+namespace april::core
+{
+    ThreadPool::ThreadPool(uint32_t workerCount)
+    {
+        if (workerCount == 0)
+        {
+            auto const hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        m_workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            auto lock = std::scoped_lock{m_mutex};
+            m_stopping = true;
+        }
+        m_taskAvailable.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+
+    auto ThreadPool::get() -> ThreadPool&
+    {
+        static auto pool = ThreadPool{};
+        return pool;
+    }
+
+    auto ThreadPool::submit(Task task, TaskPriority priority) -> void
+    {
+        if (!task)
+        {
+            return;
+        }
+
+        {
+            auto lock = std::scoped_lock{m_mutex};
+            m_queues[static_cast<size_t>(priority)].push_back(std::move(task));
+            ++m_queuedTasks;
+        }
+        m_taskAvailable.notify_one();
+    }
+
+    auto ThreadPool::waitIdle() -> void
+    {
+        auto lock = std::unique_lock{m_mutex};
+        m_idle.wait(lock, [this]() { return m_queuedTasks == 0 && m_runningTasks == 0; });
+    }
+
+    auto ThreadPool::popTaskLocked() -> Task
+    {
+        for (auto& queue : m_queues)
+        {
+            if (!queue.empty())
+            {
+                auto task = std::move(queue.front());
+                queue.pop_front();
+                --m_queuedTasks;
+                return task;
+            }
+        }
+        return {};
+    }
+
+    auto ThreadPool::workerLoop() -> void
+    {
+        while (true)
+        {
+            auto task = Task{};
+            {
+                auto lock = std::unique_lock{m_mutex};
+                m_taskAvailable.wait(lock, [this]() { return m_stopping || m_queuedTasks > 0; });
+                if (m_stopping && m_queuedTasks == 0)
+                {
+                    return;
+                }
+
+                task = popTaskLocked();
+                ++m_runningTasks;
+            }
+
+            task();
+
+            {
+                auto lock = std::scoped_lock{m_mutex};
+                --m_runningTasks;
+                if (m_queuedTasks == 0 && m_runningTasks == 0)
+                {
+                    m_idle.notify_all();
+                }
+            }
+        }
+    }
+} // namespace april::core
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace april::core
+{
+    enum class TaskPriority : uint8_t
+    {
+        High,
+        Normal,
+        Low
+    };
+
+    /**
+     * Fixed-size worker pool with one FIFO queue per priority class.
+     * Higher priority queues are always drained before lower ones.
+     */
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+        /**
+         * @param workerCount Number of worker threads. 0 selects hardware_concurrency - 1.
+         */
+        explicit ThreadPool(uint32_t workerCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(ThreadPool const&) = delete;
+        auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+
+        /**
+         * Process-wide pool shared by engine subsystems (asset loading, cooking).
+         */
+        static auto get() -> ThreadPool&;
+
+        auto submit(Task task, TaskPriority priority = TaskPriority::Normal) -> void;
+
+        /**
+         * Blocks until every queued and running task has finished.
+         */
+        auto waitIdle() -> void;
+
+        [[nodiscard]] auto getWorkerCount() const -> uint32_t { return static_cast<uint32_t>(m_workers.size()); }
+
+        /**
+         * Run func(begin, end) over [0, count) split into chunks of at most grainSize.
+         * The calling thread participates, so nested calls from worker threads cannot deadlock.
+         */
+        template <typename Func>
+        auto parallelFor(size_t count, size_t grainSize, Func&& func) -> void
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            grainSize = std::max<size_t>(grainSize, 1);
+            auto const chunkCount = (count + grainSize - 1) / grainSize;
+            if (chunkCount == 1 || m_workers.empty())
+            {
+                func(size_t{0}, count);
+                return;
+            }
+
+            struct ForState
+            {
+                std::atomic<size_t> nextChunk{0};
+                std::atomic<size_t> doneChunks{0};
+                std::mutex mutex{};
+                std::condition_variable done{};
+            };
+
+            auto state = std::make_shared<ForState>();
+            auto runChunks = [state, count, grainSize, chunkCount, &func]() -> void
+            {
+                while (true)
+                {
+                    auto const chunk = state->nextChunk.fetch_add(1);
+                    if (chunk >= chunkCount)
+                    {
+                        return;
+                    }
+
+                    auto const begin = chunk * grainSize;
+                    func(begin, std::min(begin + grainSize, count));
+
+                    if (state->doneChunks.fetch_add(1) + 1 == chunkCount)
+                    {
+                        auto lock = std::scoped_lock{state->mutex};
+                        state->done.notify_all();
+                    }
+                }
+            };
+
+            auto const helperCount = std::min<size_t>(m_workers.size(), chunkCount - 1);
+            for (size_t i = 0; i < helperCount; ++i)
+            {
+                submit(runChunks, TaskPriority::High);
+            }
+
+            runChunks();
+
+            auto lock = std::unique_lock{state->mutex};
+            state->done.wait(lock, [&state, chunkCount]() { return state->doneChunks.load() == chunkCount; });
+        }
+
+    private:
+        auto workerLoop() -> void;
+        auto popTaskLocked() -> Task;
+
+        static constexpr size_t kPriorityCount = 3;
+
+        std::array<std::deque<Task>, kPriorityCount> m_queues{};
+        std::vector<std::thread> m_workers{};
+        std::mutex m_mutex{};
+        std::condition_variable m_taskAvailable{};
+        std::condition_variable m_idle{};
+        size_t m_queuedTasks{0};
+        size_t m_runningTasks{0};
+        bool m_stopping{false};
+    };
+} // namespace april::core
@@ -11,12 +11,12 @@ namespace april::core
     struct UUID
     {
         // Default constructor: Generates a new random v4 UUID.
+        // Generator state is per thread so assets can be created from worker threads.
         UUID()
             : m_uuid{}
         {
-            static std::random_device rd{};
-            static std::mt19937 gen{rd()};
-            static uuids::uuid_random_generator uuidGen(gen);
+            thread_local std::mt19937 gen{std::random_device{}()};
+            thread_local uuids::uuid_random_generator uuidGen(gen);
 
             m_uuid = uuidGen();
         }
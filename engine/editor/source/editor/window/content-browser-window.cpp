@@ -290,7 +290,7 @@ namespace april::editor
 
         // Textures
         if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" ||
-            ext == ".tga" || ext == ".dds" || ext == ".hdr" || ext == ".exr")
+            ext == ".tga" || ext == ".dds" || ext == ".ktx2" || ext == ".hdr" || ext == ".exr")
         {
             return ContentItemType::Texture;
         }
@@ -822,7 +822,7 @@ namespace april::editor
 
         if (auto* resources = Engine::get().getRenderResourceRegistry())
         {
-            meshRenderer.meshId = resources->registerMesh(item.physicalPath.string());
+            meshRenderer.meshId = resources->registerMeshAsync(item.physicalPath.string(), asset::LoadPriority::High);
         }
         meshRenderer.enabled = true;
         context.selection.entity = entity;
@@ -0,0 +1,37 @@
+// This file is part of the April Engine.
+
+#include "static-mesh.hpp"
+
+namespace april::graphics
+{
+    namespace
+    {
+        auto toResourceFormat(asset::VertexAttributeFormat format) -> ResourceFormat
+        {
+            switch (format)
+            {
+            case asset::VertexAttributeFormat::Float2: return ResourceFormat::RG32Float;
+            case asset::VertexAttributeFormat::Float3: return ResourceFormat::RGB32Float;
+            case asset::VertexAttributeFormat::Float4: return ResourceFormat::RGBA32Float;
+            case asset::VertexAttributeFormat::Half2: return ResourceFormat::RG16Float;
+            case asset::VertexAttributeFormat::Unorm16x4: return ResourceFormat::RGBA16Unorm;
+            case asset::VertexAttributeFormat::Snorm16x2: return ResourceFormat::RG16Snorm;
+            }
+            return ResourceFormat::Unknown;
+        }
+    }
+
+    auto StaticMesh::createVertexLayout(uint32_t vertexFlags) -> core::ref<VertexLayout>
+    {
+        auto bufferLayout = VertexBufferLayout::create();
+        auto shaderLocation = uint32_t{0};
+        for (auto const& attribute : asset::getVertexAttributes(vertexFlags))
+        {
+            bufferLayout->addElement(attribute.semantic, attribute.offset, toResourceFormat(attribute.format), 1, shaderLocation++);
+        }
+
+        auto vertexLayout = VertexLayout::create();
+        vertexLayout->addBufferLayout(0, bufferLayout);
+        return vertexLayout;
+    }
+} // namespace april::graphics
@@ -6,8 +6,9 @@
 
 #include <asset/blob-header.hpp>
 #include <core/foundation/object.hpp>
-#include <vector>
+#include <algorithm>
 #include <array>
+#include <vector>
 
 namespace april::graphics
 {
@@ -49,11 +50,87 @@ namespace april::graphics
         [[nodiscard]] auto getBoundsMin() const -> std::array<float, 3> const& { return m_boundsMin; }
         [[nodiscard]] auto getBoundsMax() const -> std::array<float, 3> const& { return m_boundsMax; }
 
+        /**
+         * Vertex layout for the given MeshHeader flags, built from asset::getVertexAttributes().
+         * Attributes bind to shader locations in table order.
+         */
+        static auto createVertexLayout(uint32_t vertexFlags) -> core::ref<VertexLayout>;
+
+        /**
+         * Compact meshes store positions quantized inside the bounds; the vertex shader rebuilds them as
+         * offset + position * scale and decodes octahedral normals.
+         */
+        auto setCompactVertices(bool compact) -> void { m_compactVertices = compact; }
+        [[nodiscard]] auto hasCompactVertices() const -> bool { return m_compactVertices; }
+        [[nodiscard]] auto getPositionScale() const -> std::array<float, 3>
+        {
+            return {m_boundsMax[0] - m_boundsMin[0], m_boundsMax[1] - m_boundsMin[1], m_boundsMax[2] - m_boundsMin[2]};
+        }
+        [[nodiscard]] auto getPositionOffset() const -> std::array<float, 3> const& { return m_boundsMin; }
+
+        /**
+         * Attach simplified levels of detail.
+         * @param lodRanges (lodCount - 1) ranges per submesh, submesh-major, for LOD 1 and up.
+         * @param lodErrors Object-space error of each level, LOD 0 included. Must be non-decreasing.
+         */
+        auto setLods(std::vector<DrawRange> lodRanges, std::vector<float> lodErrors) -> void
+        {
+            m_lodRanges = std::move(lodRanges);
+            m_lodErrors = std::move(lodErrors);
+        }
+
+        [[nodiscard]] auto getLodCount() const -> uint32_t { return m_lodErrors.empty() ? 1u : static_cast<uint32_t>(m_lodErrors.size()); }
+        [[nodiscard]] auto getLodError(uint32_t lod) const -> float { return lod < m_lodErrors.size() ? m_lodErrors[lod] : 0.0f; }
+
+        /**
+         * Draw range of a submesh at the given level. Levels past the last one clamp to it.
+         */
+        [[nodiscard]] auto getSubmeshLod(size_t index, uint32_t lod) const -> DrawRange const&
+        {
+            auto const lodCount = getLodCount();
+            lod = std::min(lod, lodCount - 1);
+            if (lod == 0)
+            {
+                return m_submeshes[index];
+            }
+            return m_lodRanges[index * (lodCount - 1) + (lod - 1)];
+        }
+
+        /**
+         * Attach cook-time meshlets. The CPU copy serves reference culling and tooling; the buffers hold the same
+         * data as structured/raw buffers for GPU-driven passes.
+         */
+        auto setMeshlets(
+            std::vector<asset::Meshlet> meshlets,
+            core::ref<Buffer> meshletBuffer,
+            core::ref<Buffer> meshletVertexBuffer,
+            core::ref<Buffer> meshletTriangleBuffer
+        ) -> void
+        {
+            m_meshlets = std::move(meshlets);
+            mp_meshletBuffer = std::move(meshletBuffer);
+            mp_meshletVertexBuffer = std::move(meshletVertexBuffer);
+            mp_meshletTriangleBuffer = std::move(meshletTriangleBuffer);
+        }
+
+        [[nodiscard]] auto hasMeshlets() const -> bool { return !m_meshlets.empty(); }
+        [[nodiscard]] auto getMeshlets() const -> std::vector<asset::Meshlet> const& { return m_meshlets; }
+        [[nodiscard]] auto getMeshletBuffer() const -> core::ref<Buffer> const& { return mp_meshletBuffer; }
+        [[nodiscard]] auto getMeshletVertexBuffer() const -> core::ref<Buffer> const& { return mp_meshletVertexBuffer; }
+        [[nodiscard]] auto getMeshletTriangleBuffer() const -> core::ref<Buffer> const& { return mp_meshletTriangleBuffer; }
+
     private:
         core::ref<VertexArrayObject> mp_vao{};
         std::vector<DrawRange> m_submeshes{};
+        std::vector<DrawRange> m_lodRanges{};
+        std::vector<float> m_lodErrors{};
+        std::vector<asset::Meshlet> m_meshlets{};
+        core::ref<Buffer> mp_meshletBuffer{};
+        core::ref<Buffer> mp_meshletVertexBuffer{};
+        core::ref<Buffer> mp_meshletTriangleBuffer{};
         std::array<float, 3> m_boundsMin{};
         std::array<float, 3> m_boundsMax{};
+        bool m_compactVertices{false};
     };
 
 } // namespace april::graphics
@@ -24,6 +24,7 @@
 #include <core/math/math.hpp>
 #include <slang-rhi/shader-cursor.h>
 #include <slang-rhi.h>
+#include <cstring>
 #include <ranges>
 
 namespace april::graphics
@@ -916,6 +917,91 @@ namespace april::graphics
         updateTextureSubresources(texture, 0, subresourceCount, data);
     }
 
+    auto CommandContext::uploadTextureMips(Texture const* texture, std::span<std::byte const> data, uint32_t mipCount) -> bool
+    {
+        // D3D12 requires texture copy sources to start on a 512-byte boundary; other backends accept it too.
+        constexpr size_t kPlacementAlignment = 512;
+
+        struct MipCopy
+        {
+            size_t srcOffset{0};
+            size_t stagingOffset{0};
+            size_t rowSize{0};
+            size_t rowPitch{0};
+            uint32_t rowCount{0};
+            rhi::Extent3D extent{};
+        };
+
+        mipCount = std::min(mipCount, texture->getMipCount());
+        auto const formatInfo = rhi::getFormatInfo(getGFXFormat(texture->getFormat()));
+        auto const rowAlignment = mp_device->getTextureRowAlignment();
+
+        auto copies = std::vector<MipCopy>(mipCount);
+        auto srcSize = size_t{0};
+        auto stagingSize = size_t{0};
+        for (uint32_t mip = 0; mip < mipCount; ++mip)
+        {
+            auto& copy = copies[mip];
+            auto const width = (uint32_t)align_up(texture->getWidth(mip), (size_t)formatInfo.blockWidth);
+            auto const height = (uint32_t)align_up(texture->getHeight(mip), (size_t)formatInfo.blockHeight);
+
+            copy.rowSize = size_t(width / formatInfo.blockWidth) * formatInfo.blockSizeInBytes;
+            copy.rowPitch = align_up(copy.rowSize, rowAlignment);
+            copy.rowCount = height / formatInfo.blockHeight;
+            copy.extent = {width, height, 1};
+            copy.srcOffset = srcSize;
+            copy.stagingOffset = align_up(stagingSize, kPlacementAlignment);
+
+            srcSize += copy.rowSize * copy.rowCount;
+            stagingSize = copy.stagingOffset + copy.rowPitch * copy.rowCount;
+        }
+
+        if (data.size() < srcSize)
+        {
+            AP_ERROR("CommandContext::uploadTextureMips() - data holds {} bytes, {} mips need {}.", data.size(), mipCount, srcSize);
+            return false;
+        }
+
+        auto const& uploadHeap = mp_device->getUploadHeap();
+        auto allocation = uploadHeap->allocate(stagingSize, kPlacementAlignment);
+        auto const* pSrc = reinterpret_cast<uint8_t const*>(data.data());
+        for (auto const& copy : copies)
+        {
+            if (copy.rowPitch == copy.rowSize)
+            {
+                std::memcpy(allocation.data + copy.stagingOffset, pSrc + copy.srcOffset, copy.rowSize * copy.rowCount);
+                continue;
+            }
+
+            for (uint32_t row = 0; row < copy.rowCount; ++row)
+            {
+                std::memcpy(allocation.data + copy.stagingOffset + row * copy.rowPitch, pSrc + copy.srcOffset + row * copy.rowSize, copy.rowSize);
+            }
+        }
+
+        resourceBarrier(texture, Resource::State::CopyDest);
+        for (uint32_t mip = 0; mip < mipCount; ++mip)
+        {
+            auto const& copy = copies[mip];
+            m_gfxEncoder->copyBufferToTexture(
+                texture->getGfxTextureResource(),
+                0,
+                mip,
+                {0, 0, 0},
+                allocation.gfxBuffer,
+                allocation.offset + copy.stagingOffset,
+                copy.rowPitch * copy.rowCount,
+                copy.rowPitch,
+                copy.extent
+            );
+        }
+        m_commandsPending = true;
+
+        // Deferred until the frame fence passes, so the copies above can still read the staging memory.
+        uploadHeap->release(allocation);
+        return true;
+    }
+
     auto CommandContext::updateBuffer(Buffer const* buffer, void const* data, size_t offset, size_t numBytes) -> void
     {
         if (numBytes == 0)
@@ -18,6 +18,8 @@
 #include <core/math/type.hpp>
 #include <slang-rhi.h>
 #include <slang-com-ptr.h>
+#include <cstddef>
+#include <span>
 #include <string_view>
 
 namespace april::core { class Profiler; }
@@ -387,6 +389,14 @@ namespace april::graphics
         ) -> void;
 
         auto updateTextureData(Texture const* texture, void const* data) -> void;
+
+        /**
+         * Upload the first mipCount levels of array slice 0 from tightly packed data (mip 0 first, block rows for
+         * compressed formats). All levels are staged in one upload-heap allocation with rows re-pitched to the
+         * device row alignment, then copied with one copy per level.
+         * @return False if the data is smaller than the mip chain.
+         */
+        auto uploadTextureMips(Texture const* texture, std::span<std::byte const> data, uint32_t mipCount) -> bool;
         auto updateBuffer(Buffer const* buffer, void const* data, size_t offset = 0, size_t numBytes = 0) -> void;
         auto readBuffer(Buffer const* buffer, void* data, size_t offset = 0, size_t numBytes = 0) -> void;
 
@@ -569,6 +569,22 @@ namespace april::graphics
                 return ResourceFormat::RGBA8Unorm;
             case asset::PixelFormat::RGBA8UnormSrgb:
                 return ResourceFormat::RGBA8UnormSrgb;
+            case asset::PixelFormat::BC1Unorm:
+                return ResourceFormat::BC1Unorm;
+            case asset::PixelFormat::BC1UnormSrgb:
+                return ResourceFormat::BC1UnormSrgb;
+            case asset::PixelFormat::BC3Unorm:
+                return ResourceFormat::BC3Unorm;
+            case asset::PixelFormat::BC3UnormSrgb:
+                return ResourceFormat::BC3UnormSrgb;
+            case asset::PixelFormat::BC4Unorm:
+                return ResourceFormat::BC4Unorm;
+            case asset::PixelFormat::BC5Unorm:
+                return ResourceFormat::BC5Unorm;
+            case asset::PixelFormat::BC7Unorm:
+                return ResourceFormat::BC7Unorm;
+            case asset::PixelFormat::BC7UnormSrgb:
+                return ResourceFormat::BC7UnormSrgb;
             default:
                 return ResourceFormat::Unknown;
             }
@@ -592,40 +608,62 @@ namespace april::graphics
             return nullptr;
         }
 
+        return createTextureFromPayload(payload, asset.getSourcePath(), usage, generateMips);
+    }
+
+    auto Device::createTextureFromPayload(
+        asset::TexturePayload const& payload,
+        std::string const& sourcePath,
+        TextureUsage usage,
+        bool generateMips
+    ) -> core::ref<Texture>
+    {
         auto const& header = payload.header;
 
         // Convert asset format to graphics format
         auto format = convertAssetFormat(header.format);
         if (format == ResourceFormat::Unknown)
         {
-            AP_ERROR("[Device] Unknown texture format for asset: {}", asset.getSourcePath());
+            AP_ERROR("[Device] Unknown texture format for asset: {}", sourcePath);
             return nullptr;
         }
 
-        // Determine mip levels (note: texture init data currently uploads only one subresource).
-        auto mipLevels = 1u;
-        if (generateMips && header.mipLevels > 1)
-        {
-            AP_WARN("[Device] Mip upload not supported yet; using base mip only for {}", asset.getSourcePath());
-        }
+        // Cooked mips are uploaded as-is. Assets cooked without mips get their chain generated on the GPU,
+        // which needs render-target views and therefore an uncompressed format.
+        auto const cookedMips = std::max(header.mipLevels, 1u);
+        auto const gpuMips = generateMips && cookedMips == 1 && !isCompressedFormat(format);
+        auto const uploadMips = generateMips ? cookedMips : 1u;
+        auto const textureUsage = gpuMips ? usage | TextureUsage::RenderTarget : usage;
 
-        // Create the texture with initial data
         auto texture = createTexture2D(
             header.width,
             header.height,
             format,
             1, // arraySize
-            mipLevels,
-            payload.pixelData.data(),
-            usage
+            gpuMips ? Resource::kMaxPossible : uploadMips,
+            nullptr,
+            textureUsage
         );
 
         if (texture)
         {
-            texture->setSourcePath(asset.getSourcePath());
+            auto* p_context = getCommandContext();
+            if (!p_context->uploadTextureMips(texture.get(), payload.pixelData, uploadMips))
+            {
+                AP_ERROR("[Device] Texture data is truncated for asset: {}", sourcePath);
+                return nullptr;
+            }
+
+            if (gpuMips)
+            {
+                texture->generateMips(p_context);
+            }
+            p_context->resourceBarrier(texture.get(), Resource::State::ShaderResource);
+
+            texture->setSourcePath(sourcePath);
 
             AP_INFO("[Device] Created texture from asset: {}x{} {} ({})",
-                    header.width, header.height, to_string(format), asset.getSourcePath());
+                    header.width, header.height, to_string(format), sourcePath);
         }
 
         return texture;
@@ -646,18 +684,26 @@ namespace april::graphics
             return nullptr;
         }
 
+        return createMeshFromPayload(payload, asset.getSourcePath());
+    }
+
+    auto Device::createMeshFromPayload(
+        asset::MeshPayload const& payload,
+        std::string const& sourcePath
+    ) -> core::ref<StaticMesh>
+    {
         auto const& header = payload.header;
 
-        // Create vertex layout
-        // Standard format: position(3) + normal(3) + tangent(4) + texcoord(2) = 12 floats = 48 bytes
-        auto bufferLayout = VertexBufferLayout::create();
-        bufferLayout->addElement("POSITION", 0, ResourceFormat::RGB32Float, 1, 0);
-        bufferLayout->addElement("NORMAL", 12, ResourceFormat::RGB32Float, 1, 1);
-        bufferLayout->addElement("TANGENT", 24, ResourceFormat::RGBA32Float, 1, 2);
-        bufferLayout->addElement("TEXCOORD", 40, ResourceFormat::RG32Float, 1, 3);
+        // The header flags select the standard (48 byte) or compact (20 byte) layout.
+        auto const compactVertices = (header.flags & asset::VertexFlags::Compact) != 0;
+        auto const expectedStride = compactVertices ? asset::kCompactVertexStride : asset::kStandardVertexStride;
+        if (header.vertexStride != expectedStride)
+        {
+            AP_ERROR("[Device] Unexpected vertex stride {} (expected {}) for asset: {}", header.vertexStride, expectedStride, sourcePath);
+            return nullptr;
+        }
 
-        auto vertexLayout = VertexLayout::create();
-        vertexLayout->addBufferLayout(0, bufferLayout);
+        auto vertexLayout = StaticMesh::createVertexLayout(header.flags);
 
         // Create vertex buffer
         auto vertexBuffer = createBuffer(
@@ -669,7 +715,7 @@ namespace april::graphics
 
         if (!vertexBuffer)
         {
-            AP_ERROR("[Device] Failed to create vertex buffer for asset: {}", asset.getSourcePath());
+            AP_ERROR("[Device] Failed to create vertex buffer for asset: {}", sourcePath);
             return nullptr;
         }
 
@@ -684,7 +730,7 @@ namespace april::graphics
 
         if (!indexBuffer)
         {
-            AP_ERROR("[Device] Failed to create index buffer for asset: {}", asset.getSourcePath());
+            AP_ERROR("[Device] Failed to create index buffer for asset: {}", sourcePath);
             return nullptr;
         }
 
@@ -699,7 +745,7 @@ namespace april::graphics
 
         if (!vao)
         {
-            AP_ERROR("[Device] Failed to create VAO for asset: {}", asset.getSourcePath());
+            AP_ERROR("[Device] Failed to create VAO for asset: {}", sourcePath);
             return nullptr;
         }
 
@@ -722,9 +768,70 @@ namespace april::graphics
             std::array<float, 3>{header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]},
             std::array<float, 3>{header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]}
         );
+        mesh->setCompactVertices(compactVertices);
+
+        auto const lodCount = std::max(header.lodCount, 1u);
+        if (lodCount > 1 && payload.lods.size() == payload.submeshes.size() * (lodCount - 1))
+        {
+            // One error per level: the worst submesh decides when the whole mesh may switch.
+            auto lodRanges = std::vector<StaticMesh::DrawRange>{};
+            auto lodErrors = std::vector<float>(lodCount, 0.0f);
+            lodRanges.reserve(payload.lods.size());
+            for (size_t i = 0; i < payload.lods.size(); ++i)
+            {
+                auto const& lod = payload.lods[i];
+                auto const level = static_cast<uint32_t>(i % (lodCount - 1)) + 1;
+                lodRanges.push_back({lod.indexOffset, lod.indexCount, payload.submeshes[i / (lodCount - 1)].materialIndex});
+                lodErrors[level] = std::max(lodErrors[level], lod.error);
+            }
+
+            for (uint32_t level = 1; level < lodCount; ++level)
+            {
+                lodErrors[level] = std::max(lodErrors[level], lodErrors[level - 1]);
+            }
+
+            mesh->setLods(std::move(lodRanges), std::move(lodErrors));
+        }
+
+        if (!payload.meshlets.empty())
+        {
+            auto meshletBuffer = createBuffer(
+                payload.meshlets.size_bytes(),
+                BufferUsage::ShaderResource,
+                MemoryType::DeviceLocal,
+                payload.meshlets.data()
+            );
+            auto meshletVertexBuffer = createBuffer(
+                payload.meshletVertices.size_bytes(),
+                BufferUsage::ShaderResource,
+                MemoryType::DeviceLocal,
+                payload.meshletVertices.data()
+            );
+            auto meshletTriangleBuffer = createBuffer(
+                payload.meshletTriangles.size_bytes(),
+                BufferUsage::ShaderResource,
+                MemoryType::DeviceLocal,
+                payload.meshletTriangles.data()
+            );
+
+            if (meshletBuffer && meshletVertexBuffer && meshletTriangleBuffer)
+            {
+                mesh->setMeshlets(
+                    std::vector<asset::Meshlet>{payload.meshlets.begin(), payload.meshlets.end()},
+                    std::move(meshletBuffer),
+                    std::move(meshletVertexBuffer),
+                    std::move(meshletTriangleBuffer)
+                );
+            }
+            else
+            {
+                AP_WARN("[Device] Failed to create meshlet buffers for asset: {}", sourcePath);
+            }
+        }
 
-        AP_INFO("[Device] Created mesh from asset: {} vertices, {} indices, {} submeshes ({})",
-                header.vertexCount, header.indexCount, header.submeshCount, asset.getSourcePath());
+        AP_INFO("[Device] Created mesh from asset: {} vertices, {} indices, {} submeshes, {} LODs, {} meshlets ({})",
+                header.vertexCount, header.indexCount, header.submeshCount, mesh->getLodCount(),
+                mesh->getMeshlets().size(), sourcePath);
 
         return mesh;
     }
@@ -355,6 +355,26 @@ namespace april::graphics
             asset::StaticMeshAsset const& asset
         ) -> core::ref<StaticMesh>;
 
+        /**
+         * Create a 2D texture from an already fetched payload (e.g. prefetched by an async load).
+         * @param sourcePath Used for debug naming and logging only.
+         */
+        auto createTextureFromPayload(
+            asset::TexturePayload const& payload,
+            std::string const& sourcePath,
+            TextureUsage usage = TextureUsage::ShaderResource,
+            bool generateMips = true
+        ) -> core::ref<Texture>;
+
+        /**
+         * Create a static mesh from an already fetched payload.
+         * @param sourcePath Used for logging only.
+         */
+        auto createMeshFromPayload(
+            asset::MeshPayload const& payload,
+            std::string const& sourcePath
+        ) -> core::ref<StaticMesh>;
+
         /**
          * Create a new graphics heap.
          */
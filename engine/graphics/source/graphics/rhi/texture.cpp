@@ -172,8 +172,9 @@ namespace april::graphics
             if (pInitData)
             {
                 initData.data = pInitData;
-                initData.rowPitch = (uint64_t)m_width * getFormatBytesPerBlock(m_format);
-                initData.slicePitch = initData.rowPitch * m_height;
+                // Pitches are in blocks so block-compressed formats are laid out correctly.
+                initData.rowPitch = (uint64_t)(desc.size.width / getFormatWidthCompressionRatio(m_format)) * getFormatBytesPerBlock(m_format);
+                initData.slicePitch = initData.rowPitch * (desc.size.height / getFormatHeightCompressionRatio(m_format));
                 pDataPtr = &initData;
             }
 
@@ -414,8 +415,19 @@ namespace april::graphics
             {
                 auto srv = getSRV(m, 1, a, 1);
                 auto rtv = getRTV(m + 1, a, 1);
-                // TODO:
-                // pContext->blit(srv, rtv);
+
+                auto const srcInfo = srv->getViewInfo();
+                auto const dstInfo = rtv->getViewInfo();
+                pContext->resourceBarrier(this, Resource::State::ShaderResource, &srcInfo);
+                pContext->resourceBarrier(this, Resource::State::RenderTarget, &dstInfo);
+
+                auto colorTargets = ColorTargets{};
+                colorTargets.emplace_back(rtv, LoadOp::DontCare, StoreOp::Store);
+                if (auto p_renderPass = pContext->beginRenderPass(colorTargets))
+                {
+                    p_renderPass->blit(srv, rtv, RenderPassEncoder::kMaxRect, RenderPassEncoder::kMaxRect, TextureFilteringMode::Linear);
+                    p_renderPass->end();
+                }
             }
         }
 
@@ -111,6 +111,12 @@ namespace april
             );
         }
 
+        if (m_renderer)
+        {
+            // Frame boundary: swap in resources whose async loads finished since the last frame.
+            m_renderer->getResourceRegistry().processPendingLoads();
+        }
+
         if (m_renderer && m_sceneGraph)
         {
             auto& snapshot = m_renderer->acquireSnapshotForWrite();
@@ -269,7 +275,16 @@ namespace april
         m_context = m_device->getCommandContext();
 
         // Create asset manager
-        m_assetManager = std::make_unique<asset::AssetManager>(m_config.assetRoot, m_config.ddcRoot);
+        m_assetManager = std::make_unique<asset::AssetManager>(m_config.assetRoot, m_config.ddcRoot, m_config.bundlePath);
+        m_assetManager->setHotReloadSettings({.enabled = m_config.hotReload});
+        if (!m_config.usageManifest.empty())
+        {
+            if (auto manifest = asset::AssetUsageManifest{}; manifest.load(m_config.usageManifest))
+            {
+                m_assetManager->prefetchUsage(manifest);
+            }
+            m_assetManager->startUsageRecording();
+        }
 
         // Create scene graph
         m_sceneGraph = std::make_unique<scene::SceneGraph>();
@@ -301,6 +316,11 @@ namespace april
             m_hooks.onShutdown();
         }
 
+        if (m_assetManager && m_assetManager->isRecordingUsage())
+        {
+            m_assetManager->stopUsageRecording().save(m_config.usageManifest);
+        }
+
         m_swapchain.reset();
         m_offscreen.reset();
         m_device.reset();
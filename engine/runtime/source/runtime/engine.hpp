@@ -28,6 +28,9 @@ namespace april
         float4 clearColor{0.1f, 0.1f, 0.1f, 1.0f};
         std::filesystem::path assetRoot{"content"};
         std::filesystem::path ddcRoot{"build/cache/DDC"};
+        std::filesystem::path bundlePath{};     // Cooked bundle from april-cook; empty loads from source assets
+        bool hotReload{false};                  // Recook changed sources and swap them into the running scene
+        std::filesystem::path usageManifest{};  // Asset usage of the last run, next to the scene; prefetched at startup and rewritten on shutdown
     };
 
     struct EngineHooks
@@ -1,7 +1,15 @@
 #include "ecs-core.hpp"
 
+#include <atomic>
+
 namespace april::scene
 {
+    auto detail::nextComponentTypeId() -> uint32_t
+    {
+        static std::atomic<uint32_t> s_nextId{0};
+        return s_nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
     auto operator==(Entity lhs, Entity rhs) -> bool
     {
         return lhs.index == rhs.index && lhs.generation == rhs.generation;
@@ -51,9 +59,12 @@ namespace april::scene
             return;
         }
 
-        for (auto& [type, pool] : m_pools)
+        for (auto& pool : m_pools)
         {
-            pool->remove(e);
+            if (pool)
+            {
+                pool->remove(e);
+            }
         }
 
         ++m_generation[e.index];
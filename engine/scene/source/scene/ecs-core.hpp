@@ -2,9 +2,7 @@
 
 #include <cstdint>
 #include <vector>
-#include <unordered_map>
 #include <memory>
-#include <typeindex>
 #include <utility>
 #include <cassert>
 #include <tuple>
@@ -60,22 +58,17 @@ namespace april::scene
         {
             assert(!isNull(entity) && "Cannot emplace component on NullEntity");
 
-            auto const index = static_cast<size_t>(entity.index);
-
-            // Ensure sparse array is large enough
-            if (index >= m_entityToDense.size())
-            {
-                m_entityToDense.resize(index + 1, kInvalidIndex);
-            }
+            auto& slot = getOrCreateSlot(entity.index);
 
             // Entity shouldn't already have this component
-            assert(m_entityToDense[index] == kInvalidIndex && "Entity already has this component");
+            assert(slot == kInvalidIndex && "Entity already has this component");
+            assert(m_data.size() < kInvalidIndex && "SparseSet dense index overflow");
 
             // Add to dense arrays
-            auto const denseIndex = m_data.size();
+            auto const denseIndex = static_cast<uint32_t>(m_data.size());
             m_data.emplace_back(std::forward<Args>(args)...);
             m_denseToEntity.push_back(entity);
-            m_entityToDense[index] = denseIndex;
+            slot = denseIndex;
 
             return m_data.back();
         }
@@ -88,9 +81,9 @@ namespace april::scene
                 return; // Entity doesn't have this component
             }
 
-            auto const index = static_cast<size_t>(entity.index);
-            auto const denseIndex = m_entityToDense[index];
-            auto const lastIndex = m_data.size() - 1;
+            auto& slot = *findSlot(entity.index);
+            auto const denseIndex = slot;
+            auto const lastIndex = static_cast<uint32_t>(m_data.size() - 1);
 
             if (denseIndex != lastIndex)
             {
@@ -98,26 +91,26 @@ namespace april::scene
                 m_data[denseIndex] = std::move(m_data[lastIndex]);
                 auto const movedEntity = m_denseToEntity[lastIndex];
                 m_denseToEntity[denseIndex] = movedEntity;
-                m_entityToDense[movedEntity.index] = denseIndex;
+                *findSlot(movedEntity.index) = denseIndex;
             }
 
             // Remove last element
             m_data.pop_back();
             m_denseToEntity.pop_back();
-            m_entityToDense[index] = kInvalidIndex;
+            slot = kInvalidIndex;
         }
 
         // Get component reference
         auto get(Entity entity) -> T&
         {
             assert(contains(entity));
-            return m_data[m_entityToDense[entity.index]];
+            return m_data[*findSlot(entity.index)];
         }
 
         auto get(Entity entity) const -> T const&
         {
             assert(contains(entity));
-            return m_data[m_entityToDense[entity.index]];
+            return m_data[*findSlot(entity.index)];
         }
 
         // Check if entity has this component
@@ -128,19 +121,13 @@ namespace april::scene
                 return false;
             }
 
-            auto const index = static_cast<size_t>(entity.index);
-            if (index >= m_entityToDense.size())
+            auto const* slot = findSlot(entity.index);
+            if (slot == nullptr || *slot == kInvalidIndex)
             {
                 return false;
             }
 
-            auto const denseIndex = m_entityToDense[index];
-            if (denseIndex == kInvalidIndex)
-            {
-                return false;
-            }
-
-            return m_denseToEntity[denseIndex] == entity;
+            return m_denseToEntity[*slot] == entity;
         }
 
         // Direct access to dense component array
@@ -155,22 +142,74 @@ namespace april::scene
             return m_denseToEntity[denseIndex];
         }
 
-        // Iterator support
+        // Bytes held by the sparse side: the page table plus every allocated page
+        auto sparseBytes() const -> size_t
+        {
+            auto const pageCount = std::ranges::count_if(m_sparsePages, [](auto const& page) { return page != nullptr; });
+            return m_sparsePages.capacity() * sizeof(SparsePage) + static_cast<size_t>(pageCount) * kPageSize * sizeof(uint32_t);
+        }
+
+        // Iterator support. Iteration walks only the dense arrays and never reads the sparse pages,
+        // so disjoint ranges of data() can be processed on separate threads without sharing anything.
         auto begin() { return m_data.begin(); }
         auto end() { return m_data.end(); }
         auto begin() const { return m_data.begin(); }
         auto end() const { return m_data.end(); }
 
     private:
-        static constexpr size_t kInvalidIndex = std::numeric_limits<size_t>::max();
+        static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t kPageShift = 10;
+        static constexpr uint32_t kPageSize = 1u << kPageShift; // Entries per page; 4 KiB of dense indices
+
+        using SparsePage = std::unique_ptr<uint32_t[]>;
+
+        // Slot of entity index in the sparse array, or nullptr if its page was never allocated
+        auto findSlot(uint32_t index) const -> uint32_t const*
+        {
+            auto const page = index >> kPageShift;
+            return page < m_sparsePages.size() && m_sparsePages[page] ? &m_sparsePages[page][index & (kPageSize - 1)] : nullptr;
+        }
+
+        auto findSlot(uint32_t index) -> uint32_t*
+        {
+            return const_cast<uint32_t*>(static_cast<SparseSet const*>(this)->findSlot(index));
+        }
 
-        std::vector<T> m_data;               // Dense array of components
-        std::vector<Entity> m_denseToEntity; // Map dense index -> Entity
-        std::vector<size_t> m_entityToDense; // Map Entity index -> dense index (sparse array)
+        auto getOrCreateSlot(uint32_t index) -> uint32_t&
+        {
+            auto const page = index >> kPageShift;
+            if (page >= m_sparsePages.size())
+            {
+                m_sparsePages.resize(page + 1);
+            }
+
+            auto& entries = m_sparsePages[page];
+            if (!entries)
+            {
+                entries = std::make_unique_for_overwrite<uint32_t[]>(kPageSize);
+                std::fill_n(entries.get(), kPageSize, kInvalidIndex);
+            }
+            return entries[index & (kPageSize - 1)];
+        }
+
+        std::vector<T> m_data;                  // Dense array of components
+        std::vector<Entity> m_denseToEntity;    // Map dense index -> Entity
+        std::vector<SparsePage> m_sparsePages;  // Map Entity index -> dense index, paged; pages are allocated on first use
     };
 
     namespace detail
     {
+        // Hands out the next dense component type ID. Defined out of line so every translation unit shares one counter.
+        [[nodiscard]] auto nextComponentTypeId() -> uint32_t;
+
+        // Dense ID of component type T, assigned the first time T is used with any Registry
+        template<typename T>
+        auto componentTypeId() -> uint32_t
+        {
+            static auto const id = nextComponentTypeId();
+            return id;
+        }
+
         template<typename T>
         using SparseSetType = SparseSet<std::remove_const_t<T>>;
 
@@ -538,9 +577,8 @@ namespace april::scene
         template<typename T>
         auto getPool() const -> SparseSet<std::remove_const_t<T>> const*
         {
-            auto const typeIndex = std::type_index{typeid(std::remove_const_t<T>)};
-            auto it = m_pools.find(typeIndex);
-            return it != m_pools.end() ? static_cast<SparseSet<std::remove_const_t<T>> const*>(it->second.get()) : nullptr;
+            auto const typeId = detail::componentTypeId<std::remove_const_t<T>>();
+            return typeId < m_pools.size() ? static_cast<SparseSet<std::remove_const_t<T>> const*>(m_pools[typeId].get()) : nullptr;
         }
 
         template<typename T>
@@ -560,10 +598,15 @@ namespace april::scene
                 return pool;
             }
 
-            auto const typeIndex = std::type_index{typeid(std::remove_const_t<T>)};
+            auto const typeId = detail::componentTypeId<std::remove_const_t<T>>();
+            if (typeId >= m_pools.size())
+            {
+                m_pools.resize(typeId + 1);
+            }
+
             auto newPool = std::make_unique<SparseSet<std::remove_const_t<T>>>();
             auto* poolPtr = newPool.get();
-            m_pools[typeIndex] = std::move(newPool);
+            m_pools[typeId] = std::move(newPool);
             return poolPtr;
         }
 
@@ -580,7 +623,7 @@ namespace april::scene
             return getEmptyPoolMutable<T>();
         }
 
-        std::unordered_map<std::type_index, std::unique_ptr<ISparseSet>> m_pools;
+        std::vector<std::unique_ptr<ISparseSet>> m_pools; // Indexed by component type ID; null for types this registry has not seen
         std::vector<uint32_t> m_generation{};
         std::vector<uint32_t> m_freeIndices{};
     };
@@ -0,0 +1,97 @@
+#include "prefab.hpp"
+#include "components.hpp"
+
+#include <core/log/logger.hpp>
+
+#include <glm/gtx/euler_angles.hpp>
+
+namespace april::scene
+{
+    namespace
+    {
+        // Split a node matrix into the translation / XYZ Euler / scale form TransformComponent composes.
+        auto applyLocalMatrix(TransformComponent& transform, float4x4 const& matrix) -> void
+        {
+            auto scale = float3{
+                glm::length(float3{matrix[0]}),
+                glm::length(float3{matrix[1]}),
+                glm::length(float3{matrix[2]})
+            };
+            if (glm::determinant(float3x3{matrix}) < 0.0f)
+            {
+                scale.x = -scale.x;
+            }
+
+            auto rotation = float4x4{1.0f};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (scale[axis] != 0.0f)
+                {
+                    rotation[axis] = float4{float3{matrix[axis]} / scale[axis], 0.0f};
+                }
+            }
+
+            transform.localPosition = float3{matrix[3]};
+            glm::extractEulerAngleXYZ(rotation, transform.localRotation.x, transform.localRotation.y, transform.localRotation.z);
+            transform.localScale = scale;
+            transform.isDirty = true;
+        }
+    }
+
+    auto instantiatePrefab(
+        SceneGraph& graph,
+        RenderResourceRegistry& resources,
+        asset::AssetManager& assetManager,
+        asset::SceneAsset const& prefab,
+        Entity parent,
+        bool asyncMeshes
+    ) -> std::vector<Entity>
+    {
+        auto meshIds = std::vector<RenderID>(prefab.m_meshes.size(), kInvalidRenderID);
+        for (size_t i = 0; i < prefab.m_meshes.size(); ++i)
+        {
+            if (prefab.getInstanceCount(static_cast<int32_t>(i)) == 0)
+            {
+                continue;
+            }
+
+            auto meshAsset = assetManager.getAsset<asset::StaticMeshAsset>(prefab.m_meshes[i].guid);
+            if (!meshAsset)
+            {
+                AP_WARN("[Prefab] Missing mesh {} of prefab {}", prefab.m_meshes[i].guid.toString(), prefab.getAssetPath());
+                continue;
+            }
+
+            meshIds[i] = asyncMeshes ? resources.registerMeshAsync(meshAsset->getAssetPath())
+                                     : resources.registerMesh(meshAsset->getAssetPath());
+        }
+
+        auto& registry = graph.getRegistry();
+        auto entities = std::vector<Entity>{};
+        entities.reserve(prefab.m_nodes.size());
+        for (auto const& node : prefab.m_nodes)
+        {
+            auto const entity = graph.createEntity(node.name);
+            applyLocalMatrix(registry.get<TransformComponent>(entity), node.localMatrix);
+
+            // Nodes are parents-first, so the parent entity already exists.
+            auto const nodeParent = node.parent >= 0 ? entities[static_cast<size_t>(node.parent)] : parent;
+            if (nodeParent != NullEntity)
+            {
+                graph.setParent(entity, nodeParent);
+            }
+
+            if (node.mesh >= 0 && meshIds[static_cast<size_t>(node.mesh)] != kInvalidRenderID)
+            {
+                auto& meshRenderer = registry.emplace<MeshRendererComponent>(entity);
+                meshRenderer.meshId = meshIds[static_cast<size_t>(node.mesh)];
+            }
+
+            graph.markTransformDirty(entity);
+            entities.push_back(entity);
+        }
+
+        AP_INFO("[Prefab] Instantiated {}: {} entities", prefab.getAssetPath(), entities.size());
+        return entities;
+    }
+} // namespace april::scene
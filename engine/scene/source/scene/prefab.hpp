@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ecs-core.hpp"
+#include "scene-graph.hpp"
+#include "renderer/render-resource-registry.hpp"
+
+#include <asset/asset-manager.hpp>
+#include <asset/scene-asset.hpp>
+
+namespace april::scene
+{
+    /**
+     * Spawn an imported SceneAsset (e.g. a multi-mesh glTF) into the graph.
+     * Every node becomes an entity parented like in the source; mesh nodes get a MeshRendererComponent.
+     * Each distinct mesh is registered once, so nodes sharing a source mesh render the same RenderID.
+     * @param parent Entity the prefab roots are attached to, NullEntity for scene roots.
+     * @param asyncMeshes Register meshes through registerMeshAsync (placeholder until loaded).
+     * @return Entities in SceneAsset::m_nodes order.
+     */
+    auto instantiatePrefab(
+        SceneGraph& graph,
+        RenderResourceRegistry& resources,
+        asset::AssetManager& assetManager,
+        asset::SceneAsset const& prefab,
+        Entity parent = NullEntity,
+        bool asyncMeshes = false
+    ) -> std::vector<Entity>;
+} // namespace april::scene
@@ -1,5 +1,6 @@
 #include "render-extraction.hpp"
 
+#include <algorithm>
 #include <limits>
 
 namespace april::scene
@@ -38,6 +39,49 @@ namespace april::scene
             return AABB{worldMin, worldMax};
         }
 
+        // Largest on-screen geometric deviation, in pixels, a simplified level may introduce.
+        constexpr auto kLodPixelErrorThreshold = 1.0f;
+
+        /**
+         * Pick the coarsest level whose object-space error, scaled by the instance transform and projected at the
+         * distance of the nearest point of its bounds, stays under kLodPixelErrorThreshold.
+         */
+        auto selectLod(graphics::StaticMesh const& mesh, float4x4 const& worldMatrix, AABB const& worldBounds, ViewSnapshot const& view) -> uint32_t
+        {
+            auto const lodCount = mesh.getLodCount();
+            if (lodCount <= 1 || !view.hasCamera || view.viewportHeight <= 0.0f)
+            {
+                return 0;
+            }
+
+            auto const worldScale = std::max({
+                glm::length(float3{worldMatrix[0]}),
+                glm::length(float3{worldMatrix[1]}),
+                glm::length(float3{worldMatrix[2]})
+            });
+
+            // projection[1][1] is cot(fov / 2) for perspective and 2 / height for orthographic projections.
+            auto pixelsPerUnit = view.projectionMatrix[1][1] * view.viewportHeight * 0.5f;
+            if (view.isPerspective)
+            {
+                auto const nearest = glm::clamp(view.cameraPosition, worldBounds.min, worldBounds.max);
+                auto const distance = glm::length(nearest - view.cameraPosition);
+                if (distance <= 0.0f)
+                {
+                    return 0;
+                }
+                pixelsPerUnit /= distance;
+            }
+
+            auto lod = 0u;
+            while (lod + 1 < lodCount &&
+                   mesh.getLodError(lod + 1) * worldScale * std::abs(pixelsPerUnit) <= kLodPixelErrorThreshold)
+            {
+                ++lod;
+            }
+            return lod;
+        }
+
         auto findActiveCamera(Registry& registry) -> Entity
         {
             auto const* cameraPool = registry.getPool<CameraComponent>();
@@ -90,6 +134,8 @@ namespace april::scene
             snapshot.mainView.viewMatrix = camera.viewMatrix;
             snapshot.mainView.projectionMatrix = camera.projectionMatrix;
             snapshot.mainView.cameraPosition = getCameraPosition(registry, cameraEntity);
+            snapshot.mainView.viewportHeight = static_cast<float>(camera.viewportHeight);
+            snapshot.mainView.isPerspective = camera.isPerspective;
             snapshot.mainView.hasCamera = true;
         }
 
@@ -112,11 +158,16 @@ namespace april::scene
             instance.meshId = mesh.meshId;
             instance.materialId = mesh.materialId;
 
-            float3 boundsMin{};
-            float3 boundsMax{};
-            if (resources.getMeshBounds(mesh.meshId, boundsMin, boundsMax))
+            if (auto const meshResource = resources.getMesh(mesh.meshId))
             {
-                instance.worldBounds = computeWorldAabb(transform.worldMatrix, boundsMin, boundsMax);
+                auto const& boundsMin = meshResource->getBoundsMin();
+                auto const& boundsMax = meshResource->getBoundsMax();
+                instance.worldBounds = computeWorldAabb(
+                    transform.worldMatrix,
+                    float3{boundsMin[0], boundsMin[1], boundsMin[2]},
+                    float3{boundsMax[0], boundsMax[1], boundsMax[2]}
+                );
+                instance.lodIndex = selectLod(*meshResource, transform.worldMatrix, instance.worldBounds, snapshot.mainView);
             }
 
             snapshot.dynamicMeshes.push_back(instance);
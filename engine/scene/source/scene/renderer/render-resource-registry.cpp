@@ -1,19 +1,97 @@
 #include "render-resource-registry.hpp"
 
 #include <asset/texture-asset.hpp>
-#include <filesystem>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 
 namespace april::scene
 {
+    namespace
+    {
+        auto constexpr kFloatsPerVertex = asset::kStandardVertexStride / sizeof(float);
+
+        // Unit cube in the standard 48-byte vertex layout: position(3) normal(3) tangent(4) texcoord(2).
+        auto buildPlaceholderCube(std::vector<float>& vertices, std::vector<uint16_t>& indices) -> void
+        {
+            struct Face
+            {
+                std::array<float, 3> normal;
+                std::array<float, 3> tangent;
+                std::array<float, 3> bitangent;
+            };
+
+            auto constexpr faces = std::array<Face, 6>{{
+                {{ 1.f,  0.f,  0.f}, { 0.f,  0.f, -1.f}, {0.f, 1.f,  0.f}},
+                {{-1.f,  0.f,  0.f}, { 0.f,  0.f,  1.f}, {0.f, 1.f,  0.f}},
+                {{ 0.f,  1.f,  0.f}, { 1.f,  0.f,  0.f}, {0.f, 0.f, -1.f}},
+                {{ 0.f, -1.f,  0.f}, { 1.f,  0.f,  0.f}, {0.f, 0.f,  1.f}},
+                {{ 0.f,  0.f,  1.f}, { 1.f,  0.f,  0.f}, {0.f, 1.f,  0.f}},
+                {{ 0.f,  0.f, -1.f}, {-1.f,  0.f,  0.f}, {0.f, 1.f,  0.f}},
+            }};
+            auto constexpr corners = std::array<std::array<float, 2>, 4>{{{-1.f, -1.f}, {1.f, -1.f}, {1.f, 1.f}, {-1.f, 1.f}}};
+
+            for (auto const& face : faces)
+            {
+                auto const base = static_cast<uint16_t>(vertices.size() / kFloatsPerVertex);
+                for (auto const& corner : corners)
+                {
+                    for (size_t axis = 0; axis < 3; ++axis)
+                    {
+                        vertices.push_back(0.5f * (face.normal[axis] + corner[0] * face.tangent[axis] + corner[1] * face.bitangent[axis]));
+                    }
+                    vertices.insert(vertices.end(), face.normal.begin(), face.normal.end());
+                    vertices.insert(vertices.end(), face.tangent.begin(), face.tangent.end());
+                    vertices.push_back(1.f);
+                    vertices.push_back(0.5f * (corner[0] + 1.f));
+                    vertices.push_back(0.5f * (1.f - corner[1]));
+                }
+
+                indices.insert(indices.end(), {
+                    base, static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 2),
+                    base, static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 3)
+                });
+            }
+        }
+
+        auto getMeshGpuBytes(graphics::StaticMesh const& mesh) -> uint64_t
+        {
+            auto bytes = uint64_t{0};
+            auto addBuffer = [&](core::ref<graphics::Buffer> const& buffer) -> void {
+                if (buffer)
+                {
+                    bytes += buffer->getSize();
+                }
+            };
+
+            if (auto const& vao = mesh.getVAO())
+            {
+                for (uint32_t i = 0; i < vao->getVertexBuffersCount(); ++i)
+                {
+                    addBuffer(vao->getVertexBuffer(i));
+                }
+                addBuffer(vao->getIndexBuffer());
+            }
+            addBuffer(mesh.getMeshletBuffer());
+            addBuffer(mesh.getMeshletVertexBuffer());
+            addBuffer(mesh.getMeshletTriangleBuffer());
+            return bytes;
+        }
+    }
+
     RenderResourceRegistry::RenderResourceRegistry(core::ref<graphics::Device> device, asset::AssetManager* assetManager)
         : m_device(std::move(device))
         , m_assetManager(assetManager)
+        , m_textureStreamer(m_device, assetManager)
     {
         // Reserve slot 0 for invalid
         m_meshes.resize(1);
         m_meshMaterialIds.resize(1);
+        m_meshResidency.resize(1);
         m_materials.resize(1);
         m_materialBufferIndices.resize(1, 0);
+        m_materialTextureGuids.resize(1);
 
         // Create material system
         if (m_device)
@@ -23,17 +101,79 @@ namespace april::scene
             // Reserve GPU material slot 0 as a deterministic fallback.
             auto defaultMaterial = core::make_ref<graphics::StandardMaterial>();
             m_defaultMaterialBufferIndex = m_materialSystem->addMaterial(defaultMaterial);
+
+            createPlaceholders();
+        }
+    }
+
+    RenderResourceRegistry::~RenderResourceRegistry()
+    {
+        // Cancelled requests never invoke their callbacks, so nothing captures a dangling this.
+        for (auto const& [id, handle] : m_pendingMeshLoads)
+        {
+            handle->cancel();
+        }
+    }
+
+    auto RenderResourceRegistry::createPlaceholders() -> void
+    {
+        auto vertices = std::vector<float>{};
+        auto indices = std::vector<uint16_t>{};
+        buildPlaceholderCube(vertices, indices);
+
+        auto submesh = asset::Submesh{0, static_cast<uint32_t>(indices.size()), 0};
+
+        auto payload = asset::MeshPayload{};
+        payload.header.vertexCount = static_cast<uint32_t>(vertices.size() / kFloatsPerVertex);
+        payload.header.indexCount = static_cast<uint32_t>(indices.size());
+        payload.header.vertexStride = asset::kStandardVertexStride;
+        payload.header.indexFormat = 0;
+        payload.header.submeshCount = 1;
+        payload.header.vertexDataSize = vertices.size() * sizeof(float);
+        payload.header.indexDataSize = indices.size() * sizeof(uint16_t);
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            payload.header.boundsMin[axis] = -0.5f;
+            payload.header.boundsMax[axis] = 0.5f;
+        }
+        payload.submeshes = std::span<asset::Submesh const>{&submesh, 1};
+        payload.vertexData = std::as_bytes(std::span{vertices});
+        payload.indexData = std::as_bytes(std::span{indices});
+
+        m_placeholderMesh = m_device->createMeshFromPayload(payload, "<placeholder>");
+
+        auto constexpr whitePixel = uint32_t{0xFFFFFFFF};
+        m_placeholderTexture = m_device->createTexture2D(
+            1, 1,
+            graphics::ResourceFormat::RGBA8Unorm,
+            1, 1,
+            &whitePixel,
+            graphics::TextureUsage::ShaderResource
+        );
+        if (m_placeholderTexture)
+        {
+            m_placeholderTexture->setName("RenderResourceRegistry.Placeholder");
         }
     }
 
     auto RenderResourceRegistry::setDevice(core::ref<graphics::Device> device) -> void
     {
         m_device = std::move(device);
+        m_textureStreamer.setDevice(m_device);
+
+        // Placeholders belong to the device that created them; loads started from now on bind to the new ones.
+        m_placeholderMesh = {};
+        m_placeholderTexture = {};
+        if (m_device)
+        {
+            createPlaceholders();
+        }
     }
 
     auto RenderResourceRegistry::setAssetManager(asset::AssetManager* assetManager) -> void
     {
         m_assetManager = assetManager;
+        m_textureStreamer.setAssetManager(assetManager);
     }
 
     auto RenderResourceRegistry::registerMesh(std::string const& assetPath) -> RenderID
@@ -50,16 +190,8 @@ namespace april::scene
         }
 
         core::ref<graphics::StaticMesh> mesh{};
-        std::shared_ptr<asset::StaticMeshAsset> meshAsset{};
-        if (std::filesystem::exists(assetPath))
-        {
-            meshAsset = m_assetManager->loadAsset<asset::StaticMeshAsset>(assetPath);
-        }
-        else
-        {
-            AP_ERROR("[RenderResourceRegistry] Mesh asset not found: {}", assetPath);
-        }
-
+        // The asset manager resolves the path against loose files or the bundle and reports what it can't find.
+        auto const meshAsset = m_assetManager->loadAsset<asset::StaticMeshAsset>(assetPath);
         if (!meshAsset)
         {
             AP_ERROR("[RenderResourceRegistry] Failed to load mesh asset: {}", assetPath);
@@ -73,65 +205,340 @@ namespace april::scene
             auto const id = existing->second;
             if (id < m_meshMaterialIds.size() && m_meshMaterialIds[id].empty())
             {
-                auto const slotCount = meshAsset->m_materialSlots.size();
-                m_meshMaterialIds[id].resize(slotCount, kInvalidRenderID);
-                for (size_t i = 0; i < slotCount; ++i)
-                {
-                    auto const& slot = meshAsset->m_materialSlots[i];
-                    if (slot.materialRef.guid.getNative().is_nil())
-                    {
-                        continue;
-                    }
+                assignMeshMaterials(id, *meshAsset);
+            }
 
-                    auto materialAsset = m_assetManager->getAsset<asset::MaterialAsset>(slot.materialRef.guid);
-                    auto materialId = registerMaterialAsset(materialAsset);
-                    m_meshMaterialIds[id][i] = materialId;
+            // Evicted meshes come back here synchronously; a pending reload finishes on its own.
+            if (m_meshResidency[id].evicted && !m_pendingMeshLoads.contains(id))
+            {
+                if (auto reloaded = m_device->createMeshFromAsset(*m_assetManager, *meshAsset))
+                {
+                    setMeshResident(id, reloaded);
                 }
             }
 
+            m_meshIdsByPath.emplace(assetPath, id);
             return id;
         }
 
-        mesh = m_device->createMeshFromAsset(*m_assetManager, *meshAsset);
-        if (mesh)
+        // A different asset with the same cooked data draws the buffers already on the GPU.
+        auto const owner = findSharedMesh(m_assetManager->getCookedContentHash(meshGuid).value_or(std::string{}));
+        if (owner == kInvalidRenderID)
         {
-            AP_INFO("[RenderResourceRegistry] Loaded mesh: {} ({} submeshes)", assetPath, mesh->getSubmeshCount());
+            mesh = m_device->createMeshFromAsset(*m_assetManager, *meshAsset);
+            if (mesh)
+            {
+                AP_INFO("[RenderResourceRegistry] Loaded mesh: {} ({} submeshes)", assetPath, mesh->getSubmeshCount());
+            }
+            else
+            {
+                AP_ERROR("[RenderResourceRegistry] Failed to create mesh from asset: {}", assetPath);
+            }
+
+            if (!mesh)
+            {
+                return kInvalidRenderID;
+            }
+        }
+
+        auto const id = static_cast<RenderID>(m_meshes.size());
+        m_meshes.emplace_back();
+        m_meshMaterialIds.emplace_back();
+        m_meshResidency.push_back({.assetPath = assetPath, .lastUsedFrame = m_residencyFrame});
+        if (owner != kInvalidRenderID)
+        {
+            shareMesh(id, owner);
         }
         else
         {
-            AP_ERROR("[RenderResourceRegistry] Failed to create mesh from asset: {}", assetPath);
+            setMeshResident(id, mesh);
+            setMeshContent(id, m_assetManager->getCookedContentHash(meshGuid).value_or(std::string{}));
         }
+        m_meshIdsByGuid[meshGuid] = id;
+        m_meshIdsByPath.emplace(assetPath, id);
+        assignMeshMaterials(id, *meshAsset);
 
-        if (!mesh)
+        return id;
+    }
+
+    auto RenderResourceRegistry::registerMeshAsync(std::string const& assetPath, asset::LoadPriority priority) -> RenderID
+    {
+        if (assetPath.empty())
         {
             return kInvalidRenderID;
         }
 
+        if (!m_device || !m_assetManager)
+        {
+            AP_WARN("[RenderResourceRegistry] Missing device or asset manager; cannot load mesh: {}", assetPath);
+            return kInvalidRenderID;
+        }
+
+        if (auto existing = m_meshIdsByPath.find(assetPath); existing != m_meshIdsByPath.end())
+        {
+            return existing->second;
+        }
+
         auto const id = static_cast<RenderID>(m_meshes.size());
-        m_meshes.push_back(mesh);
+        m_meshes.emplace_back();
         m_meshMaterialIds.emplace_back();
-        m_meshIdsByGuid[meshGuid] = id;
+        m_meshResidency.push_back({.assetPath = assetPath, .lastUsedFrame = m_residencyFrame});
+        m_meshIdsByPath[assetPath] = id;
+
+        requestMeshLoad(id, assetPath, priority);
+        return id;
+    }
+
+    auto RenderResourceRegistry::requestMeshLoad(RenderID id, std::string const& assetPath, asset::LoadPriority priority) -> void
+    {
+        // A reloaded mesh keeps drawing until its replacement arrives; empty slots show the placeholder.
+        if (!m_meshes[id])
+        {
+            m_meshes[id] = m_placeholderMesh;
+        }
+        m_pendingMeshLoads[id] = m_assetManager->loadAssetAsync<asset::StaticMeshAsset>(
+            assetPath,
+            priority,
+            [this, id](asset::AssetLoadRequest& request) { onMeshLoaded(id, request); }
+        );
+    }
+
+    auto RenderResourceRegistry::setMeshResident(RenderID id, core::ref<graphics::StaticMesh> mesh) -> void
+    {
+        auto& residency = m_meshResidency[id];
+        if (!residency.evicted)
+        {
+            m_residentMeshBytes -= residency.bytes;
+        }
+
+        residency.bytes = mesh ? getMeshGpuBytes(*mesh) : 0;
+        residency.evicted = false;
+        m_residentMeshBytes += residency.bytes;
+
+        for (size_t alias = 1; alias < m_meshResidency.size(); ++alias)
+        {
+            if (m_meshResidency[alias].aliasOf == id)
+            {
+                m_meshes[alias] = mesh;
+            }
+        }
+        m_meshes[id] = std::move(mesh);
+    }
+
+    auto RenderResourceRegistry::findSharedMesh(std::string const& contentHash) const -> RenderID
+    {
+        if (contentHash.empty())
+        {
+            return kInvalidRenderID;
+        }
+
+        auto const it = m_meshIdsByContent.find(contentHash);
+        if (it == m_meshIdsByContent.end())
+        {
+            return kInvalidRenderID;
+        }
+
+        // Only share buffers that are on the GPU; an evicted owner is replaced by whoever loads next.
+        auto const owner = it->second;
+        auto const& residency = m_meshResidency[owner];
+        if (residency.evicted || residency.aliasOf != kInvalidRenderID || !m_meshes[owner] || m_meshes[owner] == m_placeholderMesh)
+        {
+            return kInvalidRenderID;
+        }
+        return owner;
+    }
+
+    auto RenderResourceRegistry::shareMesh(RenderID id, RenderID owner) -> void
+    {
+        setMeshContent(id, {});
 
-        if (meshAsset)
+        auto& residency = m_meshResidency[id];
+        if (!residency.evicted)
         {
-            auto const slotCount = meshAsset->m_materialSlots.size();
-            m_meshMaterialIds[id].resize(slotCount, kInvalidRenderID);
+            m_residentMeshBytes -= residency.bytes;
+        }
+        residency.bytes = 0;
+        residency.evicted = false;
+        residency.aliasOf = owner;
+        residency.sharedContent = true;
 
-            for (size_t i = 0; i < slotCount; ++i)
+        // Aliases are one level deep, so whatever followed this RenderID follows the owner now.
+        for (size_t alias = 1; alias < m_meshResidency.size(); ++alias)
+        {
+            if (m_meshResidency[alias].aliasOf == id)
             {
-                auto const& slot = meshAsset->m_materialSlots[i];
-                if (slot.materialRef.guid.getNative().is_nil())
+                m_meshResidency[alias].aliasOf = owner;
+                m_meshes[alias] = m_meshes[owner];
+            }
+        }
+        m_meshes[id] = m_meshes[owner];
+    }
+
+    auto RenderResourceRegistry::setMeshContent(RenderID id, std::string contentHash) -> void
+    {
+        auto& residency = m_meshResidency[id];
+        if (auto const it = m_meshIdsByContent.find(residency.contentHash); it != m_meshIdsByContent.end() && it->second == id)
+        {
+            m_meshIdsByContent.erase(it);
+        }
+
+        residency.contentHash = std::move(contentHash);
+        if (!residency.contentHash.empty())
+        {
+            m_meshIdsByContent[residency.contentHash] = id;
+        }
+    }
+
+    auto RenderResourceRegistry::processPendingLoads() -> void
+    {
+        if (!m_assetManager)
+        {
+            return;
+        }
+
+        m_assetManager->pollSourceChanges();
+        m_assetManager->processCompletedLoads();
+        applyAssetReloads();
+    }
+
+    auto RenderResourceRegistry::applyAssetReloads() -> void
+    {
+        for (auto const& guid : m_assetManager->takeReloadedAssets())
+        {
+            if (auto it = m_meshIdsByGuid.find(guid); it != m_meshIdsByGuid.end())
+            {
+                // Evicted meshes reload from the new cook when next used; pending loads already read it.
+                auto const id = it->second;
+                auto const& residency = m_meshResidency[id];
+                if (!residency.evicted && !residency.assetPath.empty() && !m_pendingMeshLoads.contains(id))
                 {
-                    continue;
+                    requestMeshLoad(id, residency.assetPath, asset::LoadPriority::High);
                 }
 
-                auto materialAsset = m_assetManager->getAsset<asset::MaterialAsset>(slot.materialRef.guid);
-                auto materialId = registerMaterialAsset(materialAsset);
-                m_meshMaterialIds[id][i] = materialId;
+                // Assets that only shared the old cook's content load their own copy, and may not join it again.
+                setMeshContent(id, {});
+                for (size_t alias = 1; alias < m_meshResidency.size(); ++alias)
+                {
+                    auto& aliasResidency = m_meshResidency[alias];
+                    if (aliasResidency.aliasOf != id || !aliasResidency.sharedContent)
+                    {
+                        continue;
+                    }
+
+                    aliasResidency.aliasOf = kInvalidRenderID;
+                    aliasResidency.sharedContent = false;
+                    if (!aliasResidency.assetPath.empty() && !m_pendingMeshLoads.contains(static_cast<RenderID>(alias)))
+                    {
+                        requestMeshLoad(static_cast<RenderID>(alias), aliasResidency.assetPath, asset::LoadPriority::High);
+                    }
+                }
+            }
+
+            if (auto it = m_materialIdsByGuid.find(guid); it != m_materialIdsByGuid.end())
+            {
+                if (auto materialAsset = m_assetManager->getAsset<asset::MaterialAsset>(guid))
+                {
+                    reloadMaterial(it->second, *materialAsset);
+                }
             }
+
+            m_textureStreamer.reloadTexture(guid);
         }
+    }
 
-        return id;
+    auto RenderResourceRegistry::reloadMaterial(RenderID id, asset::MaterialAsset const& materialAsset) -> void
+    {
+        // A new material object in the same GPU slot; the RenderID and buffer index stay put.
+        auto material = graphics::StandardMaterial::createFromAsset(m_device, materialAsset);
+        if (!material)
+        {
+            AP_ERROR("[RenderResourceRegistry] Failed to reload material: {}", materialAsset.getAssetPath());
+            return;
+        }
+
+        if (auto previous = core::dynamic_ref_cast<graphics::StandardMaterial>(m_materials[id]))
+        {
+            m_textureStreamer.unbindMaterial(previous);
+        }
+
+        m_materialTextureGuids[id] = loadMaterialTextures(material, materialAsset.textures);
+        m_materialSystem->replaceMaterial(m_materialBufferIndices[id], material);
+        m_materials[id] = material;
+        AP_INFO("[RenderResourceRegistry] Reloaded material: {}", materialAsset.getAssetPath());
+    }
+
+    auto RenderResourceRegistry::onMeshLoaded(RenderID id, asset::AssetLoadRequest& request) -> void
+    {
+        m_pendingMeshLoads.erase(id);
+
+        // Failed meshes stay empty and are not retried by residency updates.
+        auto fail = [&]() -> void {
+            setMeshResident(id, nullptr);
+            m_meshResidency[id].assetPath.clear();
+        };
+
+        auto meshAsset = request.getAssetAs<asset::StaticMeshAsset>();
+        if (request.getState() != asset::LoadState::Ready || !meshAsset)
+        {
+            AP_ERROR("[RenderResourceRegistry] Async mesh load failed: {}", request.getAssetPath().string());
+            fail();
+            return;
+        }
+
+        // The same asset may already be resident through another path or a synchronous load.
+        auto const meshGuid = meshAsset->getHandle();
+        if (auto existing = m_meshIdsByGuid.find(meshGuid); existing != m_meshIdsByGuid.end() && existing->second != id)
+        {
+            auto const owner = existing->second;
+            m_meshResidency[id].aliasOf = owner;
+            m_meshes[id] = m_meshes[owner];
+            m_meshMaterialIds[id] = m_meshMaterialIds[owner];
+            return;
+        }
+
+        if (auto const owner = findSharedMesh(request.getContentHash()); owner != kInvalidRenderID && owner != id)
+        {
+            shareMesh(id, owner);
+            m_meshIdsByGuid[meshGuid] = id;
+            assignMeshMaterials(id, *meshAsset);
+            return;
+        }
+
+        auto mesh = m_device->createMeshFromPayload(request.getMeshPayload(), meshAsset->getSourcePath());
+        if (!mesh)
+        {
+            AP_ERROR("[RenderResourceRegistry] Failed to create mesh from asset: {}", request.getAssetPath().string());
+            fail();
+            return;
+        }
+
+        AP_INFO("[RenderResourceRegistry] Loaded mesh: {} ({} submeshes)", request.getAssetPath().string(), mesh->getSubmeshCount());
+
+        m_meshResidency[id].aliasOf = kInvalidRenderID;
+        m_meshResidency[id].sharedContent = false;
+        setMeshResident(id, mesh);
+        setMeshContent(id, request.getContentHash());
+        m_meshIdsByGuid[meshGuid] = id;
+        assignMeshMaterials(id, *meshAsset);
+    }
+
+    auto RenderResourceRegistry::assignMeshMaterials(RenderID id, asset::StaticMeshAsset const& meshAsset) -> void
+    {
+        auto const slotCount = meshAsset.m_materialSlots.size();
+        m_meshMaterialIds[id].assign(slotCount, kInvalidRenderID);
+
+        for (size_t i = 0; i < slotCount; ++i)
+        {
+            auto const& slot = meshAsset.m_materialSlots[i];
+            if (slot.materialRef.guid.getNative().is_nil())
+            {
+                continue;
+            }
+
+            auto materialAsset = m_assetManager->getAsset<asset::MaterialAsset>(slot.materialRef.guid);
+            auto materialId = registerMaterialAsset(materialAsset);
+            m_meshMaterialIds[id][i] = materialId;
+        }
     }
 
     auto RenderResourceRegistry::getMesh(RenderID id) const -> core::ref<graphics::StaticMesh>
@@ -192,16 +599,7 @@ namespace april::scene
             return kInvalidRenderID;
         }
 
-        std::shared_ptr<asset::MaterialAsset> materialAsset{};
-        if (std::filesystem::exists(assetPath))
-        {
-            materialAsset = m_assetManager->loadAsset<asset::MaterialAsset>(assetPath);
-        }
-        else
-        {
-            AP_ERROR("[RenderResourceRegistry] Material asset not found: {}", assetPath);
-        }
-
+        auto const materialAsset = m_assetManager->loadAsset<asset::MaterialAsset>(assetPath);
         if (!materialAsset)
         {
             AP_ERROR("[RenderResourceRegistry] Failed to load material asset: {}", assetPath);
@@ -247,15 +645,17 @@ namespace april::scene
             return kInvalidRenderID;
         }
 
+        auto textureGuids = std::vector<core::UUID>{};
         if (auto standard = core::dynamic_ref_cast<graphics::StandardMaterial>(material))
         {
-            loadMaterialTextures(standard, materialAsset->textures);
+            textureGuids = loadMaterialTextures(standard, materialAsset->textures);
         }
         auto const materialBufferIndex = m_materialSystem->addMaterial(material);
 
         auto const id = static_cast<RenderID>(m_materials.size());
         m_materials.push_back(material);
         m_materialBufferIndices.push_back(materialBufferIndex);
+        m_materialTextureGuids.push_back(std::move(textureGuids));
         if (!assetGuid.getNative().is_nil())
         {
             m_materialIdsByGuid[assetGuid] = id;
@@ -322,47 +722,203 @@ namespace april::scene
     auto RenderResourceRegistry::loadMaterialTextures(
         core::ref<graphics::StandardMaterial> material,
         asset::MaterialTextures const& textures
-    ) -> void
+    ) -> std::vector<core::UUID>
     {
+        auto guids = std::vector<core::UUID>{};
         if (!material || !m_device || !m_assetManager)
         {
-            return;
+            return guids;
         }
 
-        auto loadTexture = [&](std::optional<asset::TextureReference> const& ref) -> core::ref<graphics::Texture> {
+        using TextureSlot = graphics::Material::TextureSlot;
+
+        auto bindTexture = [&](std::optional<asset::TextureReference> const& ref, TextureSlot slot) -> void {
             if (!ref.has_value() || ref->asset.guid.getNative().is_nil())
             {
-                return nullptr;
+                return;
             }
 
-            auto const& guid = ref->asset.guid;
-
-            if (auto existing = m_texturesByGuid.find(guid); existing != m_texturesByGuid.end())
+            // Normal maps stay unbound until loaded; a flat normal is equivalent to no map.
+            auto const placeholder = slot != TextureSlot::Normal ? m_placeholderTexture : core::ref<graphics::Texture>{};
+            if (m_textureStreamer.bindTexture(ref->asset.guid, material, slot, placeholder))
             {
-                return existing->second;
+                guids.push_back(ref->asset.guid);
             }
+        };
+
+        bindTexture(textures.baseColorTexture, TextureSlot::BaseColor);
+        bindTexture(textures.metallicRoughnessTexture, TextureSlot::Specular);
+        bindTexture(textures.normalTexture, TextureSlot::Normal);
+        bindTexture(textures.emissiveTexture, TextureSlot::Emissive);
+        return guids;
+    }
+
+    auto RenderResourceRegistry::updateTextureStreaming(FrameSnapshot const& snapshot) -> void
+    {
+        auto const frame = ++m_streamingFrame;
+        auto const& view = snapshot.mainView;
 
-            auto textureAsset = m_assetManager->getAsset<asset::TextureAsset>(guid);
-            if (!textureAsset)
+        // Pixels per world unit at distance 1: half the viewport over tan(fovY / 2) for perspective views.
+        auto const focal = view.projectionMatrix[1][1] * view.viewportHeight * 0.5f;
+
+        auto requestMaterial = [&](RenderID materialId, float projectedSize) -> void {
+            if (materialId == kInvalidRenderID || materialId >= m_materialTextureGuids.size())
             {
-                AP_WARN("[RenderResourceRegistry] Failed to load texture asset by GUID: {}", guid.toString());
-                return nullptr;
+                return;
             }
+            for (auto const& guid : m_materialTextureGuids[materialId])
+            {
+                m_textureStreamer.requestProjectedSize(guid, projectedSize, frame);
+            }
+        };
 
-            auto texture = m_device->createTextureFromAsset(*m_assetManager, *textureAsset);
-            if (!texture)
+        auto requestInstances = [&](std::vector<MeshInstance> const& instances) -> void {
+            for (auto const& instance : instances)
             {
-                AP_WARN("[RenderResourceRegistry] Failed to create texture from asset: {}", guid.toString());
-                return nullptr;
+                auto const center = (instance.worldBounds.min + instance.worldBounds.max) * 0.5f;
+                auto const radius = glm::length(instance.worldBounds.max - instance.worldBounds.min) * 0.5f;
+                auto const distance = glm::length(center - view.cameraPosition);
+
+                // Assumes the texture spans the object once; inside the bounds everything wants mip 0.
+                auto projectedSize = std::numeric_limits<float>::max();
+                if (!view.isPerspective)
+                {
+                    projectedSize = 2.0f * radius * focal;
+                }
+                else if (distance > radius)
+                {
+                    projectedSize = 2.0f * radius * focal / distance;
+                }
+
+                if (instance.materialId != kInvalidRenderID)
+                {
+                    requestMaterial(instance.materialId, projectedSize);
+                }
+                else if (instance.meshId != kInvalidRenderID && instance.meshId < m_meshMaterialIds.size())
+                {
+                    for (auto const materialId : m_meshMaterialIds[instance.meshId])
+                    {
+                        requestMaterial(materialId, projectedSize);
+                    }
+                }
             }
+        };
+
+        if (snapshot.mainView.hasCamera && view.viewportHeight > 0.0f)
+        {
+            requestInstances(snapshot.staticMeshes);
+            requestInstances(snapshot.dynamicMeshes);
+        }
+
+        m_textureStreamer.update(frame);
+    }
+
+    auto RenderResourceRegistry::updateMeshResidency(FrameSnapshot const& snapshot) -> void
+    {
+        auto const frame = ++m_residencyFrame;
 
-            m_texturesByGuid.emplace(guid, texture);
-            return texture;
+        auto markUsed = [&](std::vector<MeshInstance> const& instances) -> void {
+            for (auto const& instance : instances)
+            {
+                if (instance.meshId == kInvalidRenderID || instance.meshId >= m_meshResidency.size())
+                {
+                    continue;
+                }
+
+                auto const aliasOf = m_meshResidency[instance.meshId].aliasOf;
+                auto const id = aliasOf != kInvalidRenderID ? aliasOf : instance.meshId;
+                auto& residency = m_meshResidency[id];
+                residency.lastUsedFrame = frame;
+                if (residency.evicted && !residency.assetPath.empty() && m_assetManager && !m_pendingMeshLoads.contains(id))
+                {
+                    requestMeshLoad(id, residency.assetPath, asset::LoadPriority::High);
+                    for (size_t alias = 1; alias < m_meshResidency.size(); ++alias)
+                    {
+                        if (m_meshResidency[alias].aliasOf == id)
+                        {
+                            m_meshes[alias] = m_placeholderMesh;
+                        }
+                    }
+                }
+            }
         };
 
-        material->baseColorTexture = loadTexture(textures.baseColorTexture);
-        material->metallicRoughnessTexture = loadTexture(textures.metallicRoughnessTexture);
-        material->normalTexture = loadTexture(textures.normalTexture);
-        material->emissiveTexture = loadTexture(textures.emissiveTexture);
+        markUsed(snapshot.staticMeshes);
+        markUsed(snapshot.dynamicMeshes);
+
+        auto const& settings = m_meshResidencySettings;
+        if (m_residentMeshBytes <= settings.budgetBytes)
+        {
+            return;
+        }
+
+        // Least recently used first; anything drawn within the grace period stays.
+        auto candidates = std::vector<RenderID>{};
+        for (size_t id = 1; id < m_meshResidency.size(); ++id)
+        {
+            auto const& residency = m_meshResidency[id];
+            if (residency.evicted || residency.bytes == 0 || residency.aliasOf != kInvalidRenderID || residency.assetPath.empty())
+            {
+                continue;
+            }
+            if (frame - residency.lastUsedFrame < settings.evictAfterFrames || m_pendingMeshLoads.contains(static_cast<RenderID>(id)))
+            {
+                continue;
+            }
+            candidates.push_back(static_cast<RenderID>(id));
+        }
+
+        std::ranges::sort(candidates, [&](RenderID a, RenderID b) {
+            return m_meshResidency[a].lastUsedFrame < m_meshResidency[b].lastUsedFrame;
+        });
+
+        for (auto const id : candidates)
+        {
+            if (m_residentMeshBytes <= settings.budgetBytes)
+            {
+                break;
+            }
+
+            auto& residency = m_meshResidency[id];
+            m_residentMeshBytes -= residency.bytes;
+            residency.evicted = true;
+            ++m_meshEvictions;
+
+            m_meshes[id] = nullptr;
+            for (size_t alias = 1; alias < m_meshResidency.size(); ++alias)
+            {
+                if (m_meshResidency[alias].aliasOf == id)
+                {
+                    m_meshes[alias] = nullptr;
+                }
+            }
+        }
+    }
+
+    auto RenderResourceRegistry::getResidencyStats() const -> ResidencyStats
+    {
+        auto stats = ResidencyStats{};
+        stats.meshBytes = m_residentMeshBytes;
+        stats.meshEvictions = m_meshEvictions;
+        stats.textureBytes = m_textureStreamer.getResidentBytes();
+        stats.sharedTextures = m_textureStreamer.getSharedTextureCount();
+        for (size_t id = 1; id < m_meshResidency.size(); ++id)
+        {
+            auto const& residency = m_meshResidency[id];
+            if (residency.aliasOf != kInvalidRenderID)
+            {
+                stats.sharedMeshes += residency.sharedContent ? 1 : 0;
+                continue;
+            }
+            if (residency.evicted)
+            {
+                ++stats.evictedMeshes;
+            }
+            else if (m_meshes[id])
+            {
+                ++stats.residentMeshes;
+            }
+        }
+        return stats;
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "render-types.hpp"
+#include "texture-streamer.hpp"
 
+#include <asset/asset-load-request.hpp>
 #include <asset/asset-manager.hpp>
 #include <asset/material-asset.hpp>
 #include <asset/static-mesh-asset.hpp>
@@ -20,17 +22,72 @@
 
 namespace april::scene
 {
+    struct MeshResidencySettings
+    {
+        uint64_t budgetBytes{1ull << 30};  // GPU memory for mesh buffers
+        uint32_t evictAfterFrames{300};    // Meshes no instance used for this long may be evicted once over budget
+    };
+
+    struct ResidencyStats
+    {
+        uint64_t meshBytes{0};
+        size_t residentMeshes{0};
+        size_t evictedMeshes{0};
+        size_t sharedMeshes{0};     // Meshes drawing another asset's buffers because their cooked content matches
+        size_t sharedTextures{0};
+        uint64_t meshEvictions{0};
+        uint64_t textureBytes{0};
+    };
+
     class RenderResourceRegistry
     {
     public:
         RenderResourceRegistry() = default;
         RenderResourceRegistry(core::ref<graphics::Device> device, asset::AssetManager* assetManager);
+        ~RenderResourceRegistry();
 
         auto setDevice(core::ref<graphics::Device> device) -> void;
         auto setAssetManager(asset::AssetManager* assetManager) -> void;
 
         // Mesh API
         auto registerMesh(std::string const& assetPath) -> RenderID;
+
+        /**
+         * Returns a RenderID immediately, bound to a placeholder mesh until the asset
+         * finishes loading in the background. The real mesh is swapped in by processPendingLoads.
+         */
+        auto registerMeshAsync(
+            std::string const& assetPath,
+            asset::LoadPriority priority = asset::LoadPriority::Normal
+        ) -> RenderID;
+
+        /**
+         * Create GPU resources for finished async loads and swap in hot-reloaded assets, keeping their
+         * RenderIDs. Call once per frame on the render thread.
+         */
+        auto processPendingLoads() -> void;
+
+        /**
+         * Request texture mips for the instances in snapshot, sized by their projected bounds, and let the
+         * streamer queue loads and evictions. Call once per frame before rendering.
+         */
+        auto updateTextureStreaming(FrameSnapshot const& snapshot) -> void;
+
+        /**
+         * Mark the meshes used by snapshot, reload evicted ones it needs again and, while over budget,
+         * release the least recently used meshes no instance has referenced for a while. Their RenderIDs
+         * stay valid: the next frame that uses one again reloads it behind the placeholder.
+         */
+        auto updateMeshResidency(FrameSnapshot const& snapshot) -> void;
+
+        auto setMeshResidencySettings(MeshResidencySettings const& settings) -> void { m_meshResidencySettings = settings; }
+        [[nodiscard]] auto getMeshResidencySettings() const -> MeshResidencySettings const& { return m_meshResidencySettings; }
+        [[nodiscard]] auto getResidencyStats() const -> ResidencyStats;
+
+        [[nodiscard]] auto isMeshPending(RenderID id) const -> bool { return m_pendingMeshLoads.contains(id); }
+        [[nodiscard]] auto getPendingLoadCount() const -> size_t { return m_pendingMeshLoads.size() + m_textureStreamer.getPendingLoadCount(); }
+        [[nodiscard]] auto getTextureStreamer() -> TextureStreamer& { return m_textureStreamer; }
+
         auto getMesh(RenderID id) const -> core::ref<graphics::StaticMesh>;
         auto getMeshBounds(RenderID id, float3& outMin, float3& outMax) const -> bool;
         auto getMeshMaterialId(RenderID meshId, size_t slotIndex) const -> RenderID;
@@ -45,10 +102,22 @@ namespace april::scene
         auto getMaterialTypeName(RenderID id) const -> std::string;
 
     private:
+        auto createPlaceholders() -> void;
+        auto assignMeshMaterials(RenderID id, asset::StaticMeshAsset const& meshAsset) -> void;
+        auto onMeshLoaded(RenderID id, asset::AssetLoadRequest& request) -> void;
+        auto setMeshResident(RenderID id, core::ref<graphics::StaticMesh> mesh) -> void;
+        auto requestMeshLoad(RenderID id, std::string const& assetPath, asset::LoadPriority priority) -> void;
+        auto findSharedMesh(std::string const& contentHash) const -> RenderID;
+        auto shareMesh(RenderID id, RenderID owner) -> void;
+        auto setMeshContent(RenderID id, std::string contentHash) -> void;
+        auto applyAssetReloads() -> void;
+        auto reloadMaterial(RenderID id, asset::MaterialAsset const& materialAsset) -> void;
+
+        // Returns the GUIDs bound to the material, for streaming requests.
         auto loadMaterialTextures(
             core::ref<graphics::StandardMaterial> material,
             asset::MaterialTextures const& textures
-        ) -> void;
+        ) -> std::vector<core::UUID>;
 
         core::ref<graphics::Device> m_device{};
         asset::AssetManager* m_assetManager{};
@@ -57,13 +126,42 @@ namespace april::scene
         std::vector<core::ref<graphics::StaticMesh>> m_meshes{};
         std::vector<std::vector<RenderID>> m_meshMaterialIds{};
         std::unordered_map<core::UUID, RenderID> m_meshIdsByGuid{};
+        std::unordered_map<std::string, RenderID> m_meshIdsByPath{};
+        std::unordered_map<std::string, RenderID> m_meshIdsByContent{};  // Cooked content hash -> RenderID owning the buffers
+
+        // Async loading: placeholders stand in until processPendingLoads swaps the real resource
+        core::ref<graphics::StaticMesh> m_placeholderMesh{};
+        core::ref<graphics::Texture> m_placeholderTexture{};
+        std::unordered_map<RenderID, asset::AssetLoadHandle> m_pendingMeshLoads{};
+
+        // Mesh residency: GPU bytes and last use per RenderID, so unused meshes can be released under budget
+        struct MeshResidency
+        {
+            std::string assetPath{};
+            uint64_t bytes{0};
+            uint64_t lastUsedFrame{0};
+            std::string contentHash{};
+            RenderID aliasOf{kInvalidRenderID};  // Set when the RenderID shares another one's mesh
+            bool sharedContent{false};           // The alias is a different asset with identical cooked content
+            bool evicted{false};
+        };
+
+        MeshResidencySettings m_meshResidencySettings{};
+        std::vector<MeshResidency> m_meshResidency{};
+        uint64_t m_residentMeshBytes{0};
+        uint64_t m_meshEvictions{0};
+        uint64_t m_residencyFrame{0};
+
+        // Material textures are streamed: mip tails load on bind, finer mips follow on-screen size
+        TextureStreamer m_textureStreamer{};
+        std::vector<std::vector<core::UUID>> m_materialTextureGuids{};
+        uint64_t m_streamingFrame{0};
 
         // Material storage
         core::ref<graphics::MaterialSystem> m_materialSystem{};
         std::vector<core::ref<graphics::IMaterial>> m_materials{};
         std::vector<uint32_t> m_materialBufferIndices{};
         std::unordered_map<core::UUID, RenderID> m_materialIdsByGuid{};
-        std::unordered_map<core::UUID, core::ref<graphics::Texture>> m_texturesByGuid{};
         uint32_t m_defaultMaterialBufferIndex{0};
 
         auto registerMaterialAsset(std::shared_ptr<asset::MaterialAsset> const& materialAsset) -> RenderID;
@@ -22,6 +22,7 @@ namespace april::scene
         RenderID meshId{kInvalidRenderID};
         RenderID materialId{kInvalidRenderID};
         AABB worldBounds{};
+        uint32_t lodIndex{0};
     };
 
     struct LightInstance
@@ -37,6 +38,8 @@ namespace april::scene
         float4x4 viewMatrix{1.0f};
         float4x4 projectionMatrix{1.0f};
         float3 cameraPosition{0.0f, 0.0f, 0.0f};
+        float viewportHeight{0.0f};
+        bool isPerspective{true};
         bool hasCamera{false};
     };
 
@@ -19,15 +19,6 @@ namespace april::scene
         // Create default/fallback resources
         createDefaultResources();
 
-        auto bufferLayout = graphics::VertexBufferLayout::create();
-        bufferLayout->addElement("POSITION", 0, graphics::ResourceFormat::RGB32Float, 1, 0);
-        bufferLayout->addElement("NORMAL", 12, graphics::ResourceFormat::RGB32Float, 1, 1);
-        bufferLayout->addElement("TANGENT", 24, graphics::ResourceFormat::RGBA32Float, 1, 2);
-        bufferLayout->addElement("TEXCOORD", 40, graphics::ResourceFormat::RG32Float, 1, 3);
-
-        auto vertexLayout = graphics::VertexLayout::create();
-        vertexLayout->addBufferLayout(0, bufferLayout);
-
         // Create program from shader file
         graphics::ProgramDesc progDesc;
         progDesc.addShaderLibrary("graphics/scene/scene-mesh.slang");
@@ -74,7 +65,7 @@ namespace april::scene
 
         graphics::GraphicsPipelineDesc pipelineDesc;
         pipelineDesc.programKernels = m_program->getActiveVersion()->getKernels(m_device.get(), nullptr);
-        pipelineDesc.vertexLayout = vertexLayout;
+        pipelineDesc.vertexLayout = graphics::StaticMesh::createVertexLayout(0);
         pipelineDesc.renderTargetCount = 1;
         pipelineDesc.renderTargetFormats[0] = graphics::ResourceFormat::RGBA16Float;
         pipelineDesc.depthStencilFormat = graphics::ResourceFormat::D32Float;
@@ -90,6 +81,10 @@ namespace april::scene
         pipelineDesc.depthStencilState = graphics::DepthStencilState::create(dsDesc);
 
         m_pipeline = m_device->createGraphicsPipeline(pipelineDesc);
+
+        // Same program; the vertex shader dequantizes when perInstance.compactVertex is set.
+        pipelineDesc.vertexLayout = graphics::StaticMesh::createVertexLayout(asset::VertexFlags::Compact);
+        m_compactPipeline = m_device->createGraphicsPipeline(pipelineDesc);
     }
 
     auto SceneRenderer::createDefaultResources() -> void
@@ -191,6 +186,11 @@ namespace april::scene
         m_viewProjectionMatrix = snapshot.mainView.projectionMatrix * snapshot.mainView.viewMatrix;
         m_cameraPosition = snapshot.mainView.cameraPosition;
 
+        // Release meshes nothing has drawn for a while, then stream texture mips before the
+        // material buffers pick up swapped textures
+        m_resources.updateMeshResidency(snapshot);
+        m_resources.updateTextureStreaming(snapshot);
+
         // Update material GPU buffers
         auto* materialSystem = m_resources.getMaterialSystem();
         if (materialSystem)
@@ -273,8 +273,14 @@ namespace april::scene
                 // Set per-instance data
                 rootVar["perInstance"]["model"].setBlob(&instance.worldTransform, sizeof(float4x4));
 
+                auto const compactVertices = mesh->hasCompactVertices();
+                auto const positionScale = mesh->getPositionScale();
+                rootVar["perInstance"]["positionScale"].setBlob(positionScale.data(), sizeof(float3));
+                rootVar["perInstance"]["positionOffset"].setBlob(mesh->getPositionOffset().data(), sizeof(float3));
+                rootVar["perInstance"]["compactVertex"].set(compactVertices ? 1u : 0u);
+
                 encoder->setVao(mesh->getVAO());
-                encoder->bindPipeline(m_pipeline.get(), m_vars.get());
+                encoder->bindPipeline(compactVertices ? m_compactPipeline.get() : m_pipeline.get(), m_vars.get());
 
                 for (size_t s = 0; s < mesh->getSubmeshCount(); ++s)
                 {
@@ -324,7 +330,8 @@ namespace april::scene
                         );
                     }
 
-                    encoder->drawIndexed(submesh.indexCount, submesh.indexOffset, 0);
+                    auto const& range = mesh->getSubmeshLod(s, instance.lodIndex);
+                    encoder->drawIndexed(range.indexCount, range.indexOffset, 0);
                 }
             }
         };
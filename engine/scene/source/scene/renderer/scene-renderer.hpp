@@ -50,6 +50,7 @@ namespace april::scene
         core::ref<graphics::TextureView> m_sceneDepthDsv{};
         core::ref<graphics::TextureView> m_sceneColorSrv{};
         core::ref<graphics::GraphicsPipeline> m_pipeline{};
+        core::ref<graphics::GraphicsPipeline> m_compactPipeline{};
         core::ref<graphics::Program> m_program{};
         core::ref<graphics::ProgramVariables> m_vars{};
         RenderResourceRegistry m_resources{};
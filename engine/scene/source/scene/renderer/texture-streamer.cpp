@@ -0,0 +1,335 @@
+#include "texture-streamer.hpp"
+
+#include <asset/texture-asset.hpp>
+#include <core/log/logger.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace april::scene
+{
+    TextureStreamer::TextureStreamer(
+        core::ref<graphics::Device> device,
+        asset::AssetManager* assetManager,
+        asset::TextureStreamingSettings const& settings
+    )
+        : m_device{std::move(device)}
+        , m_assetManager{assetManager}
+        , m_planner{settings}
+    {}
+
+    TextureStreamer::~TextureStreamer()
+    {
+        // Cancelled requests never invoke their callbacks, so nothing captures a dangling this.
+        for (auto const& [guid, streamed] : m_textures)
+        {
+            if (streamed.pendingLoad)
+            {
+                streamed.pendingLoad->cancel();
+            }
+        }
+    }
+
+    auto TextureStreamer::bindTexture(
+        core::UUID const& guid,
+        core::ref<graphics::StandardMaterial> const& material,
+        graphics::Material::TextureSlot slot,
+        core::ref<graphics::Texture> const& placeholder
+    ) -> bool
+    {
+        if (!m_device || !m_assetManager || !material)
+        {
+            return false;
+        }
+
+        auto& streamed = m_textures[guid];
+        if (streamed.failed)
+        {
+            material->setTexture(slot, nullptr);
+            return false;
+        }
+
+        streamed.bindings.push_back({material, slot});
+        auto const& source = streamed.sharedWith ? m_textures.at(*streamed.sharedWith) : streamed;
+        if (source.texture)
+        {
+            material->setTexture(slot, source.texture);
+            return true;
+        }
+
+        if (placeholder)
+        {
+            material->setTexture(slot, placeholder);
+        }
+
+        if (streamed.pendingLoad || streamed.sharedWith)
+        {
+            return true;
+        }
+
+        // The mip tail comes first at normal priority; everything finer is streamed on demand.
+        if (!requestMips(guid, streamed, getSettings().mipTailSize, asset::LoadPriority::Normal))
+        {
+            AP_WARN("[TextureStreamer] Failed to load texture asset by GUID: {}", guid.toString());
+            streamed.bindings.clear();
+            streamed.failed = true;
+            material->setTexture(slot, nullptr);
+            return false;
+        }
+        return true;
+    }
+
+    auto TextureStreamer::unbindMaterial(core::ref<graphics::StandardMaterial> const& material) -> void
+    {
+        for (auto& [guid, streamed] : m_textures)
+        {
+            std::erase_if(streamed.bindings, [&](Binding const& binding) { return binding.material == material; });
+        }
+    }
+
+    auto TextureStreamer::reloadTexture(core::UUID const& guid) -> bool
+    {
+        auto const it = m_textures.find(guid);
+        if (it == m_textures.end() || !m_assetManager)
+        {
+            return false;
+        }
+
+        // The new cook may no longer match the texture this one shares, or the ones sharing it.
+        auto& streamed = it->second;
+        stopSharing(guid, streamed);
+
+        // Cancelled requests never invoke their callbacks, so the in-flight count is settled here.
+        if (streamed.pendingLoad)
+        {
+            streamed.pendingLoad->cancel();
+            streamed.pendingLoad.reset();
+            --m_pendingLoadCount;
+        }
+
+        // The new cook may have different dimensions, so residency starts over once its mip tail arrives.
+        if (streamed.storedHeader)
+        {
+            m_planner.removeTexture(guid);
+            streamed.storedHeader.reset();
+        }
+        streamed.failed = false;
+
+        if (!requestMips(guid, streamed, getSettings().mipTailSize, asset::LoadPriority::High))
+        {
+            AP_WARN("[TextureStreamer] Failed to reload texture asset by GUID: {}", guid.toString());
+            return false;
+        }
+        return true;
+    }
+
+    auto TextureStreamer::requestProjectedSize(core::UUID const& guid, float projectedSize, uint64_t frame) -> void
+    {
+        auto it = m_textures.find(guid);
+        if (it != m_textures.end() && it->second.sharedWith)
+        {
+            it = m_textures.find(*it->second.sharedWith);
+        }
+        if (it == m_textures.end() || !it->second.storedHeader)
+        {
+            return;
+        }
+
+        auto const mip = asset::computeDesiredMip(*it->second.storedHeader, projectedSize, getSettings().mipBias);
+        m_planner.requestMip(it->first, mip, frame);
+    }
+
+    auto TextureStreamer::update(uint64_t frame) -> void
+    {
+        if (!m_assetManager)
+        {
+            return;
+        }
+
+        for (auto const& change : m_planner.plan(frame))
+        {
+            if (m_pendingLoadCount >= getSettings().maxLoadsInFlight)
+            {
+                break;
+            }
+
+            auto const it = m_textures.find(change.id);
+            if (it == m_textures.end() || !it->second.storedHeader)
+            {
+                continue;
+            }
+
+            // A running load is applied first; the next plan picks up whatever is still missing.
+            auto& streamed = it->second;
+            if (streamed.pendingLoad)
+            {
+                continue;
+            }
+
+            auto const maxDimension = asset::getMipMaxDimension(*streamed.storedHeader, change.targetMip);
+            requestMips(change.id, streamed, maxDimension, asset::LoadPriority::Low);
+        }
+    }
+
+    auto TextureStreamer::requestMips(
+        core::UUID const& guid,
+        StreamedTexture& streamed,
+        uint32_t maxDimension,
+        asset::LoadPriority priority
+    ) -> bool
+    {
+        streamed.pendingLoad = m_assetManager->getTextureMipsAsync(
+            guid,
+            maxDimension,
+            priority,
+            [this, guid](asset::AssetLoadRequest& request) { onMipsLoaded(guid, request); }
+        );
+        if (!streamed.pendingLoad)
+        {
+            return false;
+        }
+
+        ++m_pendingLoadCount;
+        return true;
+    }
+
+    auto TextureStreamer::onMipsLoaded(core::UUID const& guid, asset::AssetLoadRequest& request) -> void
+    {
+        auto const it = m_textures.find(guid);
+        if (it == m_textures.end())
+        {
+            return;
+        }
+
+        auto& streamed = it->second;
+        streamed.pendingLoad.reset();
+        --m_pendingLoadCount;
+
+        // A first load whose content is already resident draws that texture; only the mip tail was read.
+        auto const loaded = request.getState() == asset::LoadState::Ready;
+        if (loaded && !streamed.storedHeader && shareTexture(guid, streamed, request.getContentHash()))
+        {
+            return;
+        }
+
+        auto texture = core::ref<graphics::Texture>{};
+        auto const textureAsset = request.getAssetAs<asset::TextureAsset>();
+        auto const& payload = request.getTexturePayload();
+        if (loaded && textureAsset)
+        {
+            texture = m_device->createTextureFromPayload(payload, textureAsset->getSourcePath());
+        }
+
+        if (!texture)
+        {
+            AP_WARN("[TextureStreamer] Failed to create texture from asset: {}", guid.toString());
+            if (!streamed.texture)
+            {
+                // Without a mip tail there is nothing to fall back to.
+                for (auto const& binding : streamed.bindings)
+                {
+                    binding.material->setTexture(binding.slot, nullptr);
+                }
+                streamed.bindings.clear();
+                streamed.failed = true;
+            }
+            return;
+        }
+
+        if (!streamed.storedHeader)
+        {
+            streamed.storedHeader = payload.storedHeader;
+            m_planner.addTexture(guid, payload.storedHeader, payload.firstMip);
+
+            streamed.contentHash = request.getContentHash();
+            if (!streamed.contentHash.empty())
+            {
+                m_texturesByContent[streamed.contentHash] = guid;
+            }
+        }
+        else
+        {
+            m_planner.setResidentMip(guid, payload.firstMip);
+        }
+
+        streamed.texture = texture;
+        setBoundTexture(streamed, texture);
+    }
+
+    auto TextureStreamer::shareTexture(core::UUID const& guid, StreamedTexture& streamed, std::string const& contentHash) -> bool
+    {
+        if (contentHash.empty())
+        {
+            return false;
+        }
+
+        auto const it = m_texturesByContent.find(contentHash);
+        if (it == m_texturesByContent.end() || it->second == guid)
+        {
+            return false;
+        }
+
+        auto const sourceGuid = it->second;
+        auto& source = m_textures.at(sourceGuid);
+        if (!source.texture || source.failed)
+        {
+            return false;
+        }
+
+        streamed.sharedWith = sourceGuid;
+        streamed.contentHash = contentHash;
+        source.sharers.push_back(guid);
+        for (auto const& binding : streamed.bindings)
+        {
+            binding.material->setTexture(binding.slot, source.texture);
+        }
+        return true;
+    }
+
+    auto TextureStreamer::stopSharing(core::UUID const& guid, StreamedTexture& streamed) -> void
+    {
+        if (streamed.sharedWith)
+        {
+            std::erase(m_textures.at(*streamed.sharedWith).sharers, guid);
+            streamed.sharedWith.reset();
+        }
+
+        if (auto const it = m_texturesByContent.find(streamed.contentHash); it != m_texturesByContent.end() && it->second == guid)
+        {
+            m_texturesByContent.erase(it);
+        }
+        streamed.contentHash.clear();
+
+        // Sharers load their own copy; their slots keep the current texture until it arrives.
+        for (auto const& sharerGuid : std::exchange(streamed.sharers, {}))
+        {
+            auto& sharer = m_textures.at(sharerGuid);
+            sharer.sharedWith.reset();
+            sharer.contentHash.clear();
+            if (!sharer.pendingLoad && !requestMips(sharerGuid, sharer, getSettings().mipTailSize, asset::LoadPriority::High))
+            {
+                AP_WARN("[TextureStreamer] Failed to reload texture asset by GUID: {}", sharerGuid.toString());
+            }
+        }
+    }
+
+    auto TextureStreamer::setBoundTexture(StreamedTexture const& streamed, core::ref<graphics::Texture> const& texture) -> void
+    {
+        for (auto const& binding : streamed.bindings)
+        {
+            binding.material->setTexture(binding.slot, texture);
+        }
+        for (auto const& sharerGuid : streamed.sharers)
+        {
+            for (auto const& binding : m_textures.at(sharerGuid).bindings)
+            {
+                binding.material->setTexture(binding.slot, texture);
+            }
+        }
+    }
+
+    auto TextureStreamer::getSharedTextureCount() const -> size_t
+    {
+        return static_cast<size_t>(std::ranges::count_if(m_textures, [](auto const& entry) { return entry.second.sharedWith.has_value(); }));
+    }
+} // namespace april::scene
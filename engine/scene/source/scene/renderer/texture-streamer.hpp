@@ -0,0 +1,116 @@
+#pragma once
+
+#include <asset/asset-load-request.hpp>
+#include <asset/asset-manager.hpp>
+#include <asset/texture/texture-streaming.hpp>
+#include <core/foundation/object.hpp>
+#include <core/tools/uuid.hpp>
+#include <graphics/material/standard-material.hpp>
+#include <graphics/rhi/render-device.hpp>
+#include <graphics/rhi/texture.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace april::scene
+{
+    /**
+     * Keeps material textures resident at the mip level their on-screen size needs, within a memory budget.
+     * A texture's mip tail is loaded as soon as it is bound; finer mips are streamed in from the cooked blob
+     * as visible instances request them and dropped again when the budget or their last use says so.
+     * Each residency change reloads the texture with its new first mip and swaps it into every bound slot.
+     * Textures whose cooked payloads are identical share the first one's GPU texture and residency.
+     */
+    class TextureStreamer
+    {
+    public:
+        TextureStreamer() = default;
+        TextureStreamer(core::ref<graphics::Device> device, asset::AssetManager* assetManager, asset::TextureStreamingSettings const& settings = {});
+        ~TextureStreamer();
+
+        TextureStreamer(TextureStreamer const&) = delete;
+        auto operator=(TextureStreamer const&) -> TextureStreamer& = delete;
+
+        auto setDevice(core::ref<graphics::Device> device) -> void { m_device = std::move(device); }
+        auto setAssetManager(asset::AssetManager* assetManager) -> void { m_assetManager = assetManager; }
+        auto setSettings(asset::TextureStreamingSettings const& settings) -> void { m_planner.setSettings(settings); }
+        [[nodiscard]] auto getSettings() const -> asset::TextureStreamingSettings const& { return m_planner.getSettings(); }
+
+        /**
+         * Bind the texture registered under guid to a material slot. Until its mip tail has loaded the slot
+         * holds placeholder (which may be null). Returns false if the texture cannot be loaded.
+         */
+        auto bindTexture(
+            core::UUID const& guid,
+            core::ref<graphics::StandardMaterial> const& material,
+            graphics::Material::TextureSlot slot,
+            core::ref<graphics::Texture> const& placeholder
+        ) -> bool;
+
+        /**
+         * Stop swapping textures into material, e.g. because it was replaced by a reloaded one.
+         */
+        auto unbindMaterial(core::ref<graphics::StandardMaterial> const& material) -> void;
+
+        /**
+         * Load the texture again from its freshly cooked blob, starting over from the mip tail. Bound slots
+         * keep the current texture until the new one arrives. Returns false if guid was never bound.
+         */
+        auto reloadTexture(core::UUID const& guid) -> bool;
+
+        /**
+         * Report that the texture covers about projectedSize pixels on screen this frame.
+         */
+        auto requestProjectedSize(core::UUID const& guid, float projectedSize, uint64_t frame) -> void;
+
+        /**
+         * Plan residency for frame and queue the loads it needs. Finished loads are applied from
+         * AssetManager::processCompletedLoads.
+         */
+        auto update(uint64_t frame) -> void;
+
+        [[nodiscard]] auto getPendingLoadCount() const -> size_t { return m_pendingLoadCount; }
+        [[nodiscard]] auto getResidentBytes() const -> uint64_t { return m_planner.getResidentBytes(); }
+
+        /**
+         * Number of textures drawing from another texture's upload because their cooked content matches.
+         */
+        [[nodiscard]] auto getSharedTextureCount() const -> size_t;
+
+    private:
+        struct Binding
+        {
+            core::ref<graphics::StandardMaterial> material{};
+            graphics::Material::TextureSlot slot{};
+        };
+
+        struct StreamedTexture
+        {
+            std::vector<Binding> bindings{};
+            core::ref<graphics::Texture> texture{};
+            std::optional<asset::TextureHeader> storedHeader{};  // Known once the mip tail arrived
+            asset::AssetLoadHandle pendingLoad{};
+            std::string contentHash{};
+            std::optional<core::UUID> sharedWith{};   // Draws the texture of this entry instead of its own
+            std::vector<core::UUID> sharers{};        // Entries drawing this one's texture
+            bool failed{false};
+        };
+
+        auto requestMips(core::UUID const& guid, StreamedTexture& streamed, uint32_t maxDimension, asset::LoadPriority priority) -> bool;
+        auto onMipsLoaded(core::UUID const& guid, asset::AssetLoadRequest& request) -> void;
+        auto shareTexture(core::UUID const& guid, StreamedTexture& streamed, std::string const& contentHash) -> bool;
+        auto stopSharing(core::UUID const& guid, StreamedTexture& streamed) -> void;
+        auto setBoundTexture(StreamedTexture const& streamed, core::ref<graphics::Texture> const& texture) -> void;
+
+        core::ref<graphics::Device> m_device{};
+        asset::AssetManager* m_assetManager{};
+        asset::TextureResidencyPlanner m_planner{};
+        std::unordered_map<core::UUID, StreamedTexture> m_textures{};
+        std::unordered_map<std::string, core::UUID> m_texturesByContent{};
+        size_t m_pendingLoadCount{0};
+    };
+} // namespace april::scene
@@ -9,3 +9,4 @@
 #include "renderer/frame-snapshot-buffer.hpp"
 #include "renderer/render-resource-registry.hpp"
 #include "renderer/render-extraction.hpp"
+#include "prefab.hpp"
@@ -0,0 +1,732 @@
+#include <asset/asset-manager.hpp>
+#include <asset/ddc/local-ddc.hpp>
+#include <core/log/logger.hpp>
+#include <core/profile/timer.hpp>
+#include <nlohmann/json.hpp>
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace fs = std::filesystem;
+using namespace april;
+using namespace april::asset;
+
+namespace
+{
+    struct BenchOptions
+    {
+        fs::path workDir{"build/bench-asset"};
+        fs::path corpus{};          // Existing sources to benchmark; empty generates the synthetic corpus
+        fs::path output{};          // Defaults to <work>/results.json
+        fs::path baseline{};        // Compare against these results and fail on regressions
+        double threshold{0.10};     // Relative slowdown that counts as a regression
+        uint32_t iterations{20};
+        bool quick{false};
+        bool help{false};
+    };
+
+    struct Metric
+    {
+        std::string name{};
+        double value{0.0};
+        std::string unit{};
+        bool higherIsBetter{false};
+    };
+
+    struct CorpusItem
+    {
+        std::string name{};
+        AssetType type{AssetType::None};
+        fs::path assetPath{};
+        uint64_t sourceBytes{0};
+    };
+
+    auto printUsage() -> void
+    {
+        AP_INFO("Usage: bench-asset [--work <dir>] [--corpus <dir>] [--out <file>] [--baseline <file>] "
+                "[--threshold <fraction>] [--iterations <n>] [--quick]");
+    }
+
+    template <typename T>
+    auto parseNumber(std::string_view text, T& outValue) -> bool
+    {
+        auto const [end, ec] = std::from_chars(text.data(), text.data() + text.size(), outValue);
+        return ec == std::errc{} && end == text.data() + text.size();
+    }
+
+    auto parseArgs(int argc, char** argv, BenchOptions& options) -> bool
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            auto const arg = std::string_view{argv[i]};
+            if (arg == "--help" || arg == "-h")
+            {
+                options.help = true;
+                return true;
+            }
+            if (arg == "--quick")
+            {
+                options.quick = true;
+                continue;
+            }
+
+            if (i + 1 >= argc)
+            {
+                AP_ERROR("[bench-asset] Missing value for {}", arg);
+                return false;
+            }
+
+            auto const value = std::string_view{argv[++i]};
+            if (arg == "--work")
+            {
+                options.workDir = value;
+            }
+            else if (arg == "--corpus")
+            {
+                options.corpus = value;
+            }
+            else if (arg == "--out")
+            {
+                options.output = value;
+            }
+            else if (arg == "--baseline")
+            {
+                options.baseline = value;
+            }
+            else if (arg == "--threshold")
+            {
+                if (!parseNumber(value, options.threshold) || options.threshold < 0.0)
+                {
+                    AP_ERROR("[bench-asset] Invalid --threshold value: {} (expected a non-negative fraction)", value);
+                    return false;
+                }
+            }
+            else if (arg == "--iterations")
+            {
+                if (!parseNumber(value, options.iterations) || options.iterations == 0)
+                {
+                    AP_ERROR("[bench-asset] Invalid --iterations value: {} (expected a positive integer)", value);
+                    return false;
+                }
+            }
+            else
+            {
+                AP_ERROR("[bench-asset] Unknown argument: {}", arg);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Fixed-seed generator so every run benchmarks the same bytes.
+    struct Lcg
+    {
+        uint32_t state{};
+
+        auto next() -> uint32_t
+        {
+            state = state * 1664525u + 1013904223u;
+            return state >> 8;
+        }
+    };
+
+    // Smooth gradients with per-texel noise: compresses like a photo texture, not like a flat colour.
+    auto writeTexture(fs::path const& path, uint32_t size) -> bool
+    {
+        auto rng = Lcg{size};
+        auto pixels = std::vector<uint8_t>(size_t{size} * size * 4);
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                auto* pixel = &pixels[(size_t{y} * size + x) * 4];
+                auto const noise = static_cast<int>(rng.next() % 32) - 16;
+                pixel[0] = static_cast<uint8_t>(std::clamp(static_cast<int>(x * 255 / size) + noise, 0, 255));
+                pixel[1] = static_cast<uint8_t>(std::clamp(static_cast<int>(y * 255 / size) + noise, 0, 255));
+                pixel[2] = static_cast<uint8_t>(std::clamp(128 + static_cast<int>(96.0f * std::sin(0.05f * static_cast<float>(x + y))) + noise, 0, 255));
+                pixel[3] = 255;
+            }
+        }
+        return stbi_write_png(path.string().c_str(), static_cast<int>(size), static_cast<int>(size), 4, pixels.data(), static_cast<int>(size * 4)) != 0;
+    }
+
+    // cells x cells height field with normals and UVs, as one glTF primitive.
+    auto writeMesh(fs::path const& path, uint32_t cells) -> bool
+    {
+        auto const side = cells + 1;
+        auto const vertexCount = size_t{side} * side;
+        auto positions = std::vector<float>{};
+        auto normals = std::vector<float>{};
+        auto uvs = std::vector<float>{};
+        positions.reserve(vertexCount * 3);
+        normals.reserve(vertexCount * 3);
+        uvs.reserve(vertexCount * 2);
+
+        auto const height = [](float u, float v) { return 0.1f * std::sin(u * 12.0f) * std::cos(v * 9.0f); };
+        auto const step = 1.0f / static_cast<float>(cells);
+        for (uint32_t y = 0; y < side; ++y)
+        {
+            for (uint32_t x = 0; x < side; ++x)
+            {
+                auto const u = static_cast<float>(x) * step;
+                auto const v = static_cast<float>(y) * step;
+                positions.insert(positions.end(), {u, height(u, v), v});
+
+                auto const dx = (height(u + step, v) - height(u - step, v)) / (2.0f * step);
+                auto const dz = (height(u, v + step) - height(u, v - step)) / (2.0f * step);
+                auto const length = std::sqrt(dx * dx + 1.0f + dz * dz);
+                normals.insert(normals.end(), {-dx / length, 1.0f / length, -dz / length});
+                uvs.insert(uvs.end(), {u, v});
+            }
+        }
+
+        auto indices = std::vector<uint32_t>{};
+        indices.reserve(size_t{cells} * cells * 6);
+        for (uint32_t y = 0; y < cells; ++y)
+        {
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                auto const i = y * side + x;
+                indices.insert(indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+            }
+        }
+
+        auto const binName = path.stem().string() + ".bin";
+        auto const positionBytes = positions.size() * sizeof(float);
+        auto const normalBytes = normals.size() * sizeof(float);
+        auto const uvBytes = uvs.size() * sizeof(float);
+        auto const indexBytes = indices.size() * sizeof(uint32_t);
+        {
+            auto bin = std::ofstream{path.parent_path() / binName, std::ios::binary};
+            bin.write(reinterpret_cast<char const*>(positions.data()), static_cast<std::streamsize>(positionBytes));
+            bin.write(reinterpret_cast<char const*>(normals.data()), static_cast<std::streamsize>(normalBytes));
+            bin.write(reinterpret_cast<char const*>(uvs.data()), static_cast<std::streamsize>(uvBytes));
+            bin.write(reinterpret_cast<char const*>(indices.data()), static_cast<std::streamsize>(indexBytes));
+            if (!bin)
+            {
+                return false;
+            }
+        }
+
+        auto const view = [](size_t offset, size_t length) { return nlohmann::json{{"buffer", 0}, {"byteOffset", offset}, {"byteLength", length}}; };
+        auto const accessor = [](int viewIndex, int componentType, size_t count, char const* type) {
+            return nlohmann::json{{"bufferView", viewIndex}, {"componentType", componentType}, {"count", count}, {"type", type}};
+        };
+
+        auto positionAccessor = accessor(0, 5126, vertexCount, "VEC3");
+        positionAccessor["min"] = {0.0f, -0.1f, 0.0f};
+        positionAccessor["max"] = {1.0f, 0.1f, 1.0f};
+
+        auto const gltf = nlohmann::json{
+            {"asset", {{"version", "2.0"}}},
+            {"buffers", {{{"uri", binName}, {"byteLength", positionBytes + normalBytes + uvBytes + indexBytes}}}},
+            {"bufferViews", {
+                view(0, positionBytes),
+                view(positionBytes, normalBytes),
+                view(positionBytes + normalBytes, uvBytes),
+                view(positionBytes + normalBytes + uvBytes, indexBytes)
+            }},
+            {"accessors", {
+                positionAccessor,
+                accessor(1, 5126, vertexCount, "VEC3"),
+                accessor(2, 5126, vertexCount, "VEC2"),
+                accessor(3, 5125, indices.size(), "SCALAR")
+            }},
+            {"meshes", {{{"primitives", {{{"attributes", {{"POSITION", 0}, {"NORMAL", 1}, {"TEXCOORD_0", 2}}}, {"indices", 3}}}}}}},
+            {"nodes", {{{"mesh", 0}}}},
+            {"scenes", {{{"nodes", {0}}}}},
+            {"scene", 0}
+        };
+
+        auto file = std::ofstream{path};
+        file << gltf.dump(2);
+        return static_cast<bool>(file);
+    }
+
+    auto writeAssetFile(fs::path const& sourcePath, AssetType type, fs::path const& assetPath) -> bool
+    {
+        auto json = nlohmann::json{};
+        if (type == AssetType::Texture)
+        {
+            auto asset = TextureAsset{};
+            asset.setSourcePath(sourcePath.string());
+            asset.serializeJson(json);
+        }
+        else
+        {
+            auto asset = StaticMeshAsset{};
+            asset.setSourcePath(sourcePath.string());
+            asset.serializeJson(json);
+        }
+
+        auto file = std::ofstream{assetPath};
+        file << json.dump(2);
+        return static_cast<bool>(file);
+    }
+
+    auto typeFromExtension(fs::path const& path) -> AssetType
+    {
+        auto extension = path.extension().string();
+        std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp")
+        {
+            return AssetType::Texture;
+        }
+        if (extension == ".gltf" || extension == ".glb")
+        {
+            return AssetType::Mesh;
+        }
+        return AssetType::None;
+    }
+
+    auto buildCorpus(BenchOptions const& options, fs::path const& assetDir) -> std::vector<CorpusItem>
+    {
+        auto sources = std::vector<std::pair<fs::path, std::string>>{};
+        if (options.corpus.empty())
+        {
+            auto const sourceDir = options.workDir / "sources";
+            fs::create_directories(sourceDir);
+
+            auto const textureSizes = options.quick ? std::vector<uint32_t>{128, 512} : std::vector<uint32_t>{256, 1024, 2048};
+            auto const meshCells = options.quick ? std::vector<uint32_t>{16, 64} : std::vector<uint32_t>{32, 128, 512};
+            for (auto const size : textureSizes)
+            {
+                auto const path = sourceDir / std::format("texture-{}.png", size);
+                if (fs::exists(path) || writeTexture(path, size))
+                {
+                    sources.emplace_back(path, std::format("texture-{}", size));
+                }
+            }
+            for (auto const cells : meshCells)
+            {
+                auto const path = sourceDir / std::format("grid-{}.gltf", cells);
+                if (fs::exists(path) || writeMesh(path, cells))
+                {
+                    sources.emplace_back(path, std::format("mesh-{}", cells));
+                }
+            }
+        }
+        else
+        {
+            for (auto const& entry : fs::recursive_directory_iterator{options.corpus})
+            {
+                if (entry.is_regular_file() && typeFromExtension(entry.path()) != AssetType::None)
+                {
+                    sources.emplace_back(entry.path(), fs::relative(entry.path(), options.corpus).generic_string());
+                }
+            }
+            std::ranges::sort(sources);
+        }
+
+        auto items = std::vector<CorpusItem>{};
+        for (auto const& [sourcePath, name] : sources)
+        {
+            auto item = CorpusItem{};
+            item.name = name;
+            item.type = typeFromExtension(sourcePath);
+            item.assetPath = assetDir / (std::to_string(items.size()) + ".asset");
+            item.sourceBytes = fs::file_size(sourcePath);
+            if (writeAssetFile(fs::absolute(sourcePath), item.type, item.assetPath))
+            {
+                items.push_back(std::move(item));
+            }
+        }
+        return items;
+    }
+
+    auto loadItem(AssetManager& manager, CorpusItem const& item) -> std::shared_ptr<Asset>
+    {
+        if (item.type == AssetType::Texture)
+        {
+            return manager.loadAsset<TextureAsset>(item.assetPath);
+        }
+        return manager.loadAsset<StaticMeshAsset>(item.assetPath);
+    }
+
+    auto getPeakRssMiB() -> double
+    {
+#ifdef _WIN32
+        auto counters = PROCESS_MEMORY_COUNTERS{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0.0;
+        }
+        return static_cast<double>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+#else
+        auto usage = rusage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<double>(usage.ru_maxrss) / 1024.0;  // Kilobytes on Linux
+#endif
+    }
+
+    auto percentile(std::vector<double> samples, double fraction) -> double
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        std::ranges::sort(samples);
+        auto const index = static_cast<size_t>(std::round(fraction * static_cast<double>(samples.size() - 1)));
+        return samples[index];
+    }
+
+    class Bench
+    {
+    public:
+        explicit Bench(BenchOptions options) : m_options{std::move(options)} {}
+
+        auto run() -> bool
+        {
+            auto const assetDir = m_options.workDir / "assets";
+            fs::remove_all(assetDir);
+            fs::create_directories(assetDir);
+
+            m_items = buildCorpus(m_options, assetDir);
+            if (m_items.empty())
+            {
+                AP_ERROR("[bench-asset] No textures or glTF meshes to benchmark");
+                return false;
+            }
+
+            measureColdCook(assetDir);
+            measureColdBatchCook(assetDir);
+            measureWarm(assetDir);
+            measureDdcThroughput();
+            measureSourceLookup();
+            add("peak_rss", getPeakRssMiB(), "MiB");
+            return true;
+        }
+
+        [[nodiscard]] auto getMetrics() const -> std::vector<Metric> const& { return m_metrics; }
+
+    private:
+        auto add(std::string name, double value, std::string unit, bool higherIsBetter = false) -> void
+        {
+            m_metrics.push_back({std::move(name), value, std::move(unit), higherIsBetter});
+        }
+
+        auto resetCache(fs::path const& assetDir) const -> fs::path
+        {
+            auto const ddcDir = m_options.workDir / "ddc";
+            fs::remove_all(ddcDir);
+            fs::remove_all(assetDir / "library");
+            return ddcDir;
+        }
+
+        // One asset at a time against an empty DDC: import latency per source size.
+        auto measureColdCook(fs::path const& assetDir) -> void
+        {
+            auto manager = AssetManager{assetDir, resetCache(assetDir)};
+            for (auto const& item : m_items)
+            {
+                auto const asset = loadItem(manager, item);
+                if (!asset)
+                {
+                    continue;
+                }
+
+                auto const start = core::Timer::now();
+                auto const failures = manager.cookAssets(std::span{&asset, 1});
+                auto const elapsed = core::Timer::calcDuration(start, core::Timer::now());
+                if (failures == 0)
+                {
+                    add("cook_cold." + item.name, elapsed, "ms");
+                }
+            }
+        }
+
+        // Everything at once on the thread pool, as april-cook does.
+        auto measureColdBatchCook(fs::path const& assetDir) -> void
+        {
+            auto manager = AssetManager{assetDir, resetCache(assetDir)};
+            auto assets = std::vector<std::shared_ptr<Asset>>{};
+            auto sourceBytes = uint64_t{0};
+            for (auto const& item : m_items)
+            {
+                if (auto asset = loadItem(manager, item))
+                {
+                    assets.push_back(std::move(asset));
+                    sourceBytes += item.sourceBytes;
+                }
+            }
+
+            auto const start = core::Timer::now();
+            manager.cookAssets(assets);
+            auto const elapsed = core::Timer::calcDuration(start, core::Timer::now());
+            add("cook_cold_batch.total", elapsed, "ms");
+            add("cook_cold_batch.throughput", static_cast<double>(sourceBytes) / (1024.0 * 1024.0) / (elapsed / 1000.0), "MiB/s", true);
+        }
+
+        // A fresh manager over the filled DDC, like a second launch: key checks and cooked reads only.
+        auto measureWarm(fs::path const& assetDir) -> void
+        {
+            auto manager = AssetManager{assetDir, m_options.workDir / "ddc"};
+            for (auto const& item : m_items)
+            {
+                auto const asset = loadItem(manager, item);
+                if (!asset)
+                {
+                    continue;
+                }
+
+                auto ensureSamples = std::vector<double>{};
+                auto readSamples = std::vector<double>{};
+                auto blob = std::vector<std::byte>{};
+                for (uint32_t i = 0; i < m_options.iterations; ++i)
+                {
+                    auto start = core::Timer::now();
+                    manager.cookAssets(std::span{&asset, 1});
+                    ensureSamples.push_back(core::Timer::calcDuration(start, core::Timer::now()));
+
+                    start = core::Timer::now();
+                    auto const valid = item.type == AssetType::Texture
+                        ? manager.getTextureData(static_cast<TextureAsset const&>(*asset), blob).isValid()
+                        : manager.getMeshData(static_cast<StaticMeshAsset const&>(*asset), blob).isValid();
+                    if (valid)
+                    {
+                        readSamples.push_back(core::Timer::calcDuration(start, core::Timer::now()));
+                    }
+                }
+
+                auto const readName = std::string{item.type == AssetType::Texture ? "texture_data." : "mesh_data."} + item.name;
+                add("ensure_imported_warm." + item.name + ".median", percentile(ensureSamples, 0.5), "ms");
+                add(readName + ".median", percentile(readSamples, 0.5), "ms");
+                add(readName + ".p95", percentile(readSamples, 0.95), "ms");
+            }
+        }
+
+        // Unique incompressible payloads, so content addressing cannot fold them together.
+        auto measureDdcThroughput() -> void
+        {
+            auto const ddcDir = m_options.workDir / "ddc-throughput";
+            fs::remove_all(ddcDir);
+
+            auto const blobSize = size_t{4} << 20;
+            auto const blobCount = m_options.quick ? 8u : 32u;
+            auto const totalMiB = static_cast<double>(blobSize * blobCount) / (1024.0 * 1024.0);
+            auto rng = Lcg{0xDDC};
+            auto values = std::vector<DdcValue>(blobCount);
+            for (auto& value : values)
+            {
+                value.bytes.resize(blobSize);
+                for (size_t i = 0; i + 4 <= blobSize; i += 4)
+                {
+                    auto const word = rng.next();
+                    std::memcpy(value.bytes.data() + i, &word, sizeof(word));
+                }
+            }
+
+            auto ddc = LocalDdc{ddcDir};
+            auto start = core::Timer::now();
+            for (uint32_t i = 0; i < blobCount; ++i)
+            {
+                ddc.put(std::format("BENCH|{}", i), values[i]);
+            }
+            add("ddc.write", totalMiB / (core::Timer::calcDuration(start, core::Timer::now()) / 1000.0), "MiB/s", true);
+
+            // Reads right after writing come from the OS cache; this measures the DDC, not the disk.
+            auto value = DdcValue{};
+            start = core::Timer::now();
+            for (uint32_t i = 0; i < blobCount; ++i)
+            {
+                ddc.get(std::format("BENCH|{}", i), value);
+            }
+            add("ddc.read", totalMiB / (core::Timer::calcDuration(start, core::Timer::now()) / 1000.0), "MiB/s", true);
+
+            fs::remove_all(ddcDir);
+        }
+
+        // findAssetBySourcePath is hit for every texture and material a glTF import touches. Per-lookup cost must
+        // not grow with the number of registered assets, or importing N assets goes quadratic.
+        auto measureSourceLookup() -> void
+        {
+            auto const counts = m_options.quick ? std::array<uint32_t, 2>{500, 4000} : std::array<uint32_t, 2>{1000, 16000};
+            auto perLookupNs = std::array<double, 2>{};
+            for (size_t c = 0; c < counts.size(); ++c)
+            {
+                auto const root = fs::absolute(m_options.workDir / "lookup");
+                fs::remove_all(root);
+                fs::create_directories(root);
+
+                auto sources = std::vector<fs::path>{};
+                sources.reserve(counts[c]);
+                for (uint32_t i = 0; i < counts[c]; ++i)
+                {
+                    auto const source = root / std::format("texture-{}.png", i);
+                    writeAssetFile(source, AssetType::Texture, source.string() + ".asset");
+                    sources.push_back(source);
+                }
+
+                auto manager = AssetManager{root, m_options.workDir / "lookup-ddc"};
+                manager.scanDirectory(root);
+                for (auto const& source : sources)
+                {
+                    static_cast<void>(manager.findAssetBySourcePath(source, AssetType::Texture));
+                }
+
+                // Second pass: the assets are cached, so only the index lookup is left.
+                auto const start = core::Timer::now();
+                for (uint32_t i = 0; i < m_options.iterations; ++i)
+                {
+                    for (auto const& source : sources)
+                    {
+                        static_cast<void>(manager.findAssetBySourcePath(source, AssetType::Texture));
+                    }
+                }
+                auto const elapsed = core::Timer::calcDuration(start, core::Timer::now());
+                perLookupNs[c] = elapsed * 1.0e6 / (static_cast<double>(counts[c]) * m_options.iterations);
+                add(std::format("source_lookup.{}", counts[c]), perLookupNs[c], "ns");
+            }
+
+            // 1.0 is constant-time; a linear scan would grow with the ratio of the two asset counts.
+            add("source_lookup.scaling", perLookupNs[1] / perLookupNs[0], "x");
+            fs::remove_all(m_options.workDir / "lookup");
+            fs::remove_all(m_options.workDir / "lookup-ddc");
+        }
+
+        BenchOptions m_options{};
+        std::vector<CorpusItem> m_items{};
+        std::vector<Metric> m_metrics{};
+    };
+
+    auto writeResults(BenchOptions const& options, std::vector<Metric> const& metrics, fs::path const& path) -> bool
+    {
+        auto json = nlohmann::json{
+            {"version", 1},
+            {"corpus", options.corpus.empty() ? std::string{"synthetic"} : options.corpus.generic_string()},
+            {"quick", options.quick},
+            {"iterations", options.iterations}
+        };
+        auto& entries = json["metrics"] = nlohmann::json::object();
+        for (auto const& metric : metrics)
+        {
+            entries[metric.name] = {{"value", metric.value}, {"unit", metric.unit}, {"higherIsBetter", metric.higherIsBetter}};
+        }
+
+        if (path.has_parent_path())
+        {
+            fs::create_directories(path.parent_path());
+        }
+        auto file = std::ofstream{path};
+        file << json.dump(2);
+        return static_cast<bool>(file);
+    }
+
+    // Returns the number of metrics that got worse than the baseline by more than the threshold,
+    // or nullopt when the baseline can't be read.
+    auto compareWithBaseline(BenchOptions const& options, std::vector<Metric> const& metrics) -> std::optional<int>
+    {
+        auto file = std::ifstream{options.baseline};
+        auto const baseline = nlohmann::json::parse(file, nullptr, false);
+        if (baseline.is_discarded() || !baseline.contains("metrics"))
+        {
+            return std::nullopt;
+        }
+        if (baseline.value("corpus", std::string{}) != (options.corpus.empty() ? std::string{"synthetic"} : options.corpus.generic_string()) ||
+            baseline.value("quick", false) != options.quick)
+        {
+            AP_WARN("[bench-asset] Baseline was recorded with a different corpus; only matching metrics are compared");
+        }
+
+        auto regressions = 0;
+        for (auto const& metric : metrics)
+        {
+            auto const& stored = baseline["metrics"];
+            if (!stored.contains(metric.name))
+            {
+                continue;
+            }
+
+            auto const base = stored[metric.name].value("value", 0.0);
+            if (base <= 0.0)
+            {
+                continue;
+            }
+
+            auto const change = (metric.value - base) / base;
+            auto const worse = metric.higherIsBetter ? -change : change;
+            auto const regressed = worse > options.threshold;
+            regressions += regressed ? 1 : 0;
+            AP_INFO("[bench-asset] {:<48} {:>12.3f} {:<6} baseline {:>12.3f} ({:+.1f}%){}",
+                    metric.name, metric.value, metric.unit, base, change * 100.0, regressed ? "  REGRESSION" : "");
+        }
+        return regressions;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = BenchOptions{};
+    if (!parseArgs(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+    if (options.help)
+    {
+        printUsage();
+        return 0;
+    }
+    if (options.output.empty())
+    {
+        options.output = options.workDir / "results.json";
+    }
+
+    // Per-asset import logging would dominate the timings.
+    auto const logger = Log::getLogger();
+    auto const previousLevel = logger->getLevel();
+    logger->setLevel(ELogLevel::Warning);
+    auto bench = Bench{options};
+    auto const completed = bench.run();
+    logger->setLevel(previousLevel);
+    if (!completed)
+    {
+        return 1;
+    }
+
+    if (!writeResults(options, bench.getMetrics(), options.output))
+    {
+        AP_ERROR("[bench-asset] Failed to write results: {}", options.output.string());
+        return 1;
+    }
+
+    if (options.baseline.empty())
+    {
+        for (auto const& metric : bench.getMetrics())
+        {
+            AP_INFO("[bench-asset] {:<48} {:>12.3f} {}", metric.name, metric.value, metric.unit);
+        }
+        AP_INFO("[bench-asset] Wrote {}", options.output.string());
+        return 0;
+    }
+
+    auto const regressions = compareWithBaseline(options, bench.getMetrics());
+    if (!regressions)
+    {
+        AP_ERROR("[bench-asset] Unreadable baseline: {}; wrote {} without comparing", options.baseline.string(), options.output.string());
+        return 3;
+    }
+    AP_INFO("[bench-asset] Wrote {}; {} regression(s) beyond {:.0f}%", options.output.string(), *regressions, options.threshold * 100.0);
+    return *regressions == 0 ? 0 : 2;
+}
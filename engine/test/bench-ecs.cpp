@@ -0,0 +1,251 @@
+#include <scene/ecs-core.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+using namespace april::scene;
+
+namespace
+{
+    struct Position { float x{}, y{}, z{}; };
+    struct Velocity { float x{}, y{}, z{}; };
+    struct Health { int32_t value{100}; };
+    struct Parent { Entity entity{NullEntity}; };
+
+    // Stand-ins for the many component types only a few entities carry (lights, triggers, audio sources, ...)
+    template<size_t I>
+    struct SparseTag { uint32_t value{}; };
+
+    inline constexpr size_t kSparseTypeCount = 32;
+
+    struct BenchOptions
+    {
+        uint32_t entities{200'000};
+        uint32_t memoryEntities{1'000'000};
+        uint32_t iterations{20};
+    };
+
+    auto printUsage() -> void
+    {
+        std::println("Usage: bench-ecs [--entities <n>] [--memory-entities <n>] [--iterations <n>]");
+    }
+
+    auto parseArgs(int argc, char** argv, BenchOptions& options) -> bool
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            auto const arg = std::string_view{argv[i]};
+            auto const value = std::string_view{argv[i + 1]};
+            auto* target = arg == "--entities" ? &options.entities
+                : arg == "--memory-entities" ? &options.memoryEntities
+                : arg == "--iterations" ? &options.iterations
+                : nullptr;
+            if (!target || std::from_chars(value.data(), value.data() + value.size(), *target).ec != std::errc{} || *target == 0)
+            {
+                return false;
+            }
+        }
+        return argc % 2 == 1;
+    }
+
+    // Pool lookup the way Registry did it before component type IDs: hash typeid on every access.
+    class TypeIndexPools
+    {
+    public:
+        template<typename T>
+        auto add(SparseSet<T>* pool) -> void
+        {
+            m_pools[std::type_index{typeid(T)}] = pool;
+        }
+
+        template<typename T>
+        auto getPool() const -> SparseSet<T>*
+        {
+            auto const it = m_pools.find(std::type_index{typeid(T)});
+            return it != m_pools.end() ? static_cast<SparseSet<T>*>(it->second) : nullptr;
+        }
+
+    private:
+        std::unordered_map<std::type_index, ISparseSet*> m_pools;
+    };
+
+    template<typename Func>
+    auto measureNs(uint32_t iterations, size_t operations, Func&& fn) -> double
+    {
+        auto best = std::chrono::nanoseconds::max();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+        }
+        return static_cast<double>(best.count()) / static_cast<double>(operations);
+    }
+
+    auto report(std::string_view name, double legacyNs, double indexedNs) -> void
+    {
+        std::println("{:<28} {:>10.2f} {:>10.2f} {:>8.2f}x", name, legacyNs, indexedNs, legacyNs / indexedNs);
+    }
+
+    // Each sparse type is carried by a run of entities spawned together plus a few strays across the whole range.
+    // Compares the paged sparse arrays with one flat size_t per entity index up to the highest seen.
+    auto reportSparseMemory(uint32_t entityCount) -> void
+    {
+        auto registry = Registry{};
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            registry.create();
+        }
+
+        auto pagedBytes = size_t{0};
+        auto flatBytes = size_t{0};
+        auto const addType = [&]<size_t I>(std::integral_constant<size_t, I>) {
+            auto const runStart = static_cast<uint32_t>((I * 2654435761u) % entityCount);
+            auto maxIndex = uint32_t{0};
+            for (uint32_t j = 0; j < 256; ++j)
+            {
+                auto const index = (runStart + j) % entityCount;
+                registry.emplace<SparseTag<I>>(Entity{index, 0}, j);
+                maxIndex = std::max(maxIndex, index);
+            }
+            for (uint32_t j = 1; j <= 8; ++j)
+            {
+                auto const index = (runStart + 256 + j * (entityCount / 9)) % entityCount;
+                if (!registry.allOf<SparseTag<I>>(Entity{index, 0}))
+                {
+                    registry.emplace<SparseTag<I>>(Entity{index, 0}, j);
+                    maxIndex = std::max(maxIndex, index);
+                }
+            }
+            pagedBytes += registry.getPool<SparseTag<I>>()->sparseBytes();
+            flatBytes += (size_t{maxIndex} + 1) * sizeof(size_t);
+        };
+        [&]<size_t... Is>(std::index_sequence<Is...>) {
+            (addType(std::integral_constant<size_t, Is>{}), ...);
+        }(std::make_index_sequence<kSparseTypeCount>{});
+
+        std::println("sparse arrays, {} entities, {} types of ~264 entities each:", entityCount, kSparseTypeCount);
+        std::println("{:<28} {:>10.2f} MiB", "flat size_t per index", static_cast<double>(flatBytes) / (1024.0 * 1024.0));
+        std::println("{:<28} {:>10.2f} MiB ({:.1f}x smaller)", "paged uint32_t",
+            static_cast<double>(pagedBytes) / (1024.0 * 1024.0), static_cast<double>(flatBytes) / static_cast<double>(pagedBytes));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = BenchOptions{};
+    if (!parseArgs(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    auto registry = Registry{};
+    auto entities = std::vector<Entity>{};
+    entities.reserve(options.entities);
+    for (uint32_t i = 0; i < options.entities; ++i)
+    {
+        auto const entity = registry.create();
+        registry.emplace<Position>(entity, static_cast<float>(i), 0.0f, 0.0f);
+        registry.emplace<Parent>(entity, i > 0 ? entities[(i - 1) / 2] : NullEntity);
+        if (i % 2 == 0)
+        {
+            registry.emplace<Velocity>(entity, 1.0f, 0.0f, 0.0f);
+        }
+        if (i % 3 == 0)
+        {
+            registry.emplace<Health>(entity);
+        }
+        entities.push_back(entity);
+    }
+
+    auto legacy = TypeIndexPools{};
+    legacy.add(registry.getPool<Position>());
+    legacy.add(registry.getPool<Velocity>());
+    legacy.add(registry.getPool<Health>());
+    legacy.add(registry.getPool<Parent>());
+
+    auto sink = 0.0f;
+    auto const count = entities.size();
+    std::println("bench-ecs: {} entities, best of {} runs, ns per entity", options.entities, options.iterations);
+    std::println("{:<28} {:>10} {:>10} {:>9}", "", "type_index", "type id", "speedup");
+
+    // get<T>: the per-entity lookup updateTransform and extractFrameSnapshot are built from
+    report("get<Position>",
+        measureNs(options.iterations, count, [&] {
+            for (auto const entity : entities)
+            {
+                sink += legacy.getPool<Position>()->get(entity).x;
+            }
+        }),
+        measureNs(options.iterations, count, [&] {
+            for (auto const entity : entities)
+            {
+                sink += registry.get<Position>(entity).x;
+            }
+        }));
+
+    report("allOf<Position, Velocity, Health>",
+        measureNs(options.iterations, count, [&] {
+            for (auto const entity : entities)
+            {
+                auto const* position = legacy.getPool<Position>();
+                auto const* velocity = legacy.getPool<Velocity>();
+                auto const* health = legacy.getPool<Health>();
+                sink += (registry.valid(entity) && position && position->contains(entity)
+                    && velocity && velocity->contains(entity) && health && health->contains(entity)) ? 1.0f : 0.0f;
+            }
+        }),
+        measureNs(options.iterations, count, [&] {
+            for (auto const entity : entities)
+            {
+                sink += registry.allOf<Position, Velocity, Health>(entity) ? 1.0f : 0.0f;
+            }
+        }));
+
+    // Walk to the root the way isDescendant does, one parent lookup per step
+    report("parent walk (depth ~log2 N)",
+        measureNs(options.iterations, count, [&] {
+            for (auto entity : entities)
+            {
+                while (!isNull(entity))
+                {
+                    entity = legacy.getPool<Parent>()->get(entity).entity;
+                    sink += 1.0f;
+                }
+            }
+        }),
+        measureNs(options.iterations, count, [&] {
+            for (auto entity : entities)
+            {
+                while (!isNull(entity))
+                {
+                    entity = registry.get<Parent>(entity).entity;
+                    sink += 1.0f;
+                }
+            }
+        }));
+
+    report("view<Position, Velocity>",
+        measureNs(options.iterations, count, [&] {
+            auto const view = MultiView<Position, Velocity>{legacy.getPool<Position>(), legacy.getPool<Velocity>()};
+            view.each([&](Entity, Position& position, Velocity& velocity) { sink += position.x + velocity.x; });
+        }),
+        measureNs(options.iterations, count, [&] {
+            registry.view<Position, Velocity>().each([&](Entity, Position& position, Velocity& velocity) { sink += position.x + velocity.x; });
+        }));
+
+    std::println("(checksum {})", sink);
+
+    reportSparseMemory(options.memoryEntities);
+    return 0;
+}
@@ -3,22 +3,46 @@
 #include <stb_image_write.h>
 #include <filesystem>
 #include <fstream>
+#include <cstddef>
 #include <cstring>
 #include <cmath>
 #include <cctype>
 #include <algorithm>
 #include <array>
-
+#include <atomic>
+#include <format>
+#include <chrono>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <thread>
+
+#include <core/file/mapped-file.hpp>
+#include <core/thread/thread-pool.hpp>
+#include <core/tools/hash.hpp>
 #include <core/tools/uuid.hpp>
 #include <asset/asset.hpp>
 #include <asset/texture-asset.hpp>
 #include <asset/static-mesh-asset.hpp>
 #include <asset/material-asset.hpp>
+#include <asset/scene-asset.hpp>
+#include <asset/asset-registry.hpp>
 #include <asset/blob-header.hpp>
 #include <asset/ddc/ddc-key.hpp>
 #include <asset/ddc/ddc-utils.hpp>
+#include <asset/ddc/local-ddc.hpp>
+#include <asset/asset-cache.hpp>
+#include <asset/asset-directory-index.hpp>
 #include <asset/asset-manager.hpp>
+#include <asset/asset-usage.hpp>
 #include <asset/importer/gltf-importer.hpp>
+#include <asset/texture/bc-encoder.hpp>
+#include <asset/texture/mip-generator.hpp>
+#include <asset/texture/texture-analysis.hpp>
+#include <asset/texture/texture-container.hpp>
+#include <asset/texture/texture-streaming.hpp>
+#include <asset/mesh/meshlet-culling.hpp>
+#include <asset/mesh/tangent-generator.hpp>
 
 namespace fs = std::filesystem;
 
@@ -39,6 +63,33 @@ auto createMinimalPNG(std::string const& path) -> void
     file.write(reinterpret_cast<char const*>(pngData), sizeof(pngData));
 }
 
+// Helper: Write the texture .asset for srcFile (srcFile + ".asset" unless assetFile is given) and return its path.
+// Rewriting an existing file keeps its GUID, the way re-saving the asset in the editor would.
+auto writeTextureAssetFile(std::string const& srcFile, april::asset::TextureImportSettings const& settings = {}, std::string assetFile = {}) -> std::string
+{
+    if (assetFile.empty())
+    {
+        assetFile = srcFile + ".asset";
+    }
+
+    auto asset = april::asset::TextureAsset{};
+    if (auto existing = std::ifstream{assetFile})
+    {
+        auto const json = nlohmann::json::parse(existing, nullptr, false);
+        if (!json.is_discarded())
+        {
+            asset.deserializeJson(json);
+        }
+    }
+    asset.setSourcePath(srcFile);
+    asset.m_settings = settings;
+
+    auto json = nlohmann::json{};
+    asset.serializeJson(json);
+    std::ofstream{assetFile} << json.dump(2);
+    return assetFile;
+}
+
 // Helper: Create a 2x2 RGBA PNG for more thorough testing
 auto create2x2PNG(std::string const& path) -> void
 {
@@ -202,6 +253,229 @@ auto createTangentGLTF(std::string const& path) -> void
     file.write(json.data(), static_cast<std::streamsize>(json.size()));
 }
 
+struct TangentGrid
+{
+    std::vector<float> vertices{}; // pos(3) + norm(3) + tan(4) + uv(2)
+    std::vector<uint32_t> indices{};
+};
+
+// Helper: cells x cells grid over [0, 1]^2 with u along +x (or -x when mirrored). curved bends it into a height field.
+auto createTangentGrid(uint32_t cells, bool mirrorU, bool curved) -> TangentGrid
+{
+    auto grid = TangentGrid{};
+    auto const side = cells + 1;
+    grid.vertices.reserve(size_t{side} * side * 12);
+    for (uint32_t y = 0; y < side; ++y)
+    {
+        for (uint32_t x = 0; x < side; ++x)
+        {
+            auto const fx = static_cast<float>(x) / static_cast<float>(cells);
+            auto const fy = static_cast<float>(y) / static_cast<float>(cells);
+            auto const height = curved ? 0.1f * std::sin(fx * 6.0f) * std::cos(fy * 4.0f) : 0.0f;
+            auto const dzdx = curved ? 0.6f * std::cos(fx * 6.0f) * std::cos(fy * 4.0f) : 0.0f;
+            auto const dzdy = curved ? -0.4f * std::sin(fx * 6.0f) * std::sin(fy * 4.0f) : 0.0f;
+            auto const invLength = 1.0f / std::sqrt(dzdx * dzdx + dzdy * dzdy + 1.0f);
+
+            auto const vertex = std::array<float, 12>{
+                fx, fy, height,
+                -dzdx * invLength, -dzdy * invLength, invLength,
+                0.0f, 0.0f, 0.0f, 0.0f,
+                mirrorU ? -fx : fx, fy
+            };
+            grid.vertices.insert(grid.vertices.end(), vertex.begin(), vertex.end());
+        }
+    }
+
+    grid.indices.reserve(size_t{cells} * cells * 6);
+    for (uint32_t y = 0; y < cells; ++y)
+    {
+        for (uint32_t x = 0; x < cells; ++x)
+        {
+            auto const i = y * side + x;
+            for (auto const index : {i, i + 1, i + side + 1, i, i + side + 1, i + side})
+            {
+                grid.indices.push_back(index);
+            }
+        }
+    }
+    return grid;
+}
+
+// Helper: Gently curved cells x cells grid shared by the grid glTF/GLB writers.
+auto buildGridGeometry(uint32_t cells, std::vector<float>& positions, std::vector<uint32_t>& indices) -> void
+{
+    for (uint32_t y = 0; y <= cells; ++y)
+    {
+        for (uint32_t x = 0; x <= cells; ++x)
+        {
+            auto const u = static_cast<float>(x) / static_cast<float>(cells);
+            auto const v = static_cast<float>(y) / static_cast<float>(cells);
+            positions.push_back(u);
+            positions.push_back(v);
+            positions.push_back(0.05f * std::sin(u * 3.14159265f) * std::sin(v * 3.14159265f));
+        }
+    }
+
+    for (uint32_t y = 0; y < cells; ++y)
+    {
+        for (uint32_t x = 0; x < cells; ++x)
+        {
+            auto const i0 = y * (cells + 1) + x;
+            auto const i1 = i0 + 1;
+            auto const i2 = i0 + cells + 1;
+            auto const i3 = i2 + 1;
+            indices.insert(indices.end(), {i0, i1, i2, i2, i1, i3});
+        }
+    }
+}
+
+// Helper: Create a gently curved grid of cells x cells quads (positions only, uint32 indices)
+auto createGridGLTF(std::string const& path, uint32_t cells) -> void
+{
+    auto const baseDir = fs::path{path}.parent_path();
+    auto const binName = fs::path{path}.stem().string() + ".bin";
+
+    auto positions = std::vector<float>{};
+    auto indices = std::vector<uint32_t>{};
+    buildGridGeometry(cells, positions, indices);
+
+    auto const positionBytes = positions.size() * sizeof(float);
+    auto const indexBytes = indices.size() * sizeof(uint32_t);
+    {
+        auto binFile = std::ofstream{(baseDir / binName).string(), std::ios::binary};
+        binFile.write(reinterpret_cast<char const*>(positions.data()), static_cast<std::streamsize>(positionBytes));
+        binFile.write(reinterpret_cast<char const*>(indices.data()), static_cast<std::streamsize>(indexBytes));
+    }
+
+    auto json = std::string{};
+    json += "{\n";
+    json += "  \"asset\": { \"version\": \"2.0\" },\n";
+    json += std::format("  \"buffers\": [ {{ \"uri\": \"{}\", \"byteLength\": {} }} ],\n", binName, positionBytes + indexBytes);
+    json += "  \"bufferViews\": [\n";
+    json += std::format("    {{ \"buffer\": 0, \"byteOffset\": 0, \"byteLength\": {} }},\n", positionBytes);
+    json += std::format("    {{ \"buffer\": 0, \"byteOffset\": {}, \"byteLength\": {} }}\n", positionBytes, indexBytes);
+    json += "  ],\n";
+    json += "  \"accessors\": [\n";
+    json += std::format("    {{ \"bufferView\": 0, \"componentType\": 5126, \"count\": {}, \"type\": \"VEC3\" }},\n", positions.size() / 3);
+    json += std::format("    {{ \"bufferView\": 1, \"componentType\": 5125, \"count\": {}, \"type\": \"SCALAR\" }}\n", indices.size());
+    json += "  ],\n";
+    json += "  \"meshes\": [ { \"primitives\": [ { \"attributes\": { \"POSITION\": 0 }, \"indices\": 1 } ] } ],\n";
+    json += "  \"nodes\": [ { \"mesh\": 0 } ],\n";
+    json += "  \"scenes\": [ { \"nodes\": [0] } ],\n";
+    json += "  \"scene\": 0\n";
+    json += "}\n";
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+}
+
+// Helper: The createGridGLTF grid packed into a GLB. With an image, a PNG is embedded through a bufferView
+// after the geometry and bound as the base color texture of the only material.
+auto createGridGLB(std::string const& path, uint32_t cells, std::vector<char> const& embeddedPng = {}) -> void
+{
+    auto positions = std::vector<float>{};
+    auto indices = std::vector<uint32_t>{};
+    buildGridGeometry(cells, positions, indices);
+
+    auto const positionBytes = positions.size() * sizeof(float);
+    auto const indexBytes = indices.size() * sizeof(uint32_t);
+    auto bin = std::vector<char>(positionBytes + indexBytes);
+    std::memcpy(bin.data(), positions.data(), positionBytes);
+    std::memcpy(bin.data() + positionBytes, indices.data(), indexBytes);
+    bin.insert(bin.end(), embeddedPng.begin(), embeddedPng.end());
+    auto const binLength = bin.size();
+    bin.resize((bin.size() + 3) & ~size_t{3}, '\0');
+
+    auto json = std::string{};
+    json += "{";
+    json += "\"asset\":{\"version\":\"2.0\"},";
+    json += std::format("\"buffers\":[{{\"byteLength\":{}}}],", binLength);
+    json += "\"bufferViews\":[";
+    json += std::format("{{\"buffer\":0,\"byteOffset\":0,\"byteLength\":{}}},", positionBytes);
+    json += std::format("{{\"buffer\":0,\"byteOffset\":{},\"byteLength\":{}}}", positionBytes, indexBytes);
+    if (!embeddedPng.empty())
+    {
+        json += std::format(",{{\"buffer\":0,\"byteOffset\":{},\"byteLength\":{}}}", positionBytes + indexBytes, embeddedPng.size());
+    }
+    json += "],";
+    json += "\"accessors\":[";
+    json += std::format("{{\"bufferView\":0,\"componentType\":5126,\"count\":{},\"type\":\"VEC3\"}},", positions.size() / 3);
+    json += std::format("{{\"bufferView\":1,\"componentType\":5125,\"count\":{},\"type\":\"SCALAR\"}}", indices.size());
+    json += "],";
+    if (!embeddedPng.empty())
+    {
+        json += "\"images\":[{\"name\":\"albedo\",\"bufferView\":2,\"mimeType\":\"image/png\"}],";
+        json += "\"textures\":[{\"source\":0}],";
+        json += "\"materials\":[{\"name\":\"grid\",\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":0}}}],";
+        json += "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1,\"material\":0}]}],";
+    }
+    else
+    {
+        json += "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1}]}],";
+    }
+    json += "\"nodes\":[{\"mesh\":0}],\"scenes\":[{\"nodes\":[0]}],\"scene\":0";
+    json += "}";
+    json.resize((json.size() + 3) & ~size_t{3}, ' ');
+
+    auto const writeUint32 = [](std::ofstream& file, uint32_t value)
+    {
+        file.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    };
+
+    auto file = std::ofstream{path, std::ios::binary};
+    writeUint32(file, 0x46546C67);
+    writeUint32(file, 2);
+    writeUint32(file, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+    writeUint32(file, static_cast<uint32_t>(json.size()));
+    writeUint32(file, 0x4E4F534A);
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    writeUint32(file, static_cast<uint32_t>(bin.size()));
+    writeUint32(file, 0x004E4942);
+    file.write(bin.data(), static_cast<std::streamsize>(bin.size()));
+}
+
+// Helper: Two meshes (a 4x4 grid and a triangle cut from it) placed by a small node tree.
+// The grid is instanced twice; node 4 is not part of the default scene.
+auto createMultiMeshGLTF(std::string const& path) -> void
+{
+    createGridGLTF(path, 4);
+
+    auto const binName = fs::path{path}.stem().string() + ".bin";
+    auto const positionBytes = 25 * 3 * sizeof(float);
+    auto const indexBytes = 4 * 4 * 6 * sizeof(uint32_t);
+
+    auto json = std::string{};
+    json += "{\n";
+    json += "  \"asset\": { \"version\": \"2.0\" },\n";
+    json += std::format("  \"buffers\": [ {{ \"uri\": \"{}\", \"byteLength\": {} }} ],\n", binName, positionBytes + indexBytes);
+    json += "  \"bufferViews\": [\n";
+    json += std::format("    {{ \"buffer\": 0, \"byteOffset\": 0, \"byteLength\": {} }},\n", positionBytes);
+    json += std::format("    {{ \"buffer\": 0, \"byteOffset\": {}, \"byteLength\": {} }}\n", positionBytes, indexBytes);
+    json += "  ],\n";
+    json += "  \"accessors\": [\n";
+    json += "    { \"bufferView\": 0, \"componentType\": 5126, \"count\": 25, \"type\": \"VEC3\" },\n";
+    json += "    { \"bufferView\": 1, \"componentType\": 5125, \"count\": 96, \"type\": \"SCALAR\" },\n";
+    json += "    { \"bufferView\": 1, \"componentType\": 5125, \"count\": 3, \"type\": \"SCALAR\" }\n";
+    json += "  ],\n";
+    json += "  \"meshes\": [\n";
+    json += "    { \"name\": \"Grid\", \"primitives\": [ { \"attributes\": { \"POSITION\": 0 }, \"indices\": 1 } ] },\n";
+    json += "    { \"name\": \"Triangle\", \"primitives\": [ { \"attributes\": { \"POSITION\": 0 }, \"indices\": 2 } ] }\n";
+    json += "  ],\n";
+    json += "  \"nodes\": [\n";
+    json += "    { \"name\": \"Root\", \"translation\": [1, 2, 3], \"children\": [1, 2, 3] },\n";
+    json += "    { \"name\": \"GridA\", \"mesh\": 0 },\n";
+    json += "    { \"name\": \"Triangle\", \"mesh\": 1, \"rotation\": [0, 0.70710678, 0, 0.70710678] },\n";
+    json += "    { \"name\": \"GridB\", \"mesh\": 0, \"scale\": [2, 2, 2] },\n";
+    json += "    { \"name\": \"Unused\", \"mesh\": 1 }\n";
+    json += "  ],\n";
+    json += "  \"scenes\": [ { \"nodes\": [0] } ],\n";
+    json += "  \"scene\": 0\n";
+    json += "}\n";
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+}
+
 auto readBinaryFile(std::string const& path) -> std::vector<std::byte>
 {
     auto file = std::ifstream{path, std::ios::binary | std::ios::ate};
@@ -280,6 +554,92 @@ auto findSponzaSourcePath() -> std::filesystem::path
 }
 
 // Helper: Create a dummy text file (for error testing)
+// Helper: Minimal DDS writer. dxgiFormat != 0 adds a DX10 header; otherwise fourCC selects the legacy format.
+auto writeDDS(
+    std::string const& path,
+    uint32_t width,
+    uint32_t height,
+    std::vector<std::vector<uint8_t>> const& levels,
+    uint32_t fourCC,
+    uint32_t dxgiFormat = 0
+) -> void
+{
+    auto header = std::array<uint32_t, 32>{};
+    header[0] = 0x20534444;                                  // "DDS "
+    header[1] = 124;                                         // dwSize
+    header[2] = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000;          // caps, height, width, pixel format, mip count
+    header[3] = height;
+    header[4] = width;
+    header[7] = static_cast<uint32_t>(levels.size());
+    header[19] = 32;                                         // ddspf.dwSize
+    header[20] = 0x4;                                        // DDPF_FOURCC
+    header[21] = dxgiFormat != 0 ? 0x30315844u : fourCC;     // "DX10"
+    header[27] = 0x1000;                                     // DDSCAPS_TEXTURE
+
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(reinterpret_cast<char const*>(header.data()), 128);
+    if (dxgiFormat != 0)
+    {
+        auto const dx10 = std::array<uint32_t, 5>{dxgiFormat, 3, 0, 1, 0};
+        file.write(reinterpret_cast<char const*>(dx10.data()), sizeof(dx10));
+    }
+    for (auto const& level : levels)
+    {
+        file.write(reinterpret_cast<char const*>(level.data()), static_cast<std::streamsize>(level.size()));
+    }
+}
+
+// Helper: Minimal KTX2 writer. Level data is stored smallest-first, as the spec recommends.
+auto writeKTX2(
+    std::string const& path,
+    uint32_t vkFormat,
+    uint32_t width,
+    uint32_t height,
+    std::vector<std::vector<uint8_t>> const& levels
+) -> void
+{
+    auto bytes = std::vector<uint8_t>{0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    auto const appendU32 = [&](uint32_t value)
+    {
+        auto const* p = reinterpret_cast<uint8_t const*>(&value);
+        bytes.insert(bytes.end(), p, p + 4);
+    };
+    auto const appendU64 = [&](uint64_t value)
+    {
+        auto const* p = reinterpret_cast<uint8_t const*>(&value);
+        bytes.insert(bytes.end(), p, p + 8);
+    };
+
+    for (auto const value : {vkFormat, 1u, width, height, 0u, 0u, 1u, static_cast<uint32_t>(levels.size()), 0u})
+    {
+        appendU32(value);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        appendU32(0); // dfd / kvd offsets and lengths
+    }
+    appendU64(0);
+    appendU64(0);
+
+    auto const indexOffset = bytes.size();
+    bytes.resize(bytes.size() + levels.size() * 24);
+
+    auto offsets = std::vector<uint64_t>(levels.size());
+    for (auto level = levels.size(); level-- > 0;)
+    {
+        offsets[level] = bytes.size();
+        bytes.insert(bytes.end(), levels[level].begin(), levels[level].end());
+    }
+    for (size_t level = 0; level < levels.size(); ++level)
+    {
+        auto const entry = std::array<uint64_t, 3>{offsets[level], levels[level].size(), levels[level].size()};
+        std::memcpy(bytes.data() + indexOffset + level * 24, entry.data(), sizeof(entry));
+    }
+
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
 auto createDummyFile(std::string const& path, std::string const& content) -> void
 {
     std::ofstream f(path);
@@ -292,9 +652,9 @@ TEST_SUITE("Asset System - Stage 3 & 4")
     {
         using namespace april::asset;
 
-        SUBCASE("Header size is fixed at 40 bytes")
+        SUBCASE("Header size is fixed at 48 bytes")
         {
-            CHECK(sizeof(TextureHeader) == 40);
+            CHECK(sizeof(TextureHeader) == 48);
         }
 
         SUBCASE("Header magic value is correct")
@@ -493,7 +853,7 @@ TEST_SUITE("Asset System - Stage 3 & 4")
                 asset->getHandle().toString(),
                 "TextureImporter",
                 1,
-                "stb_image@unknown|texblob@1",
+                "stb_image@unknown|texblob@2|bcenc@1|mipgen@1|texanalysis@1",
                 hashFileContents(asset->getSourcePath()),
                 hashJson(settingsJson),
                 hashDependencies({}),
@@ -503,6 +863,38 @@ TEST_SUITE("Asset System - Stage 3 & 4")
             CHECK(manager.getDdc().exists(key));
         }
 
+        SUBCASE("Block-aligned textures are compressed")
+        {
+            auto const alignedFile = testDir + "/aligned.png";
+            create4x4PNG(alignedFile);
+
+            auto writeCompressedAsset = [&](std::string const& path, std::string const& compression, bool normalMap) -> void
+            {
+                writeTextureAssetFile(alignedFile, {.generateMips = false, .compression = compression, .normalMap = normalMap}, path);
+            };
+
+            writeCompressedAsset(testDir + "/bc1.asset", "BC1", false);
+            writeCompressedAsset(testDir + "/bc7.asset", "BC7", false);
+            writeCompressedAsset(testDir + "/normal.asset", "BC7", true);
+
+            auto manager = AssetManager{testDir, cacheDir};
+
+            auto blob = std::vector<std::byte>{};
+            auto bc1 = manager.getTextureData(*manager.loadAsset<TextureAsset>(testDir + "/bc1.asset"), blob);
+            CHECK(bc1.header.format == PixelFormat::BC1UnormSrgb);
+            CHECK(bc1.header.dataSize == 8);
+
+            auto bc7 = manager.getTextureData(*manager.loadAsset<TextureAsset>(testDir + "/bc7.asset"), blob);
+            CHECK(bc7.header.format == PixelFormat::BC7UnormSrgb);
+            CHECK(bc7.header.dataSize == 16);
+
+            auto normal = manager.getTextureData(*manager.loadAsset<TextureAsset>(testDir + "/normal.asset"), blob);
+            CHECK(normal.header.format == PixelFormat::BC5Unorm);
+            CHECK(normal.header.channels == 2);
+            CHECK((normal.header.flags & TextureSrgb) == 0);
+            CHECK(normal.header.dataSize == 16);
+        }
+
         SUBCASE("Invalid image returns empty payload")
         {
             auto badAssetFile = testDir + "/bad.asset";
@@ -530,128 +922,1547 @@ TEST_SUITE("Asset System - Stage 3 & 4")
         fs::remove_all(cacheDir);
     }
 
-    TEST_CASE("AssetManager - Texture Loading")
+    TEST_CASE("BC Encoder - Block Round Trip")
     {
         using namespace april::asset;
 
-        auto const testDir = std::string{"TestAssets_Manager"};
-        auto const cacheDir = std::string{"TestCache_Manager"};
-        auto const srcFile = testDir + "/hero.png";
-        auto const assetFile = testDir + "/hero.asset";
-
-        fs::remove_all(testDir);
-        fs::remove_all(cacheDir);
-        fs::create_directories(testDir);
-
-        createMinimalPNG(srcFile);
-
-        // Create .asset file
+        auto gradient = std::array<uint8_t, 64>{};
+        for (auto p = 0; p < 16; ++p)
         {
-            auto asset = TextureAsset{};
-            asset.setSourcePath(srcFile);
-            asset.m_settings.sRGB = true;
+            gradient[p * 4 + 0] = static_cast<uint8_t>(16 + p * 12);
+            gradient[p * 4 + 1] = static_cast<uint8_t>(32 + p * 10);
+            gradient[p * 4 + 2] = static_cast<uint8_t>(200 - p * 8);
+            gradient[p * 4 + 3] = static_cast<uint8_t>(255 - p * 8);
+        }
 
-            auto json = nlohmann::json{};
-            asset.serializeJson(json);
+        auto maxChannelError = [](std::array<uint8_t, 64> const& a, std::array<uint8_t, 64> const& b, int channels) -> int
+        {
+            auto worst = 0;
+            for (auto p = 0; p < 16; ++p)
+            {
+                for (auto c = 0; c < channels; ++c)
+                {
+                    worst = std::max(worst, std::abs(static_cast<int>(a[p * 4 + c]) - static_cast<int>(b[p * 4 + c])));
+                }
+            }
+            return worst;
+        };
 
-            std::ofstream file(assetFile);
-            file << json.dump(2);
+        SUBCASE("Format parsing and block sizes")
+        {
+            CHECK(parseBcFormat("bc7") == BcFormat::BC7);
+            CHECK(parseBcFormat("BC5") == BcFormat::BC5);
+            CHECK_FALSE(parseBcFormat("RGBA8").has_value());
+            CHECK(parseBcQuality("unknown") == BcQuality::Normal);
+            CHECK(getBcBlockSize(BcFormat::BC1) == 8);
+            CHECK(getBcBlockSize(BcFormat::BC4) == 8);
+            CHECK(getBcBlockSize(BcFormat::BC7) == 16);
+            CHECK(getBcSurfaceSize(BcFormat::BC7, 6, 1) == 32);
         }
 
-        SUBCASE("Load asset from file")
+        SUBCASE("Every format stays close to the source")
         {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<TextureAsset>(assetFile);
+            struct Expectation
+            {
+                BcFormat format;
+                int channels;
+                int tolerance;
+            };
 
-            REQUIRE(asset != nullptr);
-            CHECK(asset->getSourcePath() == srcFile);
-            CHECK(asset->getType() == AssetType::Texture);
-            CHECK(asset->m_settings.sRGB == true);
+            for (auto const& [format, channels, tolerance] : {
+                     Expectation{BcFormat::BC1, 3, 32},
+                     Expectation{BcFormat::BC3, 4, 32},
+                     Expectation{BcFormat::BC4, 1, 14},
+                     Expectation{BcFormat::BC5, 2, 14},
+                     Expectation{BcFormat::BC7, 4, 12}})
+            {
+                for (auto quality : {BcQuality::Fast, BcQuality::Normal, BcQuality::High})
+                {
+                    auto block = std::array<uint8_t, 16>{};
+                    auto decoded = std::array<uint8_t, 64>{};
+                    encodeBcBlock(format, gradient, quality, std::span{block}.first(getBcBlockSize(format)));
+                    REQUIRE(decodeBcBlock(format, block, decoded));
+                    CHECK(maxChannelError(gradient, decoded, channels) <= tolerance);
+                }
+            }
         }
 
-        SUBCASE("Get texture data returns valid payload")
+        SUBCASE("Constant blocks are reproduced exactly by BC7")
         {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<TextureAsset>(assetFile);
-            REQUIRE(asset != nullptr);
-
-            auto blob = std::vector<std::byte>{};
-            auto payload = manager.getTextureData(*asset, blob);
+            auto constant = std::array<uint8_t, 64>{};
+            for (auto p = 0; p < 16; ++p)
+            {
+                constant[p * 4 + 0] = 90;
+                constant[p * 4 + 1] = 140;
+                constant[p * 4 + 2] = 211;
+                constant[p * 4 + 3] = 255;
+            }
 
-            CHECK(payload.isValid());
-            CHECK(payload.header.width == 1);
-            CHECK(payload.header.height == 1);
-            CHECK(payload.header.channels == 4);
-            CHECK(payload.header.format == PixelFormat::RGBA8UnormSrgb);
-            CHECK(payload.pixelData.size() == 4);
+            auto block = std::array<uint8_t, 16>{};
+            auto decoded = std::array<uint8_t, 64>{};
+            encodeBcBlock(BcFormat::BC7, constant, BcQuality::Normal, block);
+            REQUIRE(decodeBcBlock(BcFormat::BC7, block, decoded));
+            CHECK(maxChannelError(constant, decoded, 4) <= 1);
         }
 
-        SUBCASE("Register and retrieve asset by UUID")
+        SUBCASE("BC1 keeps punch-through alpha")
         {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<TextureAsset>(assetFile);
-            REQUIRE(asset != nullptr);
+            auto cutout = gradient;
+            cutout[3] = 0;
+            cutout[7] = 0;
+
+            auto block = std::array<uint8_t, 8>{};
+            auto decoded = std::array<uint8_t, 64>{};
+            encodeBcBlock(BcFormat::BC1, cutout, BcQuality::Normal, block);
+            REQUIRE(decodeBcBlock(BcFormat::BC1, block, decoded));
+            CHECK(decoded[3] == 0);
+            CHECK(decoded[7] == 0);
+            CHECK(decoded[11] == 255);
+        }
 
-            auto uuid = asset->getHandle();
-            manager.registerAssetPath(uuid, assetFile);
+        SUBCASE("Surface compression pads partial blocks")
+        {
+            auto pixels = std::vector<uint8_t>(6 * 5 * 4, 128);
+            auto compressed = compressBcSurface(BcFormat::BC4, pixels, 6, 5, BcQuality::Fast);
+            CHECK(compressed.size() == getBcSurfaceSize(BcFormat::BC4, 6, 5));
 
-            auto retrieved = manager.getAsset<TextureAsset>(uuid);
-            REQUIRE(retrieved != nullptr);
-            CHECK(retrieved->getHandle() == uuid);
+            auto decoded = std::array<uint8_t, 64>{};
+            REQUIRE(decodeBcBlock(BcFormat::BC4, std::span{compressed}.last(8), decoded));
+            CHECK(decoded[0] == 128);
         }
-
-        fs::remove_all(testDir);
-        fs::remove_all(cacheDir);
     }
 
-    TEST_CASE("Mip Level Calculation")
+    TEST_CASE("TextureImporter - Content Analysis")
     {
         using namespace april::asset;
 
-        auto const testDir = std::string{"TestAssets_Mips"};
-        auto const cacheDir = std::string{"TestCache_Mips"};
-
+        auto const testDir = std::string{"TestAssets_TextureAnalysis"};
+        auto const cacheDir = std::string{"TestCache_TextureAnalysis"};
         fs::remove_all(testDir);
         fs::remove_all(cacheDir);
         fs::create_directories(testDir);
 
-        SUBCASE("1x1 texture has 1 mip level")
+        // 8x8 image whose texel (x, y) is texel(x, y) as RGBA.
+        auto const writeImage = [&](std::string const& name, auto texel)
         {
-            auto srcFile = testDir + "/1x1.png";
-            createMinimalPNG(srcFile);
-
-            auto assetFile = testDir + "/1x1.asset";
-            auto asset = TextureAsset{};
-            asset.setSourcePath(srcFile);
-            asset.m_settings.generateMips = true;
-
+            auto pixels = std::vector<unsigned char>(8 * 8 * 4);
+            for (auto y = 0; y < 8; ++y)
             {
-                auto json = nlohmann::json{};
-                asset.serializeJson(json);
-                std::ofstream file(assetFile);
-                file << json.dump(2);
+                for (auto x = 0; x < 8; ++x)
+                {
+                    auto const value = texel(x, y);
+                    std::memcpy(&pixels[(y * 8 + x) * 4], value.data(), 4);
+                }
             }
+            auto const path = testDir + "/" + name + ".png";
+            stbi_write_png(path.c_str(), 8, 8, 4, pixels.data(), 8 * 4);
+            return path;
+        };
 
-            auto manager = AssetManager{testDir, cacheDir};
-            auto loaded = manager.loadAsset<TextureAsset>(assetFile);
-            REQUIRE(loaded != nullptr);
+        auto const writeTextureAsset = [](std::string const& source, std::string const& compression, bool sRGB, bool analyze = true)
+        {
+            return writeTextureAssetFile(source, {.sRGB = sRGB, .compression = compression, .analyzeContent = analyze},
+                                         source + "." + compression + (analyze ? "" : ".raw") + ".asset");
+        };
 
-            auto blob = std::vector<std::byte>{};
-            auto payload = manager.getTextureData(*loaded, blob);
+        using Texel = std::array<uint8_t, 4>;
+        auto const constant = writeImage("constant", [](int, int) { return Texel{200, 100, 50, 255}; });
+        auto const occlusion = writeImage("occlusion", [](int x, int y) { return Texel{static_cast<uint8_t>(x * 30 + y), 0, 0, 255}; });
+        auto const twoChannel = writeImage("two", [](int x, int y) { return Texel{static_cast<uint8_t>(x * 30), static_cast<uint8_t>(y * 30), 0, 255}; });
+        auto const opaque = writeImage("opaque", [](int x, int y) { return Texel{static_cast<uint8_t>(x * 30), static_cast<uint8_t>(y * 30), 77, 255}; });
+        auto const gray = writeImage("gray", [](int x, int y) { auto const v = static_cast<uint8_t>(x * 16 + y); return Texel{v, v, v, 255}; });
+
+        auto manager = AssetManager{testDir, cacheDir};
+        auto const cook = [&](std::string const& assetPath, std::vector<std::byte>& blob)
+        {
+            auto asset = manager.loadAsset<TextureAsset>(assetPath);
+            REQUIRE(asset != nullptr);
+            return manager.getTextureData(*asset, blob);
+        };
 
+        SUBCASE("Constant images collapse to one texel")
+        {
+            auto blob = std::vector<std::byte>{};
+            auto const payload = cook(writeTextureAsset(constant, "BC7", true), blob);
+            REQUIRE(payload.isValid());
+            CHECK(payload.header.width == 1);
+            CHECK(payload.header.height == 1);
             CHECK(payload.header.mipLevels == 1);
-            CHECK(payload.header.dataSize == 4);
+            CHECK(payload.header.format == PixelFormat::RGBA8UnormSrgb);
+            CHECK((payload.header.flags & TextureConstant) != 0);
+            CHECK((payload.header.flags & TextureSrgb) != 0);
+            CHECK(payload.header.minValue == Texel{200, 100, 50, 255});
+            REQUIRE(payload.pixelData.size() == 4);
+            CHECK(std::to_integer<uint8_t>(payload.pixelData[0]) == 200);
+            CHECK(std::to_integer<uint8_t>(payload.pixelData[3]) == 255);
         }
 
-        SUBCASE("2x2 texture generates 2 mip levels when enabled")
+        SUBCASE("Disabled analysis keeps the full texture")
         {
-            auto srcFile = testDir + "/2x2.png";
-            create2x2PNG(srcFile);
-
-            auto assetFile = testDir + "/2x2.asset";
-            auto asset = TextureAsset{};
-            asset.setSourcePath(srcFile);
-            asset.m_settings.generateMips = true;
+            auto blob = std::vector<std::byte>{};
+            auto const payload = cook(writeTextureAsset(constant, "BC7", true, false), blob);
+            CHECK(payload.header.width == 8);
+            CHECK(payload.header.format == PixelFormat::BC7UnormSrgb);
+            CHECK((payload.header.flags & TextureAnalyzed) == 0);
+        }
+
+        SUBCASE("Red-only linear content is stored as R8 or BC4")
+        {
+            auto blob = std::vector<std::byte>{};
+            auto const raw = cook(writeTextureAsset(occlusion, "RGBA8", false), blob);
+            CHECK(raw.header.format == PixelFormat::R8Unorm);
+            CHECK(raw.header.channels == 1);
+            CHECK(raw.header.dataSize == 64 + 16 + 4 + 1);
+            CHECK(std::to_integer<uint8_t>(raw.pixelData[9]) == 31); // x = 1, y = 1
+            CHECK(raw.header.isChannelConstant(1));
+            CHECK_FALSE(raw.header.isChannelConstant(0));
+
+            auto const compressed = cook(writeTextureAsset(occlusion, "BC7", false), blob);
+            CHECK(compressed.header.format == PixelFormat::BC4Unorm);
+            CHECK(compressed.header.dataSize == 4 * 8 + 3 * 8);
+        }
+
+        SUBCASE("Two-channel linear content is stored as RG8 or BC5")
+        {
+            auto blob = std::vector<std::byte>{};
+            CHECK(cook(writeTextureAsset(twoChannel, "RGBA8", false), blob).header.format == PixelFormat::RG8Unorm);
+            CHECK(cook(writeTextureAsset(twoChannel, "BC7", false), blob).header.format == PixelFormat::BC5Unorm);
+            // BC1 is already 8 bytes per block, BC5 would double it.
+            CHECK(cook(writeTextureAsset(twoChannel, "BC1", false), blob).header.format == PixelFormat::BC1Unorm);
+            // There is no sRGB two-channel format.
+            CHECK(cook(writeTextureAsset(twoChannel, "RGBA8", true), blob).header.format == PixelFormat::RGBA8UnormSrgb);
+        }
+
+        SUBCASE("Opaque BC3 becomes BC1 and findings are recorded")
+        {
+            auto blob = std::vector<std::byte>{};
+            auto const payload = cook(writeTextureAsset(opaque, "BC3", true), blob);
+            CHECK(payload.header.format == PixelFormat::BC1UnormSrgb);
+            CHECK((payload.header.flags & TextureOpaqueAlpha) != 0);
+            CHECK((payload.header.flags & TextureGrayscale) == 0);
+            CHECK(payload.header.isChannelConstant(2));
+            CHECK(payload.header.maxValue[0] == 210);
+
+            auto const grayscale = cook(writeTextureAsset(gray, "BC7", true), blob);
+            CHECK(grayscale.header.format == PixelFormat::BC7UnormSrgb);
+            CHECK((grayscale.header.flags & TextureGrayscale) != 0);
+        }
+
+        SUBCASE("Analysis matches a scalar scan for any width")
+        {
+            auto pixels = std::vector<uint8_t>(13 * 5 * 4);
+            for (size_t i = 0; i < pixels.size(); ++i)
+            {
+                pixels[i] = static_cast<uint8_t>((i * 37 + 11) % 251);
+            }
+            auto const info = analyzeTextureContent(pixels, 13, 5);
+            for (size_t c = 0; c < 4; ++c)
+            {
+                auto minimum = uint8_t{255};
+                auto maximum = uint8_t{0};
+                for (size_t i = c; i < pixels.size(); i += 4)
+                {
+                    minimum = std::min(minimum, pixels[i]);
+                    maximum = std::max(maximum, pixels[i]);
+                }
+                CHECK(info.minValue[c] == minimum);
+                CHECK(info.maxValue[c] == maximum);
+            }
+            CHECK_FALSE(info.grayscale);
+            CHECK_FALSE(info.isConstant());
+
+            // The last texel sits in the scalar tail.
+            auto grayPixels = std::vector<uint8_t>(5 * 4, 9);
+            CHECK(analyzeTextureContent(grayPixels, 5, 1).isConstant());
+            grayPixels[16] = 10;
+            CHECK_FALSE(analyzeTextureContent(grayPixels, 5, 1).grayscale);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetManager - Source Path Index")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_SourceIndex"};
+        auto const cacheDir = std::string{"TestCache_SourceIndex"};
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir + "/sub");
+
+        createMinimalPNG(testDir + "/a.png");
+        createMinimalPNG(testDir + "/b.png");
+
+        auto const assetFile = writeTextureAssetFile(testDir + "/a.png", {}, testDir + "/brick.asset");
+
+        auto manager = AssetManager{testDir, cacheDir};
+        auto asset = manager.loadAsset<TextureAsset>(assetFile);
+        REQUIRE(asset != nullptr);
+
+        // Lookups normalize the path and find assets by either their source or their asset path.
+        CHECK(manager.findAssetBySourcePath(testDir + "/sub/../a.png", AssetType::Texture) == asset);
+        CHECK(manager.findAssetBySourcePath(assetFile, AssetType::Texture) == asset);
+
+        // Re-registering with a new source replaces the old key instead of adding one.
+        writeTextureAssetFile(testDir + "/b.png", {}, assetFile);
+        manager.registerAssetPath(asset->getHandle(), assetFile);
+        CHECK(manager.findAssetBySourcePath(testDir + "/b.png", AssetType::Texture) == asset);
+        CHECK(manager.findAssetBySourcePath(testDir + "/a.png", AssetType::Texture) == nullptr);
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetCache - Sharded LRU and Budgets")
+    {
+        using namespace april::asset;
+
+        auto cache = AssetCache{};
+
+        auto texture = std::make_shared<TextureAsset>();
+        texture->setSourcePath("textures/brick.png");
+        cache.insert(texture);
+
+        // Lookups count hits and misses; stats are broken down by asset type.
+        CHECK(cache.find(texture->getHandle()) == texture);
+        CHECK(cache.find(april::core::UUID{}) == nullptr);
+        auto stats = cache.getStats();
+        CHECK(stats.hits == 1);
+        CHECK(stats.misses == 1);
+        CHECK(stats.countByType[static_cast<size_t>(AssetType::Texture)] == 1);
+        CHECK(stats.bytesByType[static_cast<size_t>(AssetType::Texture)] == texture->getMemoryUsage());
+        CHECK(stats.totalBytes == texture->getMemoryUsage());
+
+        // Emplacing a second copy of a cached GUID keeps the resident asset.
+        auto json = nlohmann::json{};
+        texture->serializeJson(json);
+        auto copy = std::make_shared<TextureAsset>();
+        REQUIRE(copy->deserializeJson(json));
+        REQUIRE(copy->getHandle() == texture->getHandle());
+        CHECK(cache.emplace(copy) == texture);
+
+        // With no budget, only assets someone still references stay cached.
+        auto unreferenced = std::make_shared<TextureAsset>();
+        auto const unreferencedGuid = unreferenced->getHandle();
+        cache.insert(unreferenced);
+        unreferenced.reset();
+        cache.setSettings(AssetCacheSettings{0});
+        CHECK(cache.contains(texture->getHandle()));
+        CHECK_FALSE(cache.contains(unreferencedGuid));
+        CHECK(cache.getStats().evictions == 1);
+
+        copy.reset();
+        auto const guid = texture->getHandle();
+        texture.reset();
+        CHECK(cache.trim() == 1);
+        CHECK(cache.getSize() == 0);
+        CHECK(cache.getStats().totalBytes == 0);
+        CHECK_FALSE(cache.contains(guid));
+
+        // Within a shard, the least recently used unreferenced asset goes first.
+        cache.setSettings(AssetCacheSettings{1ull << 30});
+        auto sameShard = std::vector<std::shared_ptr<TextureAsset>>{};
+        while (sameShard.size() < 3)
+        {
+            auto candidate = std::make_shared<TextureAsset>();
+            if (sameShard.empty()
+                || std::hash<april::core::UUID>{}(candidate->getHandle()) % AssetCache::kShardCount
+                    == std::hash<april::core::UUID>{}(sameShard.front()->getHandle()) % AssetCache::kShardCount)
+            {
+                sameShard.push_back(candidate);
+            }
+        }
+
+        auto guids = std::vector<april::core::UUID>{};
+        for (auto const& asset : sameShard)
+        {
+            guids.push_back(asset->getHandle());
+            cache.insert(asset);
+        }
+        static_cast<void>(cache.find(guids[0]));
+        sameShard.clear();
+
+        // Room for two of the three in this shard: guids[1] is now the least recently used.
+        auto const perAsset = TextureAsset{}.getMemoryUsage();
+        cache.setSettings(AssetCacheSettings{2 * perAsset * AssetCache::kShardCount});
+        CHECK(cache.contains(guids[0]));
+        CHECK_FALSE(cache.contains(guids[1]));
+        CHECK(cache.contains(guids[2]));
+    }
+
+    TEST_CASE("AssetManager - Directory Index Scan")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_DirectoryIndex"};
+        auto const cacheDir = std::string{"TestCache_DirectoryIndex"};
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        auto const writeAssetFile = [](std::string const& path, TextureAsset& asset)
+        {
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+            std::ofstream{path} << json.dump(2);
+        };
+        auto const indexKey = [](std::string const& path)
+        {
+            return april::VFS::resolvePath(path).lexically_normal().string();
+        };
+
+        auto const pathA = testDir + "/a.png.asset";
+        auto const pathB = testDir + "/b.png.asset";
+        auto textureA = TextureAsset{};
+        textureA.setSourcePath(testDir + "/a.png");
+        writeAssetFile(pathA, textureA);
+        auto textureB = TextureAsset{};
+        textureB.setSourcePath(testDir + "/b.png");
+        writeAssetFile(pathB, textureB);
+
+        auto const indexPath = fs::path{testDir} / "library/asset-db/directory-index.bin";
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            CHECK(manager.getAsset<TextureAsset>(textureA.getHandle()) != nullptr);
+        }
+
+        // The first scan records a stamp for every .asset file it parsed.
+        auto index = AssetDirectoryIndex{};
+        REQUIRE(index.load(indexPath));
+        CHECK(index.getSize() == 2);
+        auto const* stampA = index.find(indexKey(pathA));
+        REQUIRE(stampA != nullptr);
+        CHECK(stampA->guid == textureA.getHandle());
+        CHECK(stampA->type == AssetType::Texture);
+        CHECK(stampA->matches(*AssetDirectoryIndex::stat(pathA)));
+
+        // A rewritten file is parsed again and a deleted one drops out of the index.
+        auto replacement = TextureAsset{};
+        replacement.setSourcePath(testDir + "/replacement-with-a-longer-name.png");
+        writeAssetFile(pathB, replacement);
+        fs::remove(pathA);
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            CHECK(manager.getAsset<TextureAsset>(replacement.getHandle()) != nullptr);
+        }
+
+        REQUIRE(index.load(indexPath));
+        CHECK(index.getSize() == 1);
+        CHECK(index.find(indexKey(pathA)) == nullptr);
+        auto const* stampB = index.find(indexKey(pathB));
+        REQUIRE(stampB != nullptr);
+        CHECK(stampB->guid == replacement.getHandle());
+
+        // Stamps round-trip through the binary file unchanged.
+        index.update("extra.asset", AssetFileStamp{42, 7, textureA.getHandle(), AssetType::Material});
+        CHECK(index.isDirty());
+        REQUIRE(index.save(indexPath));
+        auto reloaded = AssetDirectoryIndex{};
+        REQUIRE(reloaded.load(indexPath));
+        auto const* extra = reloaded.find("extra.asset");
+        REQUIRE(extra != nullptr);
+        CHECK(extra->modifiedTime == 42);
+        CHECK(extra->fileSize == 7);
+        CHECK(extra->guid == textureA.getHandle());
+        CHECK(extra->type == AssetType::Material);
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetManager - Hot Reload")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_HotReload"};
+        auto const cacheDir = std::string{"TestCache_HotReload"};
+        auto const srcFile = testDir + "/hero.png";
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        createMinimalPNG(srcFile);
+        auto const assetFile = writeTextureAssetFile(srcFile, {.sRGB = true});
+
+        auto manager = AssetManager{testDir, cacheDir};
+        auto const asset = manager.loadAsset<TextureAsset>(assetFile);
+        REQUIRE(asset != nullptr);
+        auto const guid = asset->getHandle();
+
+        auto blob = std::vector<std::byte>{};
+        CHECK(manager.getTextureData(*asset, blob).header.width == 1);
+
+        auto const finishReloads = [&]()
+        {
+            while (manager.getPendingLoadCount() > 0)
+            {
+                std::this_thread::yield();
+            }
+            manager.processCompletedLoads();
+            return manager.takeReloadedAssets();
+        };
+
+        // A poll starts a stat sweep on a worker; the next poll starts the reloads it found.
+        auto const poll = [&]()
+        {
+            auto started = manager.pollSourceChanges();
+            april::core::ThreadPool::get().waitIdle();
+            return started + manager.pollSourceChanges();
+        };
+
+        // Disabled by default; once enabled, untouched files start nothing.
+        CHECK(poll() == 0);
+        manager.setHotReloadSettings({.enabled = true, .pollIntervalMs = 0.0});
+        CHECK(poll() == 0);
+
+        // A changed source recooks in the background and reports the asset once.
+        create2x2PNG(srcFile);
+        CHECK(poll() == 1);
+        CHECK(poll() == 0);
+        CHECK(finishReloads() == std::vector<april::core::UUID>{guid});
+        CHECK(manager.takeReloadedAssets().empty());
+        CHECK(manager.getTextureData(*asset, blob).header.width == 2);
+
+        // An edited .asset file replaces the cached asset with its new settings.
+        writeTextureAssetFile(srcFile, {.sRGB = false});
+        CHECK(poll() == 1);
+        CHECK(finishReloads() == std::vector<april::core::UUID>{guid});
+        auto const reloaded = manager.getAsset<TextureAsset>(guid);
+        REQUIRE(reloaded != nullptr);
+        CHECK(reloaded != asset);
+        CHECK(reloaded->m_settings.sRGB == false);
+        CHECK(manager.getTextureData(*reloaded, blob).header.format == PixelFormat::RGBA8Unorm);
+
+        // Assets evicted from the cache are no longer watched.
+        auto const otherFile = testDir + "/other.png";
+        createMinimalPNG(otherFile);
+        auto const otherGuid = manager.loadAsset<TextureAsset>(writeTextureAssetFile(otherFile))->getHandle();
+        manager.setCacheSettings({.budgetBytes = 0});
+        REQUIRE_FALSE(manager.isAssetLoaded(otherGuid));
+        create2x2PNG(otherFile);
+        CHECK(poll() == 0);
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("LocalDdc - Content Addressed Payloads")
+    {
+        using namespace april::asset;
+
+        auto const cacheDir = std::string{"TestCache_ContentDdc"};
+        fs::remove_all(cacheDir);
+
+        auto const toValue = [](std::string_view text)
+        {
+            auto value = DdcValue{};
+            auto const bytes = std::as_bytes(std::span{text.data(), text.size()});
+            value.bytes.assign(bytes.begin(), bytes.end());
+            return value;
+        };
+        auto const toString = [](DdcValue const& value)
+        {
+            return std::string{reinterpret_cast<char const*>(value.bytes.data()), value.bytes.size()};
+        };
+        auto const countContentFiles = [&]()
+        {
+            auto count = size_t{0};
+            for (auto const& entry : fs::recursive_directory_iterator{fs::path{cacheDir} / "content"})
+            {
+                count += entry.is_regular_file() ? 1 : 0;
+            }
+            return count;
+        };
+
+        auto ddc = LocalDdc{cacheDir};
+        ddc.put("TX|first", toValue("identical cooked payload"));
+        ddc.put("TX|second", toValue("identical cooked payload"));
+        ddc.put("TX|third", toValue("different cooked payload"));
+
+        // Identical payloads are stored once; every key still resolves to its bytes.
+        CHECK(countContentFiles() == 2);
+        auto const firstHash = ddc.getContentHash("TX|first");
+        REQUIRE(firstHash.has_value());
+        CHECK(ddc.getContentHash("TX|second") == firstHash);
+        CHECK(ddc.getContentHash("TX|third") != firstHash);
+        CHECK_FALSE(ddc.getContentHash("TX|missing").has_value());
+
+        auto value = DdcValue{};
+        REQUIRE(ddc.get("TX|second", value));
+        CHECK(toString(value) == "identical cooked payload");
+        CHECK(value.contentHash == *firstHash);
+        CHECK(value.contentHash == april::core::computeStringHash("identical cooked payload"));
+
+        REQUIRE(ddc.getRange("TX|second", 10, 6, value));
+        CHECK(toString(value) == "cooked");
+        CHECK_FALSE(ddc.getRange("TX|second", 20, 10, value));
+
+        // Writes a key file by hand: header (magic, version, flags, payload size, key hash) and payload.
+        auto const writeKeyFile = [&](std::string const& key, uint16_t version, uint16_t flags, std::string const& payload)
+        {
+            auto const keyHash = april::core::computeStringHash(key);
+            auto const path = fs::path{cacheDir} / keyHash.substr(0, 2) / keyHash.substr(2, 2) / (keyHash + ".bin");
+
+            auto const magic = uint32_t{0x30434444};
+            auto const payloadSize = uint64_t{payload.size()};
+            auto bytes = std::vector<char>(56 + payload.size());
+            std::memcpy(bytes.data(), &magic, sizeof(magic));
+            std::memcpy(bytes.data() + 4, &version, sizeof(version));
+            std::memcpy(bytes.data() + 6, &flags, sizeof(flags));
+            std::memcpy(bytes.data() + 8, &payloadSize, sizeof(payloadSize));
+            std::memcpy(bytes.data() + 16, keyHash.data(), keyHash.size());
+            std::memcpy(bytes.data() + 56, payload.data(), payload.size());
+            fs::create_directories(path.parent_path());
+            std::ofstream{path, std::ios::binary}.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        };
+
+        // Files written before content addressing hold their payload inline and still read.
+        {
+            auto const key = std::string{"TX|legacy"};
+            auto const payload = std::string{"legacy payload"};
+            writeKeyFile(key, 1, 0, payload);
+
+            CHECK(ddc.exists(key));
+            REQUIRE(ddc.get(key, value));
+            CHECK(toString(value) == payload);
+            CHECK(ddc.getContentHash(key) == april::core::computeStringHash(payload));
+            REQUIRE(ddc.getRange(key, 7, 7, value));
+            CHECK(toString(value) == "payload");
+        }
+
+        // A malformed reference reads as a miss instead of throwing.
+        for (auto const& reference : {std::string{"a"}, std::string(40, 'z')})
+        {
+            writeKeyFile("TX|broken", 2, 1, reference);
+            CHECK_FALSE(ddc.exists("TX|broken"));
+            CHECK_FALSE(ddc.get("TX|broken", value));
+            CHECK_FALSE(ddc.getRange("TX|broken", 0, 1, value));
+            CHECK_FALSE(ddc.prefetch("TX|broken"));
+            CHECK_FALSE(ddc.getContentHash("TX|broken").has_value());
+        }
+
+        // A damaged content blob is replaced by the next put of the same payload.
+        {
+            auto const contentPath = fs::path{cacheDir} / "content" / firstHash->substr(0, 2) / firstHash->substr(2, 2) / (*firstHash + ".bin");
+            REQUIRE(fs::exists(contentPath));
+            fs::resize_file(contentPath, 20);
+            CHECK_FALSE(ddc.get("TX|second", value));
+
+            ddc.put("TX|first", toValue("identical cooked payload"));
+            REQUIRE(ddc.get("TX|second", value));
+            CHECK(toString(value) == "identical cooked payload");
+        }
+
+        // A reference whose content is gone counts as a miss, so importers cook again.
+        fs::remove_all(fs::path{cacheDir} / "content");
+        CHECK_FALSE(ddc.exists("TX|first"));
+        CHECK_FALSE(ddc.get("TX|first", value));
+        CHECK(ddc.exists("TX|legacy"));
+
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetManager - Cooked Content Hash")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_ContentHash"};
+        auto const cacheDir = std::string{"TestCache_ContentHash"};
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        auto const writeTexture = [&](std::string const& name, bool sRGB)
+        {
+            auto const srcFile = testDir + "/" + name + ".png";
+            create2x2PNG(srcFile);
+            return writeTextureAssetFile(srcFile, {.sRGB = sRGB});
+        };
+        auto const brickFile = writeTexture("brick", true);
+        auto const brickCopyFile = writeTexture("brick-copy", true);
+        auto const brickLinearFile = writeTexture("brick-linear", false);
+
+        auto manager = AssetManager{testDir, cacheDir};
+        auto const brick = manager.loadAsset<TextureAsset>(brickFile);
+        auto const brickCopy = manager.loadAsset<TextureAsset>(brickCopyFile);
+        auto const brickLinear = manager.loadAsset<TextureAsset>(brickLinearFile);
+        REQUIRE(brick != nullptr);
+        REQUIRE(brickCopy != nullptr);
+        REQUIRE(brickLinear != nullptr);
+        CHECK_FALSE(manager.getCookedContentHash(brick->getHandle()).has_value());
+
+        auto blob = std::vector<std::byte>{};
+        CHECK(manager.getTextureData(*brick, blob).isValid());
+        CHECK(manager.getTextureData(*brickCopy, blob).isValid());
+        CHECK(manager.getTextureData(*brickLinear, blob).isValid());
+
+        // DDC hits on an unchanged source leave the registry journal as it was.
+        auto const journalPath = AssetRegistry::getJournalPath(fs::path{testDir} / "library/asset-db/registry.bin");
+        REQUIRE(fs::exists(journalPath));
+        auto const journaledSize = fs::file_size(journalPath);
+        CHECK(manager.getTextureData(*brick, blob).isValid());
+        CHECK(manager.getTextureData(*brickCopy, blob).isValid());
+        CHECK(fs::file_size(journalPath) == journaledSize);
+
+        // Separate assets with the same source and settings cook to one payload.
+        auto const brickHash = manager.getCookedContentHash(brick->getHandle());
+        REQUIRE(brickHash.has_value());
+        CHECK(manager.getCookedContentHash(brickCopy->getHandle()) == brickHash);
+        CHECK(manager.getCookedContentHash(brickLinear->getHandle()) != brickHash);
+
+        // Async loads carry the hash so the renderer can upload shared content once.
+        auto const request = manager.loadAssetAsync<TextureAsset>(brickCopyFile);
+        REQUIRE(request != nullptr);
+        request->wait();
+        CHECK(request->getState() == LoadState::Ready);
+        CHECK(request->getContentHash() == *brickHash);
+        manager.processCompletedLoads();
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetManager - Usage Recording and Prefetch")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Usage"};
+        auto const cacheDir = std::string{"TestCache_Usage"};
+        auto const manifestPath = testDir + "/level.usage.json";
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        auto const writeTexture = [&](std::string const& name)
+        {
+            auto const srcFile = testDir + "/" + name + ".png";
+            create2x2PNG(srcFile);
+            return writeTextureAssetFile(srcFile);
+        };
+        auto const floorFile = writeTexture("floor");
+        auto const wallFile = writeTexture("wall");
+
+        auto floorGuid = april::core::UUID{};
+        auto wallGuid = april::core::UUID{};
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            CHECK_FALSE(manager.isRecordingUsage());
+            manager.startUsageRecording();
+            CHECK(manager.isRecordingUsage());
+
+            auto const floor = manager.loadAsset<TextureAsset>(floorFile);
+            auto const wall = manager.loadAsset<TextureAsset>(wallFile);
+            REQUIRE(floor != nullptr);
+            REQUIRE(wall != nullptr);
+            floorGuid = floor->getHandle();
+            wallGuid = wall->getHandle();
+
+            auto blob = std::vector<std::byte>{};
+            CHECK(manager.getTextureData(*wall, blob).isValid());
+            CHECK(manager.getTextureData(*wall, blob).isValid());
+            CHECK(manager.getAsset<TextureAsset>(floorGuid) == floor);
+
+            // First touches only, in order, with the key the cooked data came from.
+            auto const manifest = manager.stopUsageRecording();
+            CHECK_FALSE(manager.isRecordingUsage());
+            REQUIRE(manifest.entries.size() == 3);
+            CHECK(manifest.entries[0].guid == floorGuid);
+            CHECK(manifest.entries[0].kind == AssetUsageKind::Metadata);
+            CHECK(manifest.entries[0].ddcKey.empty());
+            CHECK(manifest.entries[1].guid == wallGuid);
+            CHECK(manifest.entries[1].kind == AssetUsageKind::Metadata);
+            CHECK(manifest.entries[2].guid == wallGuid);
+            CHECK(manifest.entries[2].kind == AssetUsageKind::CookedData);
+            CHECK(manifest.entries[2].type == AssetType::Texture);
+            CHECK(manifest.entries[2].ddcKey.starts_with("TX|"));
+            CHECK(manifest.entries[1].timeMs <= manifest.entries[2].timeMs);
+
+            REQUIRE(manifest.save(manifestPath));
+        }
+
+        auto manifest = AssetUsageManifest{};
+        REQUIRE(manifest.load(manifestPath));
+        REQUIRE(manifest.entries.size() == 3);
+        CHECK(manifest.entries[2].guid == wallGuid);
+        CHECK(manifest.entries[2].kind == AssetUsageKind::CookedData);
+        CHECK_FALSE(manifest.entries[2].ddcKey.empty());
+
+        SUBCASE("Prefetch warms the cache without recording itself")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            manager.startUsageRecording();
+            manifest.entries.push_back({april::core::UUID{}, AssetType::Texture, AssetUsageKind::CookedData, {}, 0.0});
+            CHECK(manager.prefetchUsage(manifest) == 3);
+            while (manager.getPendingLoadCount() > 0)
+            {
+                std::this_thread::yield();
+            }
+            manager.processCompletedLoads();
+
+            CHECK(manager.isAssetLoaded(floorGuid));
+            CHECK(manager.isAssetLoaded(wallGuid));
+            CHECK(manager.stopUsageRecording().entries.empty());
+        }
+
+        SUBCASE("A stale key recooks the asset")
+        {
+            fs::remove_all(cacheDir);
+            manifest.entries[2].ddcKey = "TX|stale";
+
+            auto manager = AssetManager{testDir, cacheDir};
+            CHECK(manager.prefetchUsage(manifest) == 3);
+            while (manager.getPendingLoadCount() > 0)
+            {
+                std::this_thread::yield();
+            }
+            manager.processCompletedLoads();
+            CHECK(manager.getCookedContentHash(wallGuid).has_value());
+            CHECK_FALSE(manager.getCookedContentHash(floorGuid).has_value());
+        }
+
+        SUBCASE("A superseded key that is still cached recooks the asset")
+        {
+            // The wall is edited and cooked again into another cache, so the registry moves on to a new key
+            // while the recorded one stays behind in the original cache.
+            createMinimalPNG(testDir + "/wall.png");
+            auto const otherCacheDir = std::string{"TestCache_UsageEdited"};
+            fs::remove_all(otherCacheDir);
+            auto currentKey = std::string{};
+            {
+                auto manager = AssetManager{testDir, otherCacheDir};
+                manager.startUsageRecording();
+                auto blob = std::vector<std::byte>{};
+                REQUIRE(manager.getTextureData(*manager.getAsset<TextureAsset>(wallGuid), blob).isValid());
+                auto const recorded = manager.stopUsageRecording();
+                REQUIRE_FALSE(recorded.entries.empty());
+                currentKey = recorded.entries.back().ddcKey;
+            }
+            REQUIRE(currentKey != manifest.entries[2].ddcKey);
+
+            auto ddc = LocalDdc{cacheDir};
+            REQUIRE(ddc.exists(manifest.entries[2].ddcKey));
+            CHECK_FALSE(ddc.exists(currentKey));
+
+            {
+                auto manager = AssetManager{testDir, cacheDir};
+                CHECK(manager.prefetchUsage(manifest) == 3);
+                while (manager.getPendingLoadCount() > 0)
+                {
+                    std::this_thread::yield();
+                }
+                manager.processCompletedLoads();
+            }
+            CHECK(ddc.exists(currentKey));
+
+            fs::remove_all(otherCacheDir);
+        }
+
+        SUBCASE("Prefetch clamps empty and tail ranges to the file")
+        {
+            auto const blobFile = testDir + "/payload.bin";
+            auto const bytes = std::vector<char>(4096 * 2 + 100, 'x');
+            std::ofstream{blobFile, std::ios::binary}.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+            auto file = april::MappedFile{};
+            REQUIRE(file.open(blobFile));
+            file.prefetch(0, 0);
+            file.prefetch(4096, 0);
+            file.prefetch(4096 * 2 + 50, 4096);
+            file.prefetch(bytes.size() - 1, 1);
+            file.prefetch(bytes.size(), 16);
+            CHECK(file.getData().size() == bytes.size());
+            CHECK(std::memcmp(file.getData().data(), bytes.data(), bytes.size()) == 0);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("ImportSourceCache - One Parse Per Source")
+    {
+        using namespace april::asset;
+
+        auto cache = ImportSourceCache{};
+        auto loads = std::atomic<int>{0};
+        auto const load = [&] { ++loads; return std::make_shared<std::string const>("parsed"); };
+
+        // Cooks of sibling assets racing for one source wait for a single load.
+        auto threads = std::vector<std::thread>{};
+        for (int i = 0; i < 8; ++i)
+        {
+            threads.emplace_back([&] { CHECK(*cache.getOrLoad<std::string>("kit.gltf", load) == "parsed"); });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        CHECK(loads == 1);
+
+        auto const held = cache.getOrLoad<std::string>("kit.gltf", load);
+        CHECK(cache.getOrLoad<std::string>("other.gltf", load) != held);
+        CHECK(loads == 2);
+
+        // Released sources load again; holders keep the old parse alive.
+        cache.release("kit.gltf");
+        CHECK(cache.getOrLoad<std::string>("kit.gltf", load) != held);
+        CHECK(*held == "parsed");
+        CHECK(loads == 3);
+
+        // A failed load is remembered for the batch instead of retried by every sibling.
+        CHECK(cache.getOrLoad<std::string>("broken.gltf", [&] { ++loads; return std::shared_ptr<std::string const>{}; }) == nullptr);
+        CHECK(cache.getOrLoad<std::string>("broken.gltf", load) == nullptr);
+        CHECK(loads == 4);
+    }
+
+    TEST_CASE("AssetRegistry - Binary Image and Journal")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Registry"};
+        fs::remove_all(testDir);
+        fs::create_directories(testDir);
+
+        auto const registryPath = fs::path{testDir} / "registry.bin";
+        auto const journalPath = AssetRegistry::getJournalPath(registryPath);
+
+        auto texture = AssetRecord{};
+        texture.assetPath = "textures/brick.png.asset";
+        texture.sourcePath = "textures/brick.png";
+        texture.type = AssetType::Texture;
+        texture.lastSourceHash = "hash-brick";
+        texture.lastFingerprint = {{"Win64|BC7|Release", "fp-a"}, {"Linux|BC7|Release", "fp-b"}};
+        texture.ddcKeys = {{"Win64|BC7|Release", {"key-0", "key-1"}}};
+
+        auto material = AssetRecord{};
+        material.assetPath = "materials/brick.material.asset";
+        material.type = AssetType::Material;
+        material.deps = {Dependency{DepKind::Strong, AssetRef{texture.guid, 0}}, Dependency{DepKind::Weak, AssetRef{april::core::UUID{}, 3}}};
+        material.lastImportFailed = true;
+        material.lastErrorSummary = "missing texture";
+
+        auto const checkRecords = [&](AssetRegistry const& registry)
+        {
+            auto const loadedTexture = registry.findRecord(texture.guid);
+            REQUIRE(loadedTexture.has_value());
+            CHECK(loadedTexture->assetPath == texture.assetPath);
+            CHECK(loadedTexture->sourcePath == texture.sourcePath);
+            CHECK(loadedTexture->type == AssetType::Texture);
+            CHECK(loadedTexture->lastSourceHash == texture.lastSourceHash);
+            CHECK(loadedTexture->lastFingerprint == texture.lastFingerprint);
+            CHECK(loadedTexture->ddcKeys == texture.ddcKeys);
+
+            auto const loadedMaterial = registry.findRecord(material.guid);
+            REQUIRE(loadedMaterial.has_value());
+            REQUIRE(loadedMaterial->deps.size() == 2);
+            CHECK(loadedMaterial->deps[0].asset.guid == texture.guid);
+            CHECK(loadedMaterial->deps[1].kind == DepKind::Weak);
+            CHECK(loadedMaterial->deps[1].asset.subId == 3);
+            CHECK(loadedMaterial->lastImportFailed);
+            CHECK(loadedMaterial->lastErrorSummary == "missing texture");
+
+            CHECK(registry.getRecordCount() == 2);
+            CHECK(registry.getDependents(texture.guid) == std::vector<april::core::UUID>{material.guid});
+            CHECK(registry.findAssetPath(material.guid) == material.assetPath);
+            CHECK_FALSE(registry.contains(april::core::UUID{}));
+        };
+
+        SUBCASE("Updates are journaled and folded into the image on save")
+        {
+            {
+                auto registry = AssetRegistry{};
+                CHECK_FALSE(registry.load(registryPath));
+                registry.updateRecord(texture);
+                registry.updateRecord(material);
+                CHECK(fs::exists(journalPath));
+                CHECK_FALSE(fs::exists(registryPath));
+
+                // Rewriting a record with identical contents leaves the journal alone.
+                auto const journaledSize = fs::file_size(journalPath);
+                registry.updateRecord(texture);
+                CHECK(fs::file_size(journalPath) == journaledSize);
+            }
+
+            {
+                auto registry = AssetRegistry{};
+                REQUIRE(registry.load(registryPath));
+                checkRecords(registry);
+                REQUIRE(registry.save(registryPath));
+                CHECK(fs::exists(registryPath));
+                CHECK_FALSE(fs::exists(journalPath));
+                checkRecords(registry);
+
+                auto moved = texture;
+                moved.assetPath = "textures/moved.png.asset";
+                registry.updateRecord(moved);
+                CHECK(registry.findAssetPath(texture.guid) == moved.assetPath);
+            }
+
+            // A torn write at the end of the journal is dropped, the entries before it survive.
+            {
+                auto stream = std::ofstream{journalPath, std::ios::binary | std::ios::app};
+                auto const garbage = std::array<char, 7>{64, 0, 0, 0, 'A', 'P', 'R'};
+                stream.write(garbage.data(), garbage.size());
+            }
+            auto const journalSize = fs::file_size(journalPath);
+
+            auto registry = AssetRegistry{};
+            REQUIRE(registry.load(registryPath));
+            CHECK(registry.findAssetPath(texture.guid) == "textures/moved.png.asset");
+            CHECK(registry.getRecordCount() == 2);
+            CHECK(fs::file_size(journalPath) == journalSize - 7);
+        }
+
+        SUBCASE("Images encode deterministically and reject corruption")
+        {
+            auto const records = std::array<AssetRecord const*, 2>{&material, &texture};
+            auto const reversed = std::array<AssetRecord const*, 2>{&texture, &material};
+            auto const image = encodeRegistryImage(records);
+            CHECK(image == encodeRegistryImage(reversed));
+            CHECK(image.size() % 4 == 0);
+
+            auto const parsed = RegistryImage::parse(image);
+            REQUIRE(parsed.has_value());
+            CHECK(parsed->entries.size() == 2);
+            REQUIRE(parsed->find(material.guid) != nullptr);
+            CHECK(parsed->decode(*parsed->find(material.guid)).assetPath == material.assetPath);
+
+            auto truncated = image;
+            truncated.resize(image.size() - 8);
+            CHECK_FALSE(RegistryImage::parse(truncated).has_value());
+
+            // Point the first record's path past the end of the string pool.
+            auto corrupted = image;
+            auto header = RegistryHeader{};
+            std::memcpy(&header, corrupted.data(), sizeof(header));
+            auto const badString = RegistryString{static_cast<uint32_t>(header.stringPoolSize), 1};
+            std::memcpy(corrupted.data() + header.recordOffset + offsetof(RegistryRecordEntry, assetPath), &badString, sizeof(badString));
+            CHECK_FALSE(RegistryImage::parse(corrupted).has_value());
+        }
+
+        SUBCASE("JSON export round-trips")
+        {
+            auto registry = AssetRegistry{};
+            registry.updateRecord(texture);
+            registry.updateRecord(material);
+            auto const jsonPath = fs::path{testDir} / "registry.json";
+            REQUIRE(registry.exportJson(jsonPath));
+
+            auto imported = AssetRegistry{};
+            REQUIRE(imported.importJson(jsonPath));
+            checkRecords(imported);
+        }
+
+        SUBCASE("Legacy registry.json is removed only once the binary image is saved")
+        {
+            auto const assetRoot = fs::path{testDir} / "root";
+            auto const dbDir = assetRoot / "library/asset-db";
+            fs::create_directories(dbDir);
+
+            auto registry = AssetRegistry{};
+            registry.updateRecord(texture);
+            REQUIRE(registry.exportJson(dbDir / "registry.json"));
+
+            // A directory in the way of the temporary image makes the save fail.
+            fs::create_directories(dbDir / "registry.bin.tmp");
+            {
+                auto manager = AssetManager{assetRoot.string(), (fs::path{testDir} / "cache").string()};
+                manager.scanDirectory(assetRoot);
+            }
+            CHECK(fs::exists(dbDir / "registry.json"));
+            CHECK_FALSE(fs::exists(dbDir / "registry.bin"));
+
+            fs::remove_all(dbDir / "registry.bin.tmp");
+            {
+                auto manager = AssetManager{assetRoot.string(), (fs::path{testDir} / "cache").string()};
+                manager.scanDirectory(assetRoot);
+            }
+            CHECK_FALSE(fs::exists(dbDir / "registry.json"));
+            CHECK(fs::exists(dbDir / "registry.bin"));
+        }
+
+        fs::remove_all(testDir);
+    }
+
+    TEST_CASE("Texture Streaming - Mip Ranges and Residency")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_TextureStreaming"};
+        auto const cacheDir = std::string{"TestCache_TextureStreaming"};
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        SUBCASE("Mip ranges are read from the cooked blob")
+        {
+            auto pixels = std::vector<unsigned char>(64 * 64 * 4);
+            for (size_t i = 0; i < 64 * 64; ++i)
+            {
+                pixels[i * 4 + 0] = static_cast<unsigned char>(i % 64 * 4);
+                pixels[i * 4 + 1] = static_cast<unsigned char>(i / 64 * 4);
+                pixels[i * 4 + 2] = static_cast<unsigned char>(i % 251);
+                pixels[i * 4 + 3] = 255;
+            }
+            auto const srcFile = testDir + "/gradient.png";
+            stbi_write_png(srcFile.c_str(), 64, 64, 4, pixels.data(), 64 * 4);
+
+            auto const assetFile = writeTextureAssetFile(srcFile, {.compression = "RGBA8"}, testDir + "/gradient.asset");
+
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<TextureAsset>(assetFile);
+            REQUIRE(asset != nullptr);
+
+            auto fullBlob = std::vector<std::byte>{};
+            auto const full = manager.getTextureData(*asset, fullBlob);
+            REQUIRE(full.isValid());
+            REQUIRE(full.header.mipLevels == 7);
+
+            auto blob = std::vector<std::byte>{};
+            auto const mips = manager.getTextureMips(*asset, 16, blob);
+            REQUIRE(mips.isValid());
+            CHECK(mips.firstMip == 2);
+            CHECK(mips.header.width == 16);
+            CHECK(mips.header.height == 16);
+            CHECK(mips.header.mipLevels == 5);
+            CHECK(mips.storedHeader.width == 64);
+            CHECK(mips.storedHeader.mipLevels == 7);
+            CHECK(mips.header.dataSize == getMipChainSize(full.header, 2));
+            REQUIRE(mips.pixelData.size() == getMipChainSize(full.header, 2));
+            auto const offset = full.pixelData.size() - mips.pixelData.size();
+            CHECK(std::equal(mips.pixelData.begin(), mips.pixelData.end(), full.pixelData.begin() + offset));
+
+            auto wholeBlob = std::vector<std::byte>{};
+            auto const whole = manager.getTextureMips(*asset, 64, wholeBlob);
+            CHECK(whole.firstMip == 0);
+            CHECK(whole.header.mipLevels == 7);
+            CHECK(whole.pixelData.size() == full.pixelData.size());
+
+            auto const uuid = asset->getHandle();
+            manager.registerAssetPath(uuid, assetFile);
+            auto handle = manager.getTextureMipsAsync(uuid, 8, LoadPriority::Low);
+            REQUIRE(handle != nullptr);
+            handle->wait();
+            CHECK(handle->getState() == LoadState::Ready);
+            CHECK(handle->getTexturePayload().firstMip == 3);
+            CHECK(handle->getTexturePayload().header.width == 8);
+            CHECK(manager.processCompletedLoads() == 1);
+
+            // Ranged reads reuse the last cook's key until the source changes.
+            stbi_write_png(srcFile.c_str(), 32, 32, 4, pixels.data(), 32 * 4);
+            auto const edited = manager.getTextureMips(*asset, 16, blob);
+            REQUIRE(edited.isValid());
+            CHECK(edited.storedHeader.width == 32);
+            CHECK(edited.firstMip == 1);
+        }
+
+        SUBCASE("Desired mip follows projected size")
+        {
+            auto header = TextureHeader{};
+            header.width = 1024;
+            header.height = 1024;
+            header.mipLevels = 11;
+            header.format = PixelFormat::RGBA8Unorm;
+
+            CHECK(computeDesiredMip(header, 256.0f) == 2);
+            CHECK(computeDesiredMip(header, 5000.0f) == 0);
+            CHECK(computeDesiredMip(header, 0.0f) == 10);
+            CHECK(computeDesiredMip(header, 256.0f, 1.0f) == 3);
+            CHECK(getFirstMipWithin(header, 128) == 3);
+            CHECK(getMipChainSize(header, 10) == 4);
+        }
+
+        SUBCASE("Planner shares the budget and evicts stale textures first")
+        {
+            auto header = TextureHeader{};
+            header.width = 1024;
+            header.height = 1024;
+            header.mipLevels = 11;
+            header.format = PixelFormat::RGBA8Unorm;
+
+            auto const tail = getMipChainSize(header, 3);
+            auto const mip1 = getMipChainSize(header, 1) - getMipChainSize(header, 2);
+            auto const mip2 = getMipChainSize(header, 2) - tail;
+
+            auto settings = TextureStreamingSettings{};
+            settings.budgetBytes = 2 * (tail + mip2 + mip1);
+            settings.evictAfterFrames = 10;
+            auto planner = TextureResidencyPlanner{settings};
+
+            auto const a = april::core::UUID{};
+            auto const b = april::core::UUID{};
+            planner.addTexture(a, header, 3);
+            planner.addTexture(b, header, 3);
+            CHECK(planner.getTailMip(a) == 3);
+            CHECK(planner.getResidentBytes() == 2 * tail);
+            CHECK(planner.plan(0).empty());
+
+            planner.requestMip(a, 0, 1);
+            planner.requestMip(b, 2, 1);
+            planner.requestMip(b, 0, 1);
+            auto const changes = planner.plan(1);
+            REQUIRE(changes.size() == 2);
+            for (auto const& change : changes)
+            {
+                // Neither texture can afford mip 0, so both stop at mip 1 instead of one starving the other.
+                CHECK(change.targetMip == 1);
+                planner.setResidentMip(change.id, change.targetMip);
+            }
+            CHECK(planner.getResidentBytes() == settings.budgetBytes);
+
+            // B has not been asked for since frame 1 and drops to its tail; A keeps what it still needs.
+            planner.requestMip(a, 2, 20);
+            auto const later = planner.plan(20);
+            REQUIRE(later.size() == 2);
+            for (auto const& change : later)
+            {
+                CHECK(change.targetMip == (change.id == a ? 2u : 3u));
+                planner.setResidentMip(change.id, change.targetMip);
+            }
+
+            // Upgrades are queued after evictions so freed memory is available first.
+            planner.requestMip(a, 0, 21);
+            planner.requestMip(b, 10, 21);
+            planner.setResidentMip(b, 1);
+            auto const mixed = planner.plan(21);
+            REQUIRE(mixed.size() == 2);
+            CHECK(mixed[0].id == b);
+            CHECK(mixed[0].targetMip == 3);
+            CHECK(mixed[1].id == a);
+            CHECK(mixed[1].targetMip < 2);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("TextureImporter - DDS and KTX2 Passthrough")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Containers"};
+        auto const cacheDir = std::string{"TestCache_Containers"};
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        // 8x8 gradient and its mip chain, BC1 encoded: 32 + 8 + 8 + 8 bytes.
+        auto rgba = std::vector<uint8_t>(8 * 8 * 4);
+        for (size_t i = 0; i < rgba.size(); ++i)
+        {
+            rgba[i] = static_cast<uint8_t>(i * 7);
+        }
+        auto const mips = generateMipChain(rgba, 8, 8, MipGenerationSettings{});
+        auto bc1Levels = std::vector<std::vector<uint8_t>>{};
+        auto rgbaLevels = std::vector<std::vector<uint8_t>>{};
+        for (auto const& mip : mips)
+        {
+            bc1Levels.push_back(compressBcSurface(BcFormat::BC1, mip.pixels, mip.width, mip.height, BcQuality::Fast));
+            rgbaLevels.push_back(mip.pixels);
+        }
+
+        auto const concat = [](std::vector<std::vector<uint8_t>> const& levels)
+        {
+            auto bytes = std::vector<std::byte>{};
+            for (auto const& level : levels)
+            {
+                auto const view = std::as_bytes(std::span{level});
+                bytes.insert(bytes.end(), view.begin(), view.end());
+            }
+            return bytes;
+        };
+
+        writeDDS(testDir + "/legacy.dds", 8, 8, bc1Levels, 0x31545844); // "DXT1"
+        writeDDS(testDir + "/dx10.dds", 8, 8, bc1Levels, 0, 71);        // DXGI_FORMAT_BC1_UNORM
+        writeKTX2(testDir + "/color.ktx2", 43, 8, 8, rgbaLevels);       // VK_FORMAT_R8G8B8A8_SRGB
+
+        auto manager = AssetManager{testDir, cacheDir};
+
+        SUBCASE("Legacy DDS keeps the BC1 mip chain and takes sRGB from the settings")
+        {
+            auto asset = manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/legacy.dds", {.sRGB = true}));
+            REQUIRE(asset != nullptr);
+
+            auto blob = std::vector<std::byte>{};
+            auto const payload = manager.getTextureData(*asset, blob);
+            REQUIRE(payload.isValid());
+            CHECK(payload.header.format == PixelFormat::BC1UnormSrgb);
+            CHECK(payload.header.mipLevels == 4);
+            auto const expected = concat(bc1Levels);
+            CHECK(std::ranges::equal(payload.pixelData, expected));
+        }
+
+        SUBCASE("DX10 DDS format wins over the settings")
+        {
+            auto asset = manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/dx10.dds", {.sRGB = true}));
+            REQUIRE(asset != nullptr);
+
+            auto blob = std::vector<std::byte>{};
+            auto const payload = manager.getTextureData(*asset, blob);
+            REQUIRE(payload.isValid());
+            CHECK(payload.header.format == PixelFormat::BC1Unorm);
+            CHECK(payload.header.mipLevels == 4);
+        }
+
+        SUBCASE("KTX2 levels are reordered largest first")
+        {
+            auto asset = manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/color.ktx2", {.sRGB = false}));
+            REQUIRE(asset != nullptr);
+
+            auto blob = std::vector<std::byte>{};
+            auto const payload = manager.getTextureData(*asset, blob);
+            REQUIRE(payload.isValid());
+            CHECK(payload.header.format == PixelFormat::RGBA8UnormSrgb);
+            CHECK(payload.header.channels == 4);
+            CHECK(payload.header.mipLevels == 4);
+            auto const expected = concat(rgbaLevels);
+            CHECK(std::ranges::equal(payload.pixelData, expected));
+        }
+
+        SUBCASE("Truncated and unsupported containers are rejected")
+        {
+            auto const readFile = [](std::string const& path)
+            {
+                auto file = std::ifstream{path, std::ios::binary};
+                auto const chars = std::vector<char>{std::istreambuf_iterator<char>{file}, {}};
+                auto const view = std::as_bytes(std::span{chars});
+                return std::vector<std::byte>{view.begin(), view.end()};
+            };
+
+            auto truncated = bc1Levels;
+            truncated.back().clear();
+            truncated.pop_back();
+            truncated.back().resize(4);
+            writeDDS(testDir + "/truncated.dds", 8, 8, truncated, 0x31545844);
+            auto bytes = readFile(testDir + "/truncated.dds");
+            CHECK_FALSE(readTextureContainer(bytes, false).has_value());
+
+            writeKTX2(testDir + "/undefined.ktx2", 0, 8, 8, rgbaLevels);
+            bytes = readFile(testDir + "/undefined.ktx2");
+            CHECK_FALSE(readTextureContainer(bytes, false).has_value());
+
+            bytes = readFile(testDir + "/legacy.dds");
+            auto const zeroWidth = uint32_t{0};
+            std::memcpy(bytes.data() + 16, &zeroWidth, sizeof(zeroWidth));
+            CHECK_FALSE(readTextureContainer(bytes, false).has_value());
+        }
+
+        SUBCASE("Mip counts past the 1x1 level are clamped to the chain")
+        {
+            auto const readFile = [](std::string const& path)
+            {
+                auto file = std::ifstream{path, std::ios::binary};
+                auto const chars = std::vector<char>{std::istreambuf_iterator<char>{file}, {}};
+                auto const view = std::as_bytes(std::span{chars});
+                return std::vector<std::byte>{view.begin(), view.end()};
+            };
+
+            // 40 levels would shift the width past 32 bits.
+            auto ddsLevels = bc1Levels;
+            ddsLevels.resize(40, std::vector<uint8_t>(8, 0));
+            writeDDS(testDir + "/long-chain.dds", 8, 8, ddsLevels, 0x31545844);
+            auto const dds = readTextureContainer(readFile(testDir + "/long-chain.dds"), false);
+            REQUIRE(dds.has_value());
+            CHECK(dds->levels.size() == 4);
+
+            auto ktxLevels = rgbaLevels;
+            ktxLevels.resize(6, std::vector<uint8_t>(4, 0));
+            writeKTX2(testDir + "/long-chain.ktx2", 43, 8, 8, ktxLevels);
+            auto const ktx = readTextureContainer(readFile(testDir + "/long-chain.ktx2"), false);
+            REQUIRE(ktx.has_value());
+            CHECK(ktx->levels.size() == 4);
+        }
+
+        SUBCASE("Batch cook runs decoded and passthrough textures together")
+        {
+            create4x4PNG(testDir + "/a.png");
+            create2x2PNG(testDir + "/b.png");
+            auto assets = std::vector<std::shared_ptr<Asset>>{
+                manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/a.png", {.sRGB = true})),
+                manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/b.png", {.sRGB = true})),
+                manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/color.ktx2", {.sRGB = false})),
+                manager.loadAsset<TextureAsset>(writeTextureAssetFile(testDir + "/legacy.dds", {.sRGB = false}))
+            };
+            CHECK(manager.cookAssets(assets) == 0);
+
+            auto blob = std::vector<std::byte>{};
+            CHECK(manager.getTextureData(static_cast<TextureAsset const&>(*assets[0]), blob).header.width == 4);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("AssetManager - Texture Loading")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Manager"};
+        auto const cacheDir = std::string{"TestCache_Manager"};
+        auto const srcFile = testDir + "/hero.png";
+        auto const assetFile = testDir + "/hero.asset";
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        createMinimalPNG(srcFile);
+
+        // Create .asset file
+        {
+            auto asset = TextureAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.sRGB = true;
+
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+
+            std::ofstream file(assetFile);
+            file << json.dump(2);
+        }
+
+        SUBCASE("Load asset from file")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<TextureAsset>(assetFile);
+
+            REQUIRE(asset != nullptr);
+            CHECK(asset->getSourcePath() == srcFile);
+            CHECK(asset->getType() == AssetType::Texture);
+            CHECK(asset->m_settings.sRGB == true);
+        }
+
+        SUBCASE("Get texture data returns valid payload")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<TextureAsset>(assetFile);
+            REQUIRE(asset != nullptr);
+
+            auto blob = std::vector<std::byte>{};
+            auto payload = manager.getTextureData(*asset, blob);
+
+            CHECK(payload.isValid());
+            CHECK(payload.header.width == 1);
+            CHECK(payload.header.height == 1);
+            CHECK(payload.header.channels == 4);
+            CHECK(payload.header.format == PixelFormat::RGBA8UnormSrgb);
+            CHECK(payload.pixelData.size() == 4);
+        }
+
+        SUBCASE("Register and retrieve asset by UUID")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<TextureAsset>(assetFile);
+            REQUIRE(asset != nullptr);
+
+            auto uuid = asset->getHandle();
+            manager.registerAssetPath(uuid, assetFile);
+
+            auto retrieved = manager.getAsset<TextureAsset>(uuid);
+            REQUIRE(retrieved != nullptr);
+            CHECK(retrieved->getHandle() == uuid);
+        }
+
+        SUBCASE("Async load prefetches payload and completes on processCompletedLoads")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto callbackCount = 0;
+            auto handle = manager.loadAssetAsync<TextureAsset>(
+                assetFile,
+                LoadPriority::High,
+                [&callbackCount](AssetLoadRequest& request)
+                {
+                    CHECK(request.getState() == LoadState::Ready);
+                    ++callbackCount;
+                });
+            REQUIRE(handle != nullptr);
+
+            handle->wait();
+            CHECK(handle->getState() == LoadState::Ready);
+            CHECK(callbackCount == 0);
+
+            auto asset = handle->getAssetAs<TextureAsset>();
+            REQUIRE(asset != nullptr);
+            CHECK(asset->getSourcePath() == srcFile);
+            CHECK(handle->getTexturePayload().isValid());
+            CHECK(handle->getTexturePayload().pixelData.size() == 4);
+
+            CHECK(manager.processCompletedLoads() == 1);
+            CHECK(callbackCount == 1);
+            CHECK(manager.getPendingLoadCount() == 0);
+        }
+
+        SUBCASE("Cancelled async load does not invoke callback")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto callbackCount = 0;
+            auto handle = manager.loadAssetAsync<TextureAsset>(
+                assetFile,
+                LoadPriority::Low,
+                [&callbackCount](AssetLoadRequest&) { ++callbackCount; });
+            REQUIRE(handle != nullptr);
+
+            handle->cancel();
+            handle->wait();
+            manager.processCompletedLoads();
+
+            CHECK(callbackCount == 0);
+            CHECK(handle->isDone());
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("Mip Level Calculation")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Mips"};
+        auto const cacheDir = std::string{"TestCache_Mips"};
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        SUBCASE("1x1 texture has 1 mip level")
+        {
+            auto srcFile = testDir + "/1x1.png";
+            createMinimalPNG(srcFile);
+
+            auto assetFile = testDir + "/1x1.asset";
+            auto asset = TextureAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.generateMips = true;
+
+            {
+                auto json = nlohmann::json{};
+                asset.serializeJson(json);
+                std::ofstream file(assetFile);
+                file << json.dump(2);
+            }
+
+            auto manager = AssetManager{testDir, cacheDir};
+            auto loaded = manager.loadAsset<TextureAsset>(assetFile);
+            REQUIRE(loaded != nullptr);
+
+            auto blob = std::vector<std::byte>{};
+            auto payload = manager.getTextureData(*loaded, blob);
+
+            CHECK(payload.header.mipLevels == 1);
+            CHECK(payload.header.dataSize == 4);
+        }
+
+        SUBCASE("2x2 texture generates 2 mip levels when enabled")
+        {
+            auto srcFile = testDir + "/2x2.png";
+            create2x2PNG(srcFile);
+
+            auto assetFile = testDir + "/2x2.asset";
+            auto asset = TextureAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.generateMips = true;
 
             {
                 auto json = nlohmann::json{};
@@ -695,8 +2506,10 @@ TEST_SUITE("Asset System - Stage 3 & 4")
             auto blob = std::vector<std::byte>{};
             auto payload = manager.getTextureData(*loaded, blob);
 
+            // Default BC7 compression: one 16-byte block per mip.
             CHECK(payload.header.mipLevels == 3);
-            CHECK(payload.header.dataSize == 84);
+            CHECK(payload.header.format == PixelFormat::BC7UnormSrgb);
+            CHECK(payload.header.dataSize == 48);
         }
 
         SUBCASE("generateMips=false forces 1 mip level")
@@ -731,6 +2544,84 @@ TEST_SUITE("Asset System - Stage 3 & 4")
         fs::remove_all(cacheDir);
     }
 
+    TEST_CASE("Mip Generator")
+    {
+        using namespace april::asset;
+
+        SUBCASE("Non-power-of-two chains keep constant images constant")
+        {
+            auto const pixels = std::vector<uint8_t>(7 * 3 * 4, 77);
+            CHECK(calculateMipCount(7, 3) == 3);
+
+            for (auto filter : {MipFilter::Box, MipFilter::Kaiser, MipFilter::Lanczos})
+            {
+                auto settings = MipGenerationSettings{};
+                settings.filter = filter;
+                auto chain = generateMipChain(pixels, 7, 3, settings);
+
+                REQUIRE(chain.size() == 3);
+                CHECK(chain[1].width == 3);
+                CHECK(chain[1].height == 1);
+                CHECK(chain[2].width == 1);
+                for (auto const& level : chain)
+                {
+                    CHECK(level.pixels.size() == size_t{level.width} * level.height * 4);
+                    CHECK(std::ranges::all_of(level.pixels, [](uint8_t value) { return value == 77; }));
+                }
+            }
+        }
+
+        SUBCASE("sRGB inputs are filtered in linear space")
+        {
+            auto const pixels = std::vector<uint8_t>{0, 0, 0, 255, 255, 255, 255, 255};
+
+            auto settings = MipGenerationSettings{};
+            settings.filter = MipFilter::Box;
+            settings.sRGB = true;
+            CHECK(generateMipChain(pixels, 2, 1, settings)[1].pixels[0] == 188);
+
+            settings.sRGB = false;
+            CHECK(generateMipChain(pixels, 2, 1, settings)[1].pixels[0] == 128);
+        }
+
+        SUBCASE("Alpha coverage is preserved for alpha-tested textures")
+        {
+            // Thin opaque columns, as in foliage cards.
+            auto pixels = std::vector<uint8_t>(8 * 8 * 4);
+            for (auto y = 0; y < 8; ++y)
+            {
+                for (auto x = 0; x < 8; ++x)
+                {
+                    auto* texel = &pixels[static_cast<size_t>(y * 8 + x) * 4];
+                    texel[0] = 200;
+                    texel[1] = 100;
+                    texel[2] = 50;
+                    texel[3] = x % 3 == 0 ? 255 : 40;
+                }
+            }
+
+            auto coverage = [](MipSurface const& level) -> double
+            {
+                auto covered = 0;
+                for (auto i = size_t{3}; i < level.pixels.size(); i += 4)
+                {
+                    covered += level.pixels[i] > 127 ? 1 : 0;
+                }
+                return static_cast<double>(covered) / (level.width * level.height);
+            };
+
+            auto settings = MipGenerationSettings{};
+            auto plain = generateMipChain(pixels, 8, 8, settings);
+            settings.alphaCutoff = 0.5f;
+            auto preserved = generateMipChain(pixels, 8, 8, settings);
+
+            auto const target = coverage(preserved[0]);
+            CHECK(coverage(plain[2]) == doctest::Approx(0.0));
+            CHECK(std::abs(coverage(preserved[1]) - target) <= 0.15);
+            CHECK(std::abs(coverage(preserved[2]) - target) <= 0.15);
+        }
+    }
+
     TEST_CASE("Pixel Data Integrity")
     {
         using namespace april::asset;
@@ -827,183 +2718,670 @@ TEST_SUITE("Asset System - Stage 3 & 4")
         }
     }
 
-    TEST_CASE("MeshPayload - Validation")
-    {
-        using namespace april::asset;
+    TEST_CASE("MeshPayload - Validation")
+    {
+        using namespace april::asset;
+
+        SUBCASE("Empty payload is invalid")
+        {
+            auto payload = MeshPayload{};
+            CHECK_FALSE(payload.isValid());
+        }
+
+        SUBCASE("Payload with valid header but empty data is invalid")
+        {
+            auto payload = MeshPayload{};
+            payload.header.vertexCount = 3;
+            payload.header.indexCount = 3;
+            CHECK_FALSE(payload.isValid());
+        }
+
+        SUBCASE("Payload with valid header and data is valid")
+        {
+            auto vertexData = std::vector<std::byte>(144); // 3 vertices * 48 bytes
+            auto indexData = std::vector<std::byte>(12);   // 3 indices * 4 bytes
+            auto submeshes = std::vector<Submesh>(1);
+
+            auto payload = MeshPayload{};
+            payload.header.vertexCount = 3;
+            payload.header.indexCount = 3;
+            payload.submeshes = std::span<Submesh const>{submeshes};
+            payload.vertexData = std::span<std::byte const>{vertexData};
+            payload.indexData = std::span<std::byte const>{indexData};
+
+            CHECK(payload.isValid());
+        }
+    }
+
+    TEST_CASE("StaticMeshAsset - JSON Serialization")
+    {
+        using namespace april;
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_MeshSerialize"};
+        auto const srcFile = testDir + "/test.gltf";
+
+        fs::create_directories(testDir);
+
+        SUBCASE("Serialize and deserialize preserves data")
+        {
+            auto asset = StaticMeshAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.optimize = true;
+            asset.m_settings.generateTangents = true;
+            asset.m_settings.flipWindingOrder = false;
+            asset.m_settings.scale = 2.0f;
+            auto matGuid0 = core::UUID{"00000000-0000-0000-0000-000000000001"};
+            auto matGuid1 = core::UUID{"00000000-0000-0000-0000-000000000002"};
+            asset.m_materialSlots = {
+                MaterialSlot{"Default", AssetRef{matGuid0, 0}},
+                MaterialSlot{"Detail", AssetRef{matGuid1, 0}}
+            };
+
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+
+            CHECK(json["source_path"] == srcFile);
+            CHECK(json["type"] == "Mesh");
+            CHECK(json["settings"]["optimize"] == true);
+            CHECK(json["settings"]["generateTangents"] == true);
+            CHECK(json["settings"]["flipWindingOrder"] == false);
+            CHECK(json["settings"]["scale"] == doctest::Approx(2.0f));
+            CHECK(json["materialSlots"].size() == 2);
+            CHECK(json["materialSlots"][0]["name"] == "Default");
+            CHECK(json["materialSlots"][0]["materialRef"]["guid"] == matGuid0.toString());
+
+            auto asset2 = StaticMeshAsset{};
+            CHECK(asset2.deserializeJson(json));
+            CHECK(asset2.getSourcePath() == srcFile);
+            CHECK(asset2.m_settings.optimize == true);
+            CHECK(asset2.m_settings.generateTangents == true);
+            CHECK(asset2.m_settings.flipWindingOrder == false);
+            CHECK(asset2.m_settings.scale == doctest::Approx(2.0f));
+            REQUIRE(asset2.m_materialSlots.size() == 2);
+            CHECK(asset2.m_materialSlots[0].name == "Default");
+            CHECK(asset2.m_materialSlots[0].materialRef.guid == matGuid0);
+            REQUIRE(asset2.getReferences().size() == 2);
+            CHECK(asset2.getReferences()[0].guid == matGuid0);
+            CHECK(asset2.getReferences()[1].guid == matGuid1);
+        }
+
+        fs::remove_all(testDir);
+    }
+
+    TEST_CASE("MeshImporter - Mesh Compilation")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_MeshDDC"};
+        auto const cacheDir = std::string{"TestCache_MeshDDC"};
+        auto const srcFile = testDir + "/triangle.gltf";
+        auto const assetFile = testDir + "/triangle.gltf.asset";
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        createMinimalGLTF(srcFile);
+
+        {
+            auto asset = StaticMeshAsset{};
+            asset.setSourcePath(srcFile);
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+            std::ofstream file(assetFile);
+            file << json.dump(2);
+        }
+
+        SUBCASE("Compiles valid glTF to binary blob")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+            auto blob = std::vector<std::byte>{};
+            auto payload = manager.getMeshData(*asset, blob);
+
+            CHECK(payload.isValid());
+            CHECK(payload.header.vertexCount == 3);
+            CHECK(payload.header.indexCount == 3);
+            CHECK(payload.header.submeshCount == 1);
+            CHECK(payload.header.vertexStride == 48);
+            CHECK(payload.header.indexFormat == 1);
+            CHECK(payload.header.vertexDataSize == 144);
+            CHECK(payload.header.indexDataSize == 12);
+            CHECK(payload.header.vertexDataSize == static_cast<uint64_t>(payload.header.vertexCount) * payload.header.vertexStride);
+
+            auto expectedSize = sizeof(MeshHeader) + sizeof(Submesh) + payload.header.vertexDataSize + payload.header.indexDataSize +
+                                payload.header.meshletSectionSize;
+            CHECK(blob.size() == expectedSize);
+        }
+
+        SUBCASE("Cache hit returns same data")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+            auto blob1 = std::vector<std::byte>{};
+            auto blob2 = std::vector<std::byte>{};
+            manager.getMeshData(*asset, blob1);
+            manager.getMeshData(*asset, blob2);
+
+            CHECK(blob1 == blob2);
+        }
+
+        SUBCASE("Cache entry exists")
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+            auto blob = std::vector<std::byte>{};
+            manager.getMeshData(*asset, blob);
+
+            auto settingsJson = nlohmann::json{};
+            settingsJson["settings"] = asset->m_settings;
+            auto key = buildDdcKey(FingerprintInput{
+                "MS",
+                asset->getHandle().toString(),
+                "GltfImporter",
+                2,
+                "tinygltf@unknown|meshopt@unknown|meshblob@4|tangents@2",
+                hashFileContents(asset->getSourcePath()),
+                hashJson(settingsJson),
+                hashDependencies({}),
+                TargetProfile{}
+            });
+
+            CHECK(manager.getDdc().exists(key));
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("MeshImporter - LOD Generation")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_MeshLod"};
+        auto const cacheDir = std::string{"TestCache_MeshLod"};
+        auto const srcFile = testDir + "/grid.gltf";
+        auto const assetFile = testDir + "/grid.gltf.asset";
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        createGridGLTF(srcFile, 16);
+
+        auto writeAsset = [&](uint32_t lodCount)
+        {
+            auto asset = StaticMeshAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.generateTangents = false;
+            asset.m_settings.lodCount = lodCount;
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+            std::ofstream file(assetFile);
+            file << json.dump(2);
+        };
+
+        SUBCASE("Levels shrink and their error grows")
+        {
+            writeAsset(4);
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+            auto blob = std::vector<std::byte>{};
+            auto payload = manager.getMeshData(*asset, blob);
+
+            REQUIRE(payload.isValid());
+            REQUIRE(payload.header.lodCount > 1);
+            REQUIRE(payload.header.submeshCount == 1);
+            REQUIRE(payload.lods.size() == payload.header.lodCount - 1);
+
+            auto previousCount = payload.submeshes[0].indexCount;
+            auto previousError = 0.0f;
+            for (auto const& lod : payload.lods)
+            {
+                CHECK(lod.indexCount % 3 == 0);
+                CHECK(lod.indexCount < previousCount);
+                CHECK(lod.error >= previousError);
+                CHECK(lod.indexOffset + lod.indexCount <= payload.header.indexCount);
+                previousCount = lod.indexCount;
+                previousError = lod.error;
+            }
+
+            auto expectedSize = sizeof(MeshHeader) + sizeof(Submesh) + payload.lods.size() * sizeof(SubmeshLod) +
+                                payload.header.vertexDataSize + payload.header.indexDataSize + payload.header.meshletSectionSize;
+            CHECK(blob.size() == expectedSize);
+        }
+
+        SUBCASE("A single level disables generation")
+        {
+            writeAsset(1);
+            auto manager = AssetManager{testDir, cacheDir};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+            auto blob = std::vector<std::byte>{};
+            auto payload = manager.getMeshData(*asset, blob);
+
+            REQUIRE(payload.isValid());
+            CHECK(payload.header.lodCount == 1);
+            CHECK(payload.lods.empty());
+            CHECK(payload.header.indexCount == 16 * 16 * 6);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
+
+    TEST_CASE("MeshImporter - Meshlets and Cluster Culling")
+    {
+        using namespace april::asset;
+        using april::float3;
+
+        auto const testDir = std::string{"TestAssets_Meshlets"};
+        auto const cacheDir = std::string{"TestCache_Meshlets"};
+        auto const srcFile = testDir + "/grid.gltf";
+        auto const assetFile = testDir + "/grid.gltf.asset";
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::create_directories(testDir);
+
+        createGridGLTF(srcFile, 32);
+
+        {
+            auto asset = StaticMeshAsset{};
+            asset.setSourcePath(srcFile);
+            asset.m_settings.generateTangents = false;
+            asset.m_settings.lodCount = 1;
+            auto json = nlohmann::json{};
+            asset.serializeJson(json);
+            std::ofstream file(assetFile);
+            file << json.dump(2);
+        }
+
+        auto manager = AssetManager{testDir, cacheDir};
+        auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+
+        auto blob = std::vector<std::byte>{};
+        auto payload = manager.getMeshData(*asset, blob);
+        REQUIRE(payload.isValid());
+        REQUIRE_FALSE(payload.meshlets.empty());
+
+        SUBCASE("Meshlets cover every triangle within the build limits")
+        {
+            auto triangles = uint64_t{0};
+            for (auto const& meshlet : payload.meshlets)
+            {
+                CHECK(meshlet.vertexCount <= asset->m_settings.meshletMaxVertices);
+                CHECK(meshlet.triangleCount <= asset->m_settings.meshletMaxTriangles);
+                CHECK(meshlet.triangleOffset % 4 == 0);
+                CHECK(meshlet.radius > 0.0f);
+                REQUIRE(meshlet.vertexOffset + meshlet.vertexCount <= payload.meshletVertices.size());
+                REQUIRE(meshlet.triangleOffset + meshlet.triangleCount * 3 <= payload.meshletTriangles.size());
+
+                for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+                {
+                    CHECK(payload.meshletVertices[meshlet.vertexOffset + i] < payload.header.vertexCount);
+                }
+                for (uint32_t i = 0; i < meshlet.triangleCount * 3; ++i)
+                {
+                    CHECK(payload.meshletTriangles[meshlet.triangleOffset + i] < meshlet.vertexCount);
+                }
+                triangles += meshlet.triangleCount;
+            }
+            CHECK(triangles == payload.submeshes[0].indexCount / 3);
+        }
+
+        auto const projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
 
-        SUBCASE("Empty payload is invalid")
+        SUBCASE("Front view keeps every cluster")
         {
-            auto payload = MeshPayload{};
-            CHECK_FALSE(payload.isValid());
+            auto view = MeshletCullView{};
+            view.cameraPosition = float3{0.5f, 0.5f, 2.0f};
+            view.viewProjection = projection * glm::lookAt(view.cameraPosition, float3{0.5f, 0.5f, 0.0f}, float3{0.0f, 1.0f, 0.0f});
+
+            auto visible = std::vector<uint32_t>{};
+            auto const stats = cullMeshlets(payload.meshlets, view, &visible);
+            CHECK(stats.meshletCount == payload.meshlets.size());
+            CHECK(stats.visibleMeshletCount == payload.meshlets.size());
+            CHECK(visible.size() == payload.meshlets.size());
+            CHECK(stats.getCulledTriangleFraction() == doctest::Approx(0.0f));
         }
 
-        SUBCASE("Payload with valid header but empty data is invalid")
+        SUBCASE("Back view culls clusters by their normal cones")
         {
-            auto payload = MeshPayload{};
-            payload.header.vertexCount = 3;
-            payload.header.indexCount = 3;
-            CHECK_FALSE(payload.isValid());
+            auto view = MeshletCullView{};
+            view.cameraPosition = float3{0.5f, 0.5f, -10.0f};
+            view.viewProjection = projection * glm::lookAt(view.cameraPosition, float3{0.5f, 0.5f, 0.0f}, float3{0.0f, 1.0f, 0.0f});
+
+            auto const stats = cullMeshlets(payload.meshlets, view);
+            CHECK(stats.frustumCulledCount == 0);
+            CHECK(stats.coneCulledCount > 0);
+            CHECK(stats.getCulledTriangleFraction() > 0.5f);
+
+            view.coneCulling = false;
+            CHECK(cullMeshlets(payload.meshlets, view).getCulledTriangleFraction() == doctest::Approx(0.0f));
         }
 
-        SUBCASE("Payload with valid header and data is valid")
+        SUBCASE("Looking away culls everything by the frustum")
         {
-            auto vertexData = std::vector<std::byte>(144); // 3 vertices * 48 bytes
-            auto indexData = std::vector<std::byte>(12);   // 3 indices * 4 bytes
-            auto submeshes = std::vector<Submesh>(1);
-
-            auto payload = MeshPayload{};
-            payload.header.vertexCount = 3;
-            payload.header.indexCount = 3;
-            payload.submeshes = std::span<Submesh const>{submeshes};
-            payload.vertexData = std::span<std::byte const>{vertexData};
-            payload.indexData = std::span<std::byte const>{indexData};
+            auto view = MeshletCullView{};
+            view.cameraPosition = float3{0.5f, 0.5f, 2.0f};
+            view.viewProjection = projection * glm::lookAt(view.cameraPosition, float3{0.5f, 0.5f, 4.0f}, float3{0.0f, 1.0f, 0.0f});
 
-            CHECK(payload.isValid());
+            auto const stats = cullMeshlets(payload.meshlets, view);
+            CHECK(stats.frustumCulledCount == payload.meshlets.size());
+            CHECK(stats.getCulledTriangleFraction() == doctest::Approx(1.0f));
         }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
     }
 
-    TEST_CASE("StaticMeshAsset - JSON Serialization")
+    TEST_CASE("MeshImporter - Compact Vertices and Codecs")
     {
-        using namespace april;
         using namespace april::asset;
 
-        auto const testDir = std::string{"TestAssets_MeshSerialize"};
-        auto const srcFile = testDir + "/test.gltf";
+        auto const testDir = std::string{"TestAssets_CompactMesh"};
+        auto const cacheDir = std::string{"TestCache_CompactMesh"};
+        auto const srcFile = testDir + "/grid.gltf";
+        auto const assetFile = testDir + "/grid.gltf.asset";
 
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
         fs::create_directories(testDir);
 
-        SUBCASE("Serialize and deserialize preserves data")
+        createGridGLTF(srcFile, 24);
+
+        auto cook = [&](bool compact, bool compress, std::string const& cache, std::vector<std::byte>& blob) -> MeshPayload
         {
-            auto asset = StaticMeshAsset{};
-            asset.setSourcePath(srcFile);
-            asset.m_settings.optimize = true;
-            asset.m_settings.generateTangents = true;
-            asset.m_settings.flipWindingOrder = false;
-            asset.m_settings.scale = 2.0f;
-            auto matGuid0 = core::UUID{"00000000-0000-0000-0000-000000000001"};
-            auto matGuid1 = core::UUID{"00000000-0000-0000-0000-000000000002"};
-            asset.m_materialSlots = {
-                MaterialSlot{"Default", AssetRef{matGuid0, 0}},
-                MaterialSlot{"Detail", AssetRef{matGuid1, 0}}
-            };
+            {
+                auto asset = StaticMeshAsset{};
+                asset.setSourcePath(srcFile);
+                asset.m_settings.generateTangents = false;
+                asset.m_settings.compactVertices = compact;
+                asset.m_settings.compressPayload = compress;
+                auto json = nlohmann::json{};
+                asset.serializeJson(json);
+                std::ofstream file(assetFile);
+                file << json.dump(2);
+            }
 
-            auto json = nlohmann::json{};
-            asset.serializeJson(json);
+            auto manager = AssetManager{testDir, cache};
+            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+            REQUIRE(asset);
+            return manager.getMeshData(*asset, blob);
+        };
 
-            CHECK(json["source_path"] == srcFile);
-            CHECK(json["type"] == "Mesh");
-            CHECK(json["settings"]["optimize"] == true);
-            CHECK(json["settings"]["generateTangents"] == true);
-            CHECK(json["settings"]["flipWindingOrder"] == false);
-            CHECK(json["settings"]["scale"] == doctest::Approx(2.0f));
-            CHECK(json["materialSlots"].size() == 2);
-            CHECK(json["materialSlots"][0]["name"] == "Default");
-            CHECK(json["materialSlots"][0]["materialRef"]["guid"] == matGuid0.toString());
+        // The index codec keeps triangle order and winding but may rotate the corners of a triangle.
+        auto sameTriangles = [](auto const* pActual, uint32_t const* pExpected, uint32_t indexCount) -> bool
+        {
+            for (uint32_t i = 0; i < indexCount; i += 3)
+            {
+                auto matched = false;
+                for (uint32_t rotation = 0; rotation < 3 && !matched; ++rotation)
+                {
+                    matched = pActual[i + rotation] == pExpected[i] &&
+                              pActual[i + (rotation + 1) % 3] == pExpected[i + 1] &&
+                              pActual[i + (rotation + 2) % 3] == pExpected[i + 2];
+                }
+                if (!matched)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
 
-            auto asset2 = StaticMeshAsset{};
-            CHECK(asset2.deserializeJson(json));
-            CHECK(asset2.getSourcePath() == srcFile);
-            CHECK(asset2.m_settings.optimize == true);
-            CHECK(asset2.m_settings.generateTangents == true);
-            CHECK(asset2.m_settings.flipWindingOrder == false);
-            CHECK(asset2.m_settings.scale == doctest::Approx(2.0f));
-            REQUIRE(asset2.m_materialSlots.size() == 2);
-            CHECK(asset2.m_materialSlots[0].name == "Default");
-            CHECK(asset2.m_materialSlots[0].materialRef.guid == matGuid0);
-            REQUIRE(asset2.getReferences().size() == 2);
-            CHECK(asset2.getReferences()[0].guid == matGuid0);
-            CHECK(asset2.getReferences()[1].guid == matGuid1);
+        auto directorySize = [](std::string const& path) -> uintmax_t
+        {
+            auto total = uintmax_t{0};
+            for (auto const& entry : fs::recursive_directory_iterator(path))
+            {
+                if (entry.is_regular_file())
+                {
+                    total += entry.file_size();
+                }
+            }
+            return total;
+        };
+
+        SUBCASE("Codecs round trip and shrink the cache entry")
+        {
+            auto rawBlob = std::vector<std::byte>{};
+            auto packedBlob = std::vector<std::byte>{};
+            auto const raw = cook(false, false, cacheDir + "/raw", rawBlob);
+            auto const packed = cook(false, true, cacheDir + "/packed", packedBlob);
+
+            REQUIRE(raw.isValid());
+            REQUIRE(packed.isValid());
+            CHECK((packed.header.flags & (EncodedVertexData | EncodedIndexData)) == 0);
+            CHECK(packed.header.vertexStride == kStandardVertexStride);
+            REQUIRE(packed.header.indexCount == raw.header.indexCount);
+            CHECK(packed.header.indexDataSize == raw.header.indexDataSize);
+            CHECK(std::ranges::equal(packed.vertexData, raw.vertexData));
+            CHECK(packed.header.meshletSectionSize == raw.header.meshletSectionSize);
+            auto const* pPacked = reinterpret_cast<uint32_t const*>(packed.indexData.data());
+            auto const* pRaw = reinterpret_cast<uint32_t const*>(raw.indexData.data());
+            CHECK(sameTriangles(pPacked, pRaw, raw.header.indexCount));
+            CHECK(directorySize(cacheDir + "/packed") < directorySize(cacheDir + "/raw"));
+        }
+
+        SUBCASE("Compact layout dequantizes within tolerance")
+        {
+            auto floatBlob = std::vector<std::byte>{};
+            auto compactBlob = std::vector<std::byte>{};
+            auto const reference = cook(false, false, cacheDir + "/float", floatBlob);
+            auto const compact = cook(true, true, cacheDir + "/compact", compactBlob);
+
+            REQUIRE(reference.isValid());
+            REQUIRE(compact.isValid());
+            CHECK(compact.header.vertexStride == kCompactVertexStride);
+            CHECK(compact.header.indexFormat == 0);
+            CHECK((compact.header.flags & VertexFlags::Compact) != 0);
+            CHECK((compact.header.flags & (EncodedVertexData | EncodedIndexData)) == 0);
+            REQUIRE(compact.header.vertexCount == reference.header.vertexCount);
+            REQUIRE(compact.header.indexCount == reference.header.indexCount);
+            CHECK(compact.header.vertexDataSize == static_cast<uint64_t>(compact.header.vertexCount) * kCompactVertexStride);
+            CHECK(compact.header.indexDataSize % 4 == 0);
+            CHECK(compact.header.meshletSectionSize == reference.header.meshletSectionSize);
+            CHECK(getVertexAttributes(compact.header.flags).size() == kCompactVertexAttributes.size());
+
+            auto const* pReference = reinterpret_cast<float const*>(reference.vertexData.data());
+            auto const* pCompact = reinterpret_cast<CompactVertex const*>(compact.vertexData.data());
+            auto maxPositionError = 0.0f;
+            auto minNormalDot = 1.0f;
+            for (uint32_t v = 0; v < compact.header.vertexCount; ++v)
+            {
+                auto const* expected = pReference + v * 12;
+                auto const& packed = pCompact[v];
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    auto const extent = compact.header.boundsMax[axis] - compact.header.boundsMin[axis];
+                    auto const position = compact.header.boundsMin[axis] + packed.position[axis] / 65535.0f * extent;
+                    maxPositionError = std::max(maxPositionError, std::abs(position - expected[axis]));
+                }
+
+                // Octahedral decode, as in scene-mesh.slang.
+                auto x = std::max(packed.normal[0] / 32767.0f, -1.0f);
+                auto y = std::max(packed.normal[1] / 32767.0f, -1.0f);
+                auto const z = 1.0f - std::abs(x) - std::abs(y);
+                auto const t = std::clamp(-z, 0.0f, 1.0f);
+                x += x >= 0.0f ? -t : t;
+                y += y >= 0.0f ? -t : t;
+                auto const length = std::sqrt(x * x + y * y + z * z);
+                auto const dot = (x * expected[3] + y * expected[4] + z * expected[5]) / length;
+                minNormalDot = std::min(minNormalDot, dot);
+            }
+            CHECK(maxPositionError < 1e-4f);
+            CHECK(minNormalDot > 0.9999f);
+
+            auto const* pReferenceIndices = reinterpret_cast<uint32_t const*>(reference.indexData.data());
+            auto const* pCompactIndices = reinterpret_cast<uint16_t const*>(compact.indexData.data());
+            CHECK(sameTriangles(pCompactIndices, pReferenceIndices, compact.header.indexCount));
         }
 
         fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
     }
 
-    TEST_CASE("MeshImporter - Mesh Compilation")
+    TEST_CASE("GltfImporter - Multi-Mesh Scene Import")
     {
         using namespace april::asset;
 
-        auto const testDir = std::string{"TestAssets_MeshDDC"};
-        auto const cacheDir = std::string{"TestCache_MeshDDC"};
-        auto const srcFile = testDir + "/triangle.gltf";
-        auto const assetFile = testDir + "/triangle.gltf.asset";
+        auto const testDir = std::string{"TestAssets_GltfScene"};
+        auto const cacheDir = std::string{"TestCache_GltfScene"};
+        auto const srcFile = testDir + "/kit.gltf";
 
         fs::remove_all(testDir);
         fs::remove_all(cacheDir);
         fs::create_directories(testDir);
 
-        createMinimalGLTF(srcFile);
+        createMultiMeshGLTF(srcFile);
 
+        auto manager = AssetManager{testDir, cacheDir};
+        auto primary = std::dynamic_pointer_cast<StaticMeshAsset>(manager.importAsset(srcFile));
+        REQUIRE(primary != nullptr);
+        CHECK(primary->m_sourceMeshIndex == 0);
+        CHECK(fs::exists(srcFile + ".mesh1.asset"));
+        REQUIRE(fs::exists(srcFile + ".scene.asset"));
+
+        auto scene = manager.loadAsset<SceneAsset>(srcFile + ".scene.asset");
+        REQUIRE(scene != nullptr);
+        REQUIRE(scene->m_meshes.size() == 2);
+        CHECK(scene->m_meshes[0].guid == primary->getHandle());
+
+        SUBCASE("Node tree is flattened parents-first with shared meshes")
         {
-            auto asset = StaticMeshAsset{};
-            asset.setSourcePath(srcFile);
-            auto json = nlohmann::json{};
-            asset.serializeJson(json);
-            std::ofstream file(assetFile);
-            file << json.dump(2);
+            REQUIRE(scene->m_nodes.size() == 4);
+            CHECK(scene->m_nodes[0].name == "Root");
+            CHECK(scene->m_nodes[0].parent == -1);
+            CHECK(scene->m_nodes[0].mesh == -1);
+            CHECK(scene->m_nodes[0].localMatrix[3][0] == doctest::Approx(1.0f));
+            CHECK(scene->m_nodes[0].localMatrix[3][1] == doctest::Approx(2.0f));
+            CHECK(scene->m_nodes[0].localMatrix[3][2] == doctest::Approx(3.0f));
+            for (size_t i = 1; i < scene->m_nodes.size(); ++i)
+            {
+                CHECK(scene->m_nodes[i].parent == 0);
+            }
+
+            CHECK(scene->m_nodes[1].mesh == 0);
+            CHECK(scene->m_nodes[2].mesh == 1);
+            CHECK(scene->m_nodes[3].mesh == 0);
+            CHECK(scene->getInstanceCount(0) == 2);
+            CHECK(scene->getInstanceCount(1) == 1);
+
+            // 90 degrees about +Y maps +X to -Z.
+            CHECK(scene->m_nodes[2].localMatrix[0][2] == doctest::Approx(-1.0f).epsilon(1e-4));
+            CHECK(scene->m_nodes[3].localMatrix[0][0] == doctest::Approx(2.0f));
         }
 
-        SUBCASE("Compiles valid glTF to binary blob")
+        SUBCASE("Each glTF mesh cooks separately")
         {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+            auto second = manager.loadAsset<StaticMeshAsset>(srcFile + ".mesh1.asset");
+            REQUIRE(second != nullptr);
+            CHECK(second->m_sourceMeshIndex == 1);
+            CHECK(scene->m_meshes[1].guid == second->getHandle());
+
+            auto gridBlob = std::vector<std::byte>{};
+            auto triangleBlob = std::vector<std::byte>{};
+            auto const grid = manager.getMeshData(*primary, gridBlob);
+            auto const triangle = manager.getMeshData(*second, triangleBlob);
+            REQUIRE(grid.isValid());
+            REQUIRE(triangle.isValid());
+            CHECK(grid.header.vertexCount == 25);
+            CHECK(grid.submeshes[0].indexCount == 96);
+            CHECK(triangle.header.vertexCount == 3);
+            CHECK(triangle.submeshes[0].indexCount == 3);
+        }
 
-            auto blob = std::vector<std::byte>{};
-            auto payload = manager.getMeshData(*asset, blob);
+        SUBCASE("Reimport keeps mesh identities")
+        {
+            auto const secondHandle = scene->m_meshes[1].guid;
+            auto const sceneHandle = scene->getHandle();
 
-            CHECK(payload.isValid());
-            CHECK(payload.header.vertexCount == 3);
-            CHECK(payload.header.indexCount == 3);
-            CHECK(payload.header.submeshCount == 1);
-            CHECK(payload.header.vertexStride == 48);
-            CHECK(payload.header.indexFormat == 1);
-            CHECK(payload.header.vertexDataSize == 144);
-            CHECK(payload.header.indexDataSize == 12);
-            CHECK(payload.header.vertexDataSize == static_cast<uint64_t>(payload.header.vertexCount) * payload.header.vertexStride);
+            auto reimported = manager.importAsset(srcFile, AssetManager::ImportPolicy::Reimport);
+            REQUIRE(reimported != nullptr);
 
-            auto expectedSize = sizeof(MeshHeader) + sizeof(Submesh) + payload.header.vertexDataSize + payload.header.indexDataSize;
-            CHECK(blob.size() == expectedSize);
+            auto rescene = manager.loadAsset<SceneAsset>(srcFile + ".scene.asset");
+            REQUIRE(rescene != nullptr);
+            CHECK(rescene->getHandle() == sceneHandle);
+            REQUIRE(rescene->m_meshes.size() == 2);
+            CHECK(rescene->m_meshes[1].guid == secondHandle);
         }
 
-        SUBCASE("Cache hit returns same data")
+        SUBCASE("Meshes cooked on import reuse the import's parse")
         {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
-
-            auto blob1 = std::vector<std::byte>{};
-            auto blob2 = std::vector<std::byte>{};
-            manager.getMeshData(*asset, blob1);
-            manager.getMeshData(*asset, blob2);
+            auto config = AssetManager::ImportConfig{};
+            config.policy = AssetManager::ImportPolicy::Reimport;
+            config.cookImportedMeshes = true;
+            REQUIRE(manager.importAsset(srcFile, config) != nullptr);
 
-            CHECK(blob1 == blob2);
+            CHECK(manager.getCookedContentHash(primary->getHandle()).has_value());
+            CHECK(manager.getCookedContentHash(scene->m_meshes[1].guid).has_value());
         }
 
-        SUBCASE("Cache entry exists")
-        {
-            auto manager = AssetManager{testDir, cacheDir};
-            auto asset = manager.loadAsset<StaticMeshAsset>(assetFile);
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+    }
 
-            auto blob = std::vector<std::byte>{};
-            manager.getMeshData(*asset, blob);
+    TEST_CASE("GltfImporter - GLB and External Buffers Read In Place")
+    {
+        using namespace april::asset;
 
-            auto settingsJson = nlohmann::json{};
-            settingsJson["settings"] = asset->m_settings;
-            auto key = buildDdcKey(FingerprintInput{
-                "MS",
-                asset->getHandle().toString(),
-                "GltfImporter",
-                1,
-                "tinygltf@unknown|meshopt@unknown|meshblob@1",
-                hashFileContents(asset->getSourcePath()),
-                hashJson(settingsJson),
-                hashDependencies({}),
-                TargetProfile{}
-            });
+        auto const testDir = std::string{"TestAssets_GlbInPlace"};
+        fs::remove_all(testDir);
+        fs::create_directories(testDir);
 
-            CHECK(manager.getDdc().exists(key));
+        createGridGLTF(testDir + "/grid.gltf", 8);
+        createGridGLB(testDir + "/grid.glb", 8);
+
+        auto importer = GltfImporter{};
+
+        SUBCASE("GLB matches the glTF with an external buffer")
+        {
+            auto const fromGltf = importer.importMesh(testDir + "/grid.gltf", MeshImportSettings{});
+            auto const fromGlb = importer.importMesh(testDir + "/grid.glb", MeshImportSettings{});
+            REQUIRE(fromGltf.has_value());
+            REQUIRE(fromGlb.has_value());
+            CHECK(fromGlb->submeshes.front().indexCount == 8 * 8 * 6);
+            CHECK(fromGlb->vertices == fromGltf->vertices);
+            CHECK(fromGlb->indices == fromGltf->indices);
+        }
+
+        SUBCASE("Embedded bufferView image is passed through unchanged")
+        {
+            create2x2PNG(testDir + "/albedo.png");
+            auto pngFile = std::ifstream{testDir + "/albedo.png", std::ios::binary};
+            auto const png = std::vector<char>{std::istreambuf_iterator<char>{pngFile}, std::istreambuf_iterator<char>{}};
+            createGridGLB(testDir + "/textured.glb", 4, png);
+
+            auto const materials = importer.importMaterials(testDir + "/textured.glb");
+            REQUIRE(materials.has_value());
+            REQUIRE(materials->size() == 1);
+            REQUIRE(materials->front().baseColorTexture.has_value());
+
+            auto const extractedPath = materials->front().baseColorTexture->path;
+            CHECK(extractedPath.extension() == ".png");
+            auto extractedFile = std::ifstream{extractedPath, std::ios::binary};
+            auto const extracted = std::vector<char>{std::istreambuf_iterator<char>{extractedFile}, std::istreambuf_iterator<char>{}};
+            CHECK(extracted == png);
+
+            auto const mesh = importer.importMesh(testDir + "/textured.glb", MeshImportSettings{});
+            REQUIRE(mesh.has_value());
+            CHECK(mesh->submeshes.front().indexCount == 4 * 4 * 6);
+        }
+
+        SUBCASE("Truncated external buffer is rejected")
+        {
+            fs::resize_file(testDir + "/grid.bin", 64);
+            CHECK_FALSE(importer.importMesh(testDir + "/grid.gltf", MeshImportSettings{}).has_value());
         }
 
         fs::remove_all(testDir);
-        fs::remove_all(cacheDir);
     }
 
     TEST_CASE("MeshImporter - Tangent Generation")
@@ -1060,6 +3438,97 @@ TEST_SUITE("Asset System - Stage 3 & 4")
         fs::remove_all(cacheDir);
     }
 
+    TEST_CASE("Tangent Generator - Grid")
+    {
+        using namespace april::asset;
+
+        SUBCASE("Planar grid matches the UV axes")
+        {
+            // 120x120 cells is enough triangles to split across worker tasks.
+            auto const grid = createTangentGrid(120, false, false);
+            auto vertices = grid.vertices;
+            REQUIRE(generateTangents(vertices, grid.indices));
+
+            for (size_t v = 0; v < vertices.size() / 12; ++v)
+            {
+                auto const* tangent = &vertices[v * 12 + 6];
+                CHECK(tangent[0] == doctest::Approx(1.0f).epsilon(1e-4f));
+                CHECK(tangent[1] == doctest::Approx(0.0f).epsilon(1e-4f));
+                CHECK(tangent[2] == doctest::Approx(0.0f).epsilon(1e-4f));
+                CHECK(tangent[3] == 1.0f);
+            }
+        }
+
+        SUBCASE("Mirrored U flips the tangent and bitangent sign")
+        {
+            auto const grid = createTangentGrid(120, true, false);
+            auto vertices = grid.vertices;
+            REQUIRE(generateTangents(vertices, grid.indices));
+
+            auto const* tangent = &vertices[(grid.vertices.size() / 12 / 2) * 12 + 6];
+            CHECK(tangent[0] == doctest::Approx(-1.0f).epsilon(1e-4f));
+            CHECK(tangent[3] == -1.0f);
+        }
+
+        SUBCASE("Curved grid stays orthonormal")
+        {
+            auto const grid = createTangentGrid(64, false, true);
+            auto vertices = grid.vertices;
+            REQUIRE(generateTangents(vertices, grid.indices));
+
+            auto maxError = 0.0f;
+            for (size_t v = 0; v < vertices.size() / 12; ++v)
+            {
+                auto const* normal = &vertices[v * 12 + 3];
+                auto const* tangent = &vertices[v * 12 + 6];
+                auto const length = std::sqrt(tangent[0] * tangent[0] + tangent[1] * tangent[1] + tangent[2] * tangent[2]);
+                auto const nDotT = normal[0] * tangent[0] + normal[1] * tangent[1] + normal[2] * tangent[2];
+                maxError = std::max({maxError, std::abs(length - 1.0f), std::abs(nDotT)});
+                // The u direction is +x everywhere, so the tangent leans along +x.
+                CHECK(tangent[0] > 0.5f);
+            }
+            CHECK(maxError < 1e-4f);
+        }
+
+        SUBCASE("Out-of-range and degenerate triangles are ignored")
+        {
+            auto grid = createTangentGrid(2, false, false);
+            grid.indices.push_back(0);
+            grid.indices.push_back(1);
+            grid.indices.push_back(100000);
+            // Collapsed UVs on an otherwise valid triangle.
+            grid.indices.push_back(0);
+            grid.indices.push_back(0);
+            grid.indices.push_back(1);
+
+            auto vertices = grid.vertices;
+            REQUIRE(generateTangents(vertices, grid.indices));
+            CHECK(vertices[6] == doctest::Approx(1.0f).epsilon(1e-4f));
+            CHECK_FALSE(generateTangents(vertices, std::span<uint32_t const>{}));
+        }
+    }
+
+    // Run with --no-skip to measure tangent generation on a multi-million triangle mesh.
+    TEST_CASE("Tangent Generator - Benchmark" * doctest::skip())
+    {
+        using namespace april::asset;
+
+        auto const grid = createTangentGrid(1200, false, true);
+        auto const triangleCount = grid.indices.size() / 3;
+
+        auto best = std::numeric_limits<double>::max();
+        for (int run = 0; run < 3; ++run)
+        {
+            auto vertices = grid.vertices;
+            auto const start = std::chrono::steady_clock::now();
+            REQUIRE(generateTangents(vertices, grid.indices));
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        MESSAGE(std::format("generateTangents: {} triangles in {:.1f} ms ({:.1f} Mtri/s)",
+            triangleCount, best, static_cast<double>(triangleCount) / (best * 1000.0)));
+    }
+
     TEST_CASE("AssetManager - Mesh Loading")
     {
         using namespace april::asset;
@@ -1107,6 +3576,132 @@ TEST_SUITE("Asset System - Stage 3 & 4")
         fs::remove_all(cacheDir);
     }
 
+    TEST_CASE("AssetManager - Bundle Cook and Load")
+    {
+        using namespace april::asset;
+
+        auto const testDir = std::string{"TestAssets_Bundle"};
+        auto const cacheDir = std::string{"TestCache_Bundle"};
+        auto const bundleFile = std::string{"TestBundle_Out/content.bundle"};
+        auto const textureSource = testDir + "/hero.png";
+        auto const textureAssetFile = testDir + "/hero.png.asset";
+        auto const meshSource = testDir + "/triangle.gltf";
+        auto const meshAssetFile = testDir + "/triangle.gltf.asset";
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::remove_all("TestBundle_Out");
+        fs::create_directories(testDir);
+
+        create2x2PNG(textureSource);
+        createMinimalGLTF(meshSource);
+
+        auto textureGuid = april::core::UUID{};
+        auto meshGuid = april::core::UUID{};
+        {
+            auto texture = TextureAsset{};
+            texture.setSourcePath(textureSource);
+            textureGuid = texture.getHandle();
+            auto json = nlohmann::json{};
+            texture.serializeJson(json);
+            std::ofstream(textureAssetFile) << json.dump(2);
+
+            auto mesh = StaticMeshAsset{};
+            mesh.setSourcePath(meshSource);
+            meshGuid = mesh.getHandle();
+            json = nlohmann::json{};
+            mesh.serializeJson(json);
+            std::ofstream(meshAssetFile) << json.dump(2);
+        }
+
+        {
+            auto manager = AssetManager{testDir, cacheDir};
+            REQUIRE(manager.cookBundle(bundleFile));
+        }
+
+        SUBCASE("Bundle header and TOC are GUID sorted with aligned payloads")
+        {
+            auto bundle = AssetBundle{};
+            REQUIRE(bundle.open(bundleFile));
+
+            auto const entries = bundle.getEntries();
+            REQUIRE(entries.size() == 2);
+            CHECK(entries[0].guid < entries[1].guid);
+            for (auto const& entry : entries)
+            {
+                CHECK(entry.payloadSize > 0);
+                CHECK(entry.payloadOffset % BundleHeader::kPayloadAlignment == 0);
+            }
+            CHECK(bundle.getTargetId() == TargetProfile{}.toId());
+            CHECK(bundle.find(textureGuid) != nullptr);
+            CHECK(bundle.find(meshGuid) != nullptr);
+        }
+
+        SUBCASE("Bundle mode resolves assets and cooked data without the DDC")
+        {
+            fs::remove_all(cacheDir);
+
+            auto manager = AssetManager{testDir, cacheDir, bundleFile};
+            REQUIRE(manager.isBundleMode());
+
+            auto texture = manager.getAsset<TextureAsset>(textureGuid);
+            REQUIRE(texture != nullptr);
+            auto textureBlob = std::vector<std::byte>{};
+            auto texturePayload = manager.getTextureData(*texture, textureBlob);
+            CHECK(texturePayload.isValid());
+            CHECK(texturePayload.header.width == 2);
+            CHECK(texturePayload.header.height == 2);
+
+            auto mesh = manager.loadAsset<StaticMeshAsset>(meshAssetFile);
+            REQUIRE(mesh != nullptr);
+            CHECK(mesh->getHandle() == meshGuid);
+            auto meshBlob = std::vector<std::byte>{};
+            auto meshPayload = manager.getMeshData(*mesh, meshBlob);
+            CHECK(meshPayload.isValid());
+            CHECK(meshPayload.header.vertexCount == 3);
+        }
+
+        SUBCASE("Async loads resolve through the bundle without loose .asset files")
+        {
+            fs::remove_all(cacheDir);
+            fs::remove(textureAssetFile);
+            fs::remove(meshAssetFile);
+
+            auto manager = AssetManager{testDir, cacheDir, bundleFile};
+            REQUIRE(manager.isBundleMode());
+
+            auto const request = manager.loadAssetAsync<StaticMeshAsset>(meshAssetFile);
+            REQUIRE(request != nullptr);
+            request->wait();
+            CHECK(request->getState() == LoadState::Ready);
+            auto const mesh = request->getAssetAs<StaticMeshAsset>();
+            REQUIRE(mesh != nullptr);
+            CHECK(mesh->getHandle() == meshGuid);
+            manager.processCompletedLoads();
+        }
+
+        SUBCASE("Assets outside the asset root fail the cook")
+        {
+            auto const outsideDir = std::string{"TestAssets_BundleOutside"};
+            fs::remove_all(outsideDir);
+            fs::create_directories(outsideDir);
+            create2x2PNG(outsideDir + "/stray.png");
+            auto const strayAssetFile = writeTextureAssetFile(outsideDir + "/stray.png");
+
+            auto const strayBundle = std::string{"TestBundle_Out/stray.bundle"};
+            auto manager = AssetManager{testDir, cacheDir};
+            REQUIRE(manager.loadAsset<TextureAsset>(strayAssetFile) != nullptr);
+            CHECK_FALSE(manager.cookBundle(strayBundle));
+            CHECK_FALSE(fs::exists(strayBundle));
+
+            fs::remove_all(outsideDir);
+        }
+
+        fs::remove_all(testDir);
+        fs::remove_all(cacheDir);
+        fs::remove_all("TestBundle_Out");
+    }
+
     TEST_CASE("Submesh Structure")
     {
         using namespace april::asset;
@@ -0,0 +1,129 @@
+#include <doctest/doctest.h>
+#include <scene/ecs-core.hpp>
+#include <vector>
+
+using namespace april::scene;
+
+namespace
+{
+    struct Value
+    {
+        int v{0};
+    };
+
+    struct Tag
+    {
+        int v{0};
+    };
+}
+
+TEST_CASE("SparseSet paged storage")
+{
+    SUBCASE("Indices either side of a page boundary")
+    {
+        SparseSet<Value> set{};
+        set.emplace(Entity{1023, 0}, 1023);
+        set.emplace(Entity{1024, 0}, 1024);
+        auto const bytes = set.sparseBytes();
+        set.emplace(Entity{1025, 0}, 1025);
+
+        // 1024 and 1025 share a page, so the second insert allocates nothing.
+        CHECK(set.sparseBytes() == bytes);
+
+        CHECK(set.size() == 3);
+        CHECK(set.contains(Entity{1023, 0}));
+        CHECK(set.contains(Entity{1024, 0}));
+        CHECK(set.contains(Entity{1025, 0}));
+        CHECK(set.get(Entity{1023, 0}).v == 1023);
+        CHECK(set.get(Entity{1024, 0}).v == 1024);
+        CHECK(set.get(Entity{1025, 0}).v == 1025);
+
+        CHECK_FALSE(set.contains(Entity{1022, 0}));
+        CHECK_FALSE(set.contains(Entity{1026, 0}));
+    }
+
+    SUBCASE("Lookups on an unallocated page")
+    {
+        SparseSet<Value> set{};
+        set.emplace(Entity{3, 0}, 3);
+        auto const bytes = set.sparseBytes();
+
+        CHECK_FALSE(set.contains(Entity{5000, 0}));
+        CHECK_FALSE(set.contains(Entity{1u << 20, 0}));
+        // Queries must not allocate pages.
+        CHECK(set.sparseBytes() == bytes);
+
+        Registry registry{};
+        auto entities = std::vector<Entity>{};
+        for (auto i = 0; i < 3000; ++i)
+        {
+            entities.push_back(registry.create());
+        }
+        registry.emplace<Value>(entities[1], 1);
+
+        CHECK(registry.allOf<Value>(entities[1]));
+        CHECK_FALSE(registry.allOf<Value>(entities[2500]));
+        CHECK_FALSE(registry.allOf<Value, Tag>(entities[2500]));
+    }
+
+    SUBCASE("Swap-and-pop remove across pages")
+    {
+        SparseSet<Value> set{};
+        set.emplace(Entity{10, 0}, 10);
+        set.emplace(Entity{2000, 0}, 2000);
+        set.emplace(Entity{4100, 0}, 4100);
+
+        set.remove(Entity{10, 0});
+
+        CHECK(set.size() == 2);
+        CHECK_FALSE(set.contains(Entity{10, 0}));
+        CHECK(set.getEntity(0) == Entity{4100, 0});
+        CHECK(set.get(Entity{4100, 0}).v == 4100);
+        CHECK(set.get(Entity{2000, 0}).v == 2000);
+
+        set.remove(Entity{2000, 0});
+        CHECK(set.size() == 1);
+        CHECK(set.getEntity(0) == Entity{4100, 0});
+        CHECK(set.get(Entity{4100, 0}).v == 4100);
+    }
+
+    SUBCASE("Re-adding after remove")
+    {
+        SparseSet<Value> set{};
+        set.emplace(Entity{1024, 0}, 1);
+        set.emplace(Entity{7, 0}, 7);
+        set.remove(Entity{1024, 0});
+        CHECK_FALSE(set.contains(Entity{1024, 0}));
+
+        set.emplace(Entity{1024, 0}, 2);
+        CHECK(set.size() == 2);
+        CHECK(set.contains(Entity{1024, 0}));
+        CHECK(set.get(Entity{1024, 0}).v == 2);
+        CHECK(set.get(Entity{7, 0}).v == 7);
+    }
+
+    SUBCASE("Stale generation on a reused index")
+    {
+        SparseSet<Value> set{};
+        set.emplace(Entity{1025, 0}, 1);
+        CHECK(set.contains(Entity{1025, 0}));
+        CHECK_FALSE(set.contains(Entity{1025, 1}));
+
+        Registry registry{};
+        auto const first = registry.create();
+        registry.emplace<Value>(first, 1);
+        registry.destroy(first);
+
+        auto const second = registry.create();
+        REQUIRE(second.index == first.index);
+        CHECK(second.generation != first.generation);
+        CHECK_FALSE(registry.valid(first));
+        CHECK_FALSE(registry.allOf<Value>(first));
+        CHECK_FALSE(registry.allOf<Value>(second));
+
+        registry.emplace<Value>(second, 2);
+        CHECK(registry.allOf<Value>(second));
+        CHECK_FALSE(registry.allOf<Value>(first));
+        CHECK(registry.get<Value>(second).v == 2);
+    }
+}
@@ -0,0 +1,109 @@
+#include <asset/asset-manager.hpp>
+#include <asset/target-profile.hpp>
+#include <core/log/logger.hpp>
+#include <core/profile/timer.hpp>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    struct CookOptions
+    {
+        std::filesystem::path assetRoot{"content"};
+        std::filesystem::path ddcRoot{"build/cache/DDC"};
+        std::filesystem::path output{"build/cooked/content.bundle"};
+        april::asset::TargetProfile target{};
+        bool help{false};
+    };
+
+    auto printUsage() -> void
+    {
+        AP_INFO("Usage: april-cook [--root <dir>] [--ddc <dir>] [--out <file>] "
+                "[--platform <name>] [--gpu-format <name>] [--quality <name>]");
+    }
+
+    auto parseArgs(int argc, char** argv, CookOptions& options) -> bool
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            auto const arg = std::string_view{argv[i]};
+            if (arg == "--help" || arg == "-h")
+            {
+                options.help = true;
+                return true;
+            }
+
+            if (i + 1 >= argc)
+            {
+                AP_ERROR("[april-cook] Missing value for {}", arg);
+                return false;
+            }
+
+            auto const value = std::string{argv[++i]};
+            if (arg == "--root")
+            {
+                options.assetRoot = value;
+            }
+            else if (arg == "--ddc")
+            {
+                options.ddcRoot = value;
+            }
+            else if (arg == "--out")
+            {
+                options.output = value;
+            }
+            else if (arg == "--platform")
+            {
+                options.target.platform = value;
+            }
+            else if (arg == "--gpu-format")
+            {
+                options.target.gpuFormat = value;
+            }
+            else if (arg == "--quality")
+            {
+                options.target.quality = value;
+            }
+            else
+            {
+                AP_ERROR("[april-cook] Unknown argument: {}", arg);
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = CookOptions{};
+    if (!parseArgs(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+    if (options.help)
+    {
+        printUsage();
+        return 0;
+    }
+
+    auto const start = april::core::Timer::now();
+
+    auto manager = april::asset::AssetManager{options.assetRoot, options.ddcRoot};
+    manager.setTargetProfile(options.target);
+
+    if (!manager.cookBundle(options.output))
+    {
+        AP_ERROR("[april-cook] Cook failed for target {}", options.target.toId());
+        return 1;
+    }
+
+    AP_INFO("[april-cook] Cooked {} for target {} in {:.2f} s",
+            options.output.string(), options.target.toId(),
+            april::core::Timer::calcDuration(start, april::core::Timer::now()) / 1000.0);
+    return 0;
+}
@@ -10,6 +10,7 @@ int main()
     config.compositeSceneToOutput = false;
     config.assetRoot = "content";
     config.ddcRoot = "build/cache/DDC";
+    config.hotReload = true;
 
     april::Engine engine(config);
 